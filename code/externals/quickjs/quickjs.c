@@ -266,6 +266,7 @@ struct JSRuntime {
     struct list_head tmp_obj_list; /* used during GC */
     JSGCPhaseEnum gc_phase : 8;
     size_t malloc_gc_threshold;
+    size_t malloc_gc_min_threshold; /* the threshold set by JS_SetGCThreshold() */
 #ifdef DUMP_LEAKS
     struct list_head string_list; /* list of JSString.link */
 #endif
@@ -282,6 +283,10 @@ struct JSRuntime {
     JSInterruptHandler *interrupt_handler;
     void *interrupt_opaque;
 
+    JSGCCallback *gc_callback;
+    void *gc_callback_opaque;
+    struct JSHeapWalkState *heap_walk;
+
     JSHostPromiseRejectionTracker *host_promise_rejection_tracker;
     void *host_promise_rejection_tracker_opaque;
     
@@ -1269,6 +1274,8 @@ static void js_trigger_gc(JSRuntime *rt, size_t size)
         JS_RunGC(rt);
         rt->malloc_gc_threshold = rt->malloc_state.malloc_size +
             (rt->malloc_state.malloc_size >> 1);
+        if (rt->malloc_gc_threshold < rt->malloc_gc_min_threshold)
+            rt->malloc_gc_threshold = rt->malloc_gc_min_threshold;
     }
 }
 
@@ -1768,10 +1775,17 @@ void JS_SetMemoryLimit(JSRuntime *rt, size_t limit)
     rt->malloc_state.malloc_limit = limit;
 }
 
-/* use -1 to disable automatic GC */
+/* use -1 to disable automatic GC. The heap is never collected below
+   gc_threshold, above it the threshold still grows with the heap. */
 void JS_SetGCThreshold(JSRuntime *rt, size_t gc_threshold)
 {
     rt->malloc_gc_threshold = gc_threshold;
+    rt->malloc_gc_min_threshold = gc_threshold;
+}
+
+size_t JS_GetMallocSize(JSRuntime *rt)
+{
+    return rt->malloc_state.malloc_size;
 }
 
 #define malloc(s) malloc_is_forbidden(s)
@@ -1784,6 +1798,12 @@ void JS_SetInterruptHandler(JSRuntime *rt, JSInterruptHandler *cb, void *opaque)
     rt->interrupt_opaque = opaque;
 }
 
+void JS_SetGCCallback(JSRuntime *rt, JSGCCallback *cb, void *opaque)
+{
+    rt->gc_callback = cb;
+    rt->gc_callback_opaque = opaque;
+}
+
 void JS_SetCanBlock(JSRuntime *rt, BOOL can_block)
 {
     rt->can_block = can_block;
@@ -2351,6 +2371,13 @@ void JS_SetMaxStackSize(JSRuntime *rt, size_t stack_size)
     rt->stack_size = stack_size;
 }
 
+/* should be called when changing thread or when the runtime was created
+   deeper in the stack than the frames that run JS code */
+void JS_UpdateStackTop(JSRuntime *rt)
+{
+    rt->stack_top = js_get_stack_pointer();
+}
+
 static inline BOOL is_strict_mode(JSContext *ctx)
 {
     JSStackFrame *sf = ctx->rt->current_stack_frame;
@@ -5781,6 +5808,9 @@ static void gc_free_cycles(JSRuntime *rt)
 
 void JS_RunGC(JSRuntime *rt)
 {
+    if (rt->gc_callback)
+        rt->gc_callback(rt, FALSE, rt->gc_callback_opaque);
+
     /* decrement the reference of the children of each object. mark =
        1 after this pass. */
     gc_decref(rt);
@@ -5790,6 +5820,256 @@ void JS_RunGC(JSRuntime *rt)
 
     /* free the GC objects in a cycle */
     gc_free_cycles(rt);
+
+    if (rt->gc_callback)
+        rt->gc_callback(rt, TRUE, rt->gc_callback_opaque);
+}
+
+typedef struct JSHeapWalkState {
+    const JSHeapWalker *walker;
+    void *opaque;
+} JSHeapWalkState;
+
+static void js_heap_string_value(JSString *str, char *buf, int buf_size)
+{
+    char *q = buf;
+    int i, c;
+
+    for(i = 0; i < str->len; i++) {
+        if (str->is_wide_char)
+            c = str->u.str16[i];
+        else
+            c = str->u.str8[i];
+        if ((q - buf) >= buf_size - UTF8_CHAR_LEN_MAX)
+            break;
+        if (c < 128) {
+            *q++ = c;
+        } else {
+            q += unicode_to_utf8((uint8_t *)q, c);
+        }
+    }
+    *q = '\0';
+}
+
+static const char *js_heap_edge_name(JSGCObjectHeader *gp)
+{
+    switch(gp->gc_obj_type) {
+    case JS_GC_OBJ_TYPE_FUNCTION_BYTECODE:
+        return "code";
+    case JS_GC_OBJ_TYPE_VAR_REF:
+        return "context";
+    case JS_GC_OBJ_TYPE_SHAPE:
+        return "map";
+    case JS_GC_OBJ_TYPE_ASYNC_FUNCTION:
+        return "async";
+    case JS_GC_OBJ_TYPE_JS_CONTEXT:
+        return "realm";
+    default:
+        return "internal";
+    }
+}
+
+/* JS_MarkFunc reporting the children as internal edges */
+static void js_heap_walk_mark(JSRuntime *rt, JSGCObjectHeader *gp)
+{
+    JSHeapWalkState *s = rt->heap_walk;
+    s->walker->edge(s->opaque, gp, JS_HEAP_EDGE_INTERNAL, js_heap_edge_name(gp), 0);
+}
+
+static void js_heap_walk_value(JSRuntime *rt, JSValueConst val, JSHeapEdgeType type,
+                               const char *name, uint32_t index)
+{
+    JSHeapWalkState *s = rt->heap_walk;
+    JSString *str;
+    char buf[256];
+
+    switch(JS_VALUE_GET_TAG(val)) {
+    case JS_TAG_OBJECT:
+    case JS_TAG_FUNCTION_BYTECODE:
+        s->walker->edge(s->opaque, JS_VALUE_GET_PTR(val), type, name, index);
+        break;
+    case JS_TAG_STRING:
+        str = JS_VALUE_GET_STRING(val);
+        js_heap_string_value(str, buf, sizeof(buf));
+        s->walker->string(s->opaque, str, buf, sizeof(JSString) +
+                          (str->len << str->is_wide_char) + 1 - str->is_wide_char);
+        s->walker->edge(s->opaque, str, type, name, index);
+        break;
+    default:
+        break;
+    }
+}
+
+/* constructor name for plain objects, own name for functions */
+static void js_heap_object_name(JSRuntime *rt, JSObject *p, char *buf, int buf_size)
+{
+    JSProperty *pr;
+    JSShapeProperty *prs;
+    JSObject *p1 = p;
+
+    buf[0] = '\0';
+    if (p->class_id != JS_CLASS_BYTECODE_FUNCTION && !rt->class_array[p->class_id].call) {
+        p1 = p->shape->proto;
+        if (p1) {
+            prs = find_own_property(&pr, p1, JS_ATOM_constructor);
+            if (prs && (prs->flags & JS_PROP_TMASK) == JS_PROP_NORMAL &&
+                JS_VALUE_GET_TAG(pr->u.value) == JS_TAG_OBJECT)
+                p1 = JS_VALUE_GET_OBJ(pr->u.value);
+            else
+                p1 = NULL;
+        }
+    }
+    if (p1) {
+        prs = find_own_property(&pr, p1, JS_ATOM_name);
+        if (prs && (prs->flags & JS_PROP_TMASK) == JS_PROP_NORMAL &&
+            JS_VALUE_GET_TAG(pr->u.value) == JS_TAG_STRING)
+            js_heap_string_value(JS_VALUE_GET_STRING(pr->u.value), buf, buf_size);
+    }
+    if (buf[0] == '\0')
+        pstrcpy(buf, buf_size, JS_AtomGetStrRT(rt, buf, buf_size, rt->class_array[p->class_id].class_name));
+}
+
+static void js_heap_walk_object(JSRuntime *rt, JSObject *p)
+{
+    JSHeapWalkState *s = rt->heap_walk;
+    JSShape *sh = p->shape;
+    JSShapeProperty *prs;
+    JSProperty *pr;
+    JSHeapNodeType type;
+    JSClassGCMark *gc_mark;
+    size_t size;
+    const char *name;
+    char buf[256], accessor[300];
+    uint32_t i;
+
+    size = sizeof(JSObject) + sizeof(JSProperty) * sh->prop_size;
+    if (p->class_id == JS_CLASS_BYTECODE_FUNCTION || rt->class_array[p->class_id].call)
+        type = JS_HEAP_NODE_CLOSURE;
+    else if (p->class_id == JS_CLASS_REGEXP)
+        type = JS_HEAP_NODE_REGEXP;
+    else
+        type = JS_HEAP_NODE_OBJECT;
+    if (p->class_id == JS_CLASS_ARRAY || p->class_id == JS_CLASS_ARGUMENTS)
+        size += sizeof(JSValue) * p->u.array.count;
+    else if ((p->class_id == JS_CLASS_ARRAY_BUFFER ||
+              p->class_id == JS_CLASS_SHARED_ARRAY_BUFFER) && p->u.array_buffer)
+        size += p->u.array_buffer->byte_length;
+    js_heap_object_name(rt, p, buf, sizeof(buf));
+    s->walker->node(s->opaque, p, type, buf, size, p->header.ref_count);
+
+    s->walker->edge(s->opaque, sh, JS_HEAP_EDGE_INTERNAL, "map", 0);
+    prs = get_shape_prop(sh);
+    for(i = 0; i < sh->prop_count; i++, prs++) {
+        pr = &p->prop[i];
+        if (prs->atom == JS_ATOM_NULL)
+            continue;
+        name = JS_AtomGetStrRT(rt, buf, sizeof(buf), prs->atom);
+        switch(prs->flags & JS_PROP_TMASK) {
+        case JS_PROP_GETSET:
+            snprintf(accessor, sizeof(accessor), "get %s", name);
+            if (pr->u.getset.getter)
+                s->walker->edge(s->opaque, pr->u.getset.getter, JS_HEAP_EDGE_PROPERTY, accessor, 0);
+            accessor[0] = 's';
+            if (pr->u.getset.setter)
+                s->walker->edge(s->opaque, pr->u.getset.setter, JS_HEAP_EDGE_PROPERTY, accessor, 0);
+            break;
+        case JS_PROP_VARREF:
+            if (pr->u.var_ref->is_detached)
+                s->walker->edge(s->opaque, pr->u.var_ref, JS_HEAP_EDGE_CONTEXT, name, 0);
+            break;
+        case JS_PROP_AUTOINIT:
+            js_autoinit_mark(rt, pr, js_heap_walk_mark);
+            break;
+        default:
+            if (__JS_AtomIsTaggedInt(prs->atom))
+                js_heap_walk_value(rt, pr->u.value, JS_HEAP_EDGE_ELEMENT, NULL, __JS_AtomToUInt32(prs->atom));
+            else
+                js_heap_walk_value(rt, pr->u.value, JS_HEAP_EDGE_PROPERTY, name, 0);
+            break;
+        }
+    }
+
+    if (p->class_id == JS_CLASS_ARRAY || p->class_id == JS_CLASS_ARGUMENTS) {
+        /* count is 0 once the array is no longer fast */
+        for(i = 0; i < p->u.array.count; i++)
+            js_heap_walk_value(rt, p->u.array.u.values[i], JS_HEAP_EDGE_ELEMENT, NULL, i);
+    } else if (p->class_id != JS_CLASS_OBJECT) {
+        gc_mark = rt->class_array[p->class_id].gc_mark;
+        if (gc_mark)
+            gc_mark(rt, JS_MKPTR(JS_TAG_OBJECT, p), js_heap_walk_mark);
+    }
+}
+
+/* report every GC object with its outgoing references, mirroring
+   mark_children() so that the references which are not accounted for
+   by the heap itself identify the roots */
+void JS_WalkHeap(JSRuntime *rt, const JSHeapWalker *walker, void *opaque)
+{
+    JSHeapWalkState state, *s = &state;
+    struct list_head *el;
+    JSGCObjectHeader *gp;
+    char buf[256];
+    int i;
+
+    s->walker = walker;
+    s->opaque = opaque;
+    rt->heap_walk = s;
+    list_for_each(el, &rt->gc_obj_list) {
+        gp = list_entry(el, JSGCObjectHeader, link);
+        switch(gp->gc_obj_type) {
+        case JS_GC_OBJ_TYPE_JS_OBJECT:
+            js_heap_walk_object(rt, (JSObject *)gp);
+            break;
+        case JS_GC_OBJ_TYPE_FUNCTION_BYTECODE:
+            {
+                JSFunctionBytecode *b = (JSFunctionBytecode *)gp;
+                if (b->func_name != JS_ATOM_NULL)
+                    pstrcpy(buf, sizeof(buf), JS_AtomGetStrRT(rt, buf, sizeof(buf), b->func_name));
+                else
+                    buf[0] = '\0';
+                walker->node(opaque, gp, JS_HEAP_NODE_CODE, buf,
+                             sizeof(*b) + b->byte_code_len + sizeof(JSValue) * b->cpool_count,
+                             gp->ref_count);
+                for(i = 0; i < b->cpool_count; i++)
+                    js_heap_walk_value(rt, b->cpool[i], JS_HEAP_EDGE_HIDDEN, NULL, i);
+                if (b->realm)
+                    walker->edge(opaque, b->realm, JS_HEAP_EDGE_INTERNAL, "realm", 0);
+            }
+            break;
+        case JS_GC_OBJ_TYPE_VAR_REF:
+            {
+                JSVarRef *var_ref = (JSVarRef *)gp;
+                walker->node(opaque, gp, JS_HEAP_NODE_HIDDEN, "(closure variable)",
+                             sizeof(*var_ref), gp->ref_count);
+                if (var_ref->is_detached)
+                    js_heap_walk_value(rt, *var_ref->pvalue, JS_HEAP_EDGE_INTERNAL, "value", 0);
+            }
+            break;
+        case JS_GC_OBJ_TYPE_ASYNC_FUNCTION:
+            walker->node(opaque, gp, JS_HEAP_NODE_HIDDEN, "(async function)",
+                         sizeof(JSAsyncFunctionData), gp->ref_count);
+            mark_children(rt, gp, js_heap_walk_mark);
+            break;
+        case JS_GC_OBJ_TYPE_SHAPE:
+            {
+                JSShape *sh = (JSShape *)gp;
+                walker->node(opaque, gp, JS_HEAP_NODE_HIDDEN, "(shape)",
+                             get_shape_size(sh->prop_hash_mask + 1, sh->prop_size),
+                             gp->ref_count);
+                if (sh->proto)
+                    walker->edge(opaque, sh->proto, JS_HEAP_EDGE_INTERNAL, "__proto__", 0);
+            }
+            break;
+        case JS_GC_OBJ_TYPE_JS_CONTEXT:
+            walker->node(opaque, gp, JS_HEAP_NODE_HIDDEN, "(realm)",
+                         sizeof(JSContext), gp->ref_count);
+            mark_children(rt, gp, js_heap_walk_mark);
+            break;
+        default:
+            break;
+        }
+    }
+    rt->heap_walk = NULL;
 }
 
 /* Return false if not an object or if the object has already been
@@ -6453,6 +6733,79 @@ static const char *get_func_name(JSContext *ctx, JSValueConst func)
     return JS_ToCString(ctx, val);
 }
 
+int JS_GetStackFrames(JSContext *ctx, const void **frames, int max_frames)
+{
+    JSStackFrame *sf;
+    JSObject *p;
+    int n = 0;
+
+    for (sf = ctx->rt->current_stack_frame; sf != NULL && n < max_frames; sf = sf->prev_frame) {
+        if (JS_VALUE_GET_TAG(sf->cur_func) != JS_TAG_OBJECT) {
+            frames[n++] = NULL;
+            continue;
+        }
+        p = JS_VALUE_GET_OBJ(sf->cur_func);
+        /* closures of the same function share their bytecode */
+        if (js_class_has_bytecode(p->class_id))
+            frames[n++] = p->u.func.function_bytecode;
+        else
+            frames[n++] = p;
+    }
+    return n;
+}
+
+JSValue JS_GetStackFrameFunction(JSContext *ctx, int level)
+{
+    JSStackFrame *sf;
+    JSObject *p;
+
+    for (sf = ctx->rt->current_stack_frame; sf != NULL && level > 0; sf = sf->prev_frame)
+        level--;
+    if (!sf || JS_VALUE_GET_TAG(sf->cur_func) != JS_TAG_OBJECT)
+        return JS_UNDEFINED;
+    p = JS_VALUE_GET_OBJ(sf->cur_func);
+    if (js_class_has_bytecode(p->class_id))
+        return JS_DupValue(ctx, JS_MKPTR(JS_TAG_FUNCTION_BYTECODE, p->u.func.function_bytecode));
+    return JS_DupValue(ctx, sf->cur_func);
+}
+
+int JS_GetStackFrameInfo(JSContext *ctx, int level, char *name, int name_size,
+                         char *filename, int filename_size, int *line_num)
+{
+    JSStackFrame *sf;
+    JSObject *p;
+    const char *str;
+
+    for (sf = ctx->rt->current_stack_frame; sf != NULL && level > 0; sf = sf->prev_frame)
+        level--;
+    if (!sf)
+        return -1;
+    name[0] = '\0';
+    filename[0] = '\0';
+    *line_num = -1;
+    if (JS_VALUE_GET_TAG(sf->cur_func) != JS_TAG_OBJECT)
+        return 0;
+    p = JS_VALUE_GET_OBJ(sf->cur_func);
+    if (js_class_has_bytecode(p->class_id)) {
+        JSFunctionBytecode *b = p->u.func.function_bytecode;
+        /* JS_AtomGetStr() may return the atom storage instead of filling buf */
+        if (b->func_name != JS_ATOM_NULL)
+            pstrcpy(name, name_size, JS_AtomGetStr(ctx, name, name_size, b->func_name));
+        if (b->has_debug) {
+            if (b->debug.filename != JS_ATOM_NULL)
+                pstrcpy(filename, filename_size, JS_AtomGetStr(ctx, filename, filename_size, b->debug.filename));
+            *line_num = b->debug.line_num;
+        }
+    } else {
+        str = get_func_name(ctx, sf->cur_func);
+        if (str) {
+            pstrcpy(name, name_size, str);
+            JS_FreeCString(ctx, str);
+        }
+    }
+    return 0;
+}
+
 #define JS_BACKTRACE_FLAG_SKIP_FIRST_LEVEL (1 << 0)
 /* only taken into account if filename is provided */
 #define JS_BACKTRACE_FLAG_SINGLE_LEVEL     (1 << 1)
@@ -33634,6 +33987,7 @@ typedef struct BCWriterState {
     BOOL allow_bytecode : 8;
     BOOL allow_sab : 8;
     BOOL allow_reference : 8;
+    BOOL strip_debug : 8;
     uint32_t first_atom;
     uint32_t *atom_to_idx;
     int atom_to_idx_size;
@@ -34099,8 +34453,13 @@ static int JS_WriteFunctionTag(BCWriterState *s, JSValueConst obj)
     if (b->has_debug) {
         bc_put_atom(s, b->debug.filename);
         bc_put_leb128(s, b->debug.line_num);
-        bc_put_leb128(s, b->debug.pc2line_len);
-        dbuf_put(&s->dbuf, b->debug.pc2line_buf, b->debug.pc2line_len);
+        /* the filename is kept, import() resolves relative names with it */
+        if (s->strip_debug) {
+            bc_put_leb128(s, 0);
+        } else {
+            bc_put_leb128(s, b->debug.pc2line_len);
+            dbuf_put(&s->dbuf, b->debug.pc2line_buf, b->debug.pc2line_len);
+        }
     }
     
     for(i = 0; i < b->cpool_count; i++) {
@@ -34475,6 +34834,7 @@ uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
     s->allow_bytecode = ((flags & JS_WRITE_OBJ_BYTECODE) != 0);
     s->allow_sab = ((flags & JS_WRITE_OBJ_SAB) != 0);
     s->allow_reference = ((flags & JS_WRITE_OBJ_REFERENCE) != 0);
+    s->strip_debug = ((flags & JS_WRITE_OBJ_STRIP_DEBUG) != 0);
     /* XXX: could use a different version when bytecode is included */
     if (s->allow_bytecode)
         s->first_atom = JS_ATOM_END;
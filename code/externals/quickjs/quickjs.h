@@ -334,7 +334,9 @@ IJ_API JSRuntime *JS_NewRuntime(void);
 IJ_API void JS_SetRuntimeInfo(JSRuntime *rt, const char *info);
 IJ_API void JS_SetMemoryLimit(JSRuntime *rt, size_t limit);
 IJ_API void JS_SetGCThreshold(JSRuntime *rt, size_t gc_threshold);
+IJ_API size_t JS_GetMallocSize(JSRuntime *rt);
 IJ_API void JS_SetMaxStackSize(JSRuntime *rt, size_t stack_size);
+IJ_API void JS_UpdateStackTop(JSRuntime *rt);
 IJ_API JSRuntime *JS_NewRuntime2(const JSMallocFunctions *mf, void *opaque);
 IJ_API void JS_FreeRuntime(JSRuntime *rt);
 IJ_API void *JS_GetRuntimeOpaque(JSRuntime *rt);
@@ -412,6 +414,46 @@ typedef struct JSMemoryUsage {
 IJ_API void JS_ComputeMemoryUsage(JSRuntime *rt, JSMemoryUsage *s);
 IJ_API void JS_DumpMemoryUsage(FILE *fp, const JSMemoryUsage *s, JSRuntime *rt);
 
+/* heap walking, the node and edge types follow the V8 heap snapshot format */
+typedef enum JSHeapNodeType {
+    JS_HEAP_NODE_HIDDEN,
+    JS_HEAP_NODE_ARRAY,
+    JS_HEAP_NODE_STRING,
+    JS_HEAP_NODE_OBJECT,
+    JS_HEAP_NODE_CODE,
+    JS_HEAP_NODE_CLOSURE,
+    JS_HEAP_NODE_REGEXP,
+    JS_HEAP_NODE_NUMBER,
+    JS_HEAP_NODE_NATIVE,
+    JS_HEAP_NODE_SYNTHETIC,
+} JSHeapNodeType;
+
+typedef enum JSHeapEdgeType {
+    JS_HEAP_EDGE_CONTEXT,
+    JS_HEAP_EDGE_ELEMENT,
+    JS_HEAP_EDGE_PROPERTY,
+    JS_HEAP_EDGE_INTERNAL,
+    JS_HEAP_EDGE_HIDDEN,
+    JS_HEAP_EDGE_SHORTCUT,
+    JS_HEAP_EDGE_WEAK,
+} JSHeapEdgeType;
+
+typedef struct JSHeapWalker {
+    /* called once per GC object, ref_count includes the references
+       held from outside of the heap */
+    void (*node)(void *opaque, const void *ptr, JSHeapNodeType type,
+                 const char *name, size_t self_size, int ref_count);
+    /* called for every string reference, strings are not GC objects */
+    void (*string)(void *opaque, const void *ptr, const char *value,
+                   size_t self_size);
+    /* outgoing reference of the last node, element and hidden edges
+       use 'index', the other ones 'name' */
+    void (*edge)(void *opaque, const void *to, JSHeapEdgeType type,
+                 const char *name, uint32_t index);
+} JSHeapWalker;
+
+IJ_API void JS_WalkHeap(JSRuntime *rt, const JSHeapWalker *walker, void *opaque);
+
 /* atom support */
 #define JS_ATOM_NULL 0
 
@@ -836,6 +878,18 @@ IJ_API void JS_SetHostPromiseRejectionTracker(JSRuntime *rt, JSHostPromiseReject
 /* return != 0 if the JS code needs to be interrupted */
 typedef int JSInterruptHandler(JSRuntime *rt, void *opaque);
 IJ_API void JS_SetInterruptHandler(JSRuntime *rt, JSInterruptHandler *cb, void *opaque);
+/* called with done = FALSE before and done = TRUE after each cycle collection */
+typedef void JSGCCallback(JSRuntime *rt, JS_BOOL done, void *opaque);
+IJ_API void JS_SetGCCallback(JSRuntime *rt, JSGCCallback *cb, void *opaque);
+/* stack sampling: store one identity per frame of the current stack,
+   innermost first, and return the number of frames stored */
+IJ_API int JS_GetStackFrames(JSContext *ctx, const void **frames, int max_frames);
+/* a counted reference to the identity JS_GetStackFrames() stores for the frame at
+   'level', holding it keeps the identity from being reused by another function */
+IJ_API JSValue JS_GetStackFrameFunction(JSContext *ctx, int level);
+/* describe the frame at 'level' of the current stack without allocating JS values */
+IJ_API int JS_GetStackFrameInfo(JSContext *ctx, int level, char *name, int name_size,
+                                char *filename, int filename_size, int *line_num);
 /* if can_block is TRUE, Atomics.wait() can be used */
 IJ_API void JS_SetCanBlock(JSRuntime *rt, JS_BOOL can_block);
 /* set the [IsHTMLDDA] internal slot */
@@ -875,6 +929,7 @@ IJ_API int JS_ExecutePendingJob(JSRuntime *rt, JSContext **pctx);
 #define JS_WRITE_OBJ_REFERENCE (1 << 3) /* allow object references to
                                            encode arbitrary object
                                            graph */
+#define JS_WRITE_OBJ_STRIP_DEBUG (1 << 4) /* drop the line number tables */
 IJ_API uint8_t *JS_WriteObject(JSContext *ctx, size_t *psize, JSValueConst obj,
                         int flags);
 IJ_API uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
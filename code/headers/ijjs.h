@@ -42,8 +42,58 @@
 typedef struct IJJSRunOptions {
     IJBool abort_on_unhandled_rejection;
     size_t stack_size;
+    IJU32 job_budget;
+    IJU32 job_budget_us;
+    IJBool cpu_prof;
+    IJU32 cpu_prof_interval;
+    const IJAnsi* cpu_prof_dir;
+    const IJAnsi* code_cache_dir;
+    IJBool module_prefetch;
+    const IJAnsi* http_cache_dir;
+    IJBool offline;
+    size_t memory_limit;
+    size_t gc_threshold;
 } IJJSRunOptions;
 
+enum {
+    IJJS_PHASE_TIMERS = 0,
+    IJJS_PHASE_IMMEDIATES,
+    IJJS_PHASE_IO,
+    IJJS_PHASE_FS,
+    IJJS_PHASE_CURL,
+    IJJS_PHASE_MICROTASKS,
+    IJJS_PHASE_GC,
+    IJJS_PHASE_COUNT
+};
+
+typedef struct {
+    IJU64 count;
+    IJU64 min;
+    IJU64 max;
+    IJF64 sum;
+    IJU32 buckets[IJJS_HIST_BUCKETS];
+} IJJSHistogram;
+
+typedef struct {
+    const IJAnsi* name;
+    IJU64 start;
+    IJU64 duration;
+} IJJSStartupEntry;
+
+typedef struct {
+    IJU64 start;
+    IJU64 duration;
+    size_t freed;
+    size_t heap_size;
+} IJJSGCEntry;
+
+typedef struct {
+    struct IJJSImmediate* items;
+    IJU32 count;
+    IJU32 size;
+    IJU32 pos;
+} IJJSImmediateQueue;
+
 typedef struct IJJSRuntime {
     IJJSRunOptions options;
     JSRuntime* rt;
@@ -53,6 +103,8 @@ typedef struct IJJSRuntime {
         uv_check_t check;
         uv_idle_t idle;
         uv_prepare_t prepare;
+        IJU64 tick_start;
+        IJBool exhausted;
     } jobs;
     uv_async_t stop;
     IJBool is_worker;
@@ -61,9 +113,91 @@ typedef struct IJJSRuntime {
         void* curlm_h;
         uv_timer_t timer;
     } curl_ctx;
+    struct {
+        void* curlm_h;
+        struct IJJSHttpModule* list;
+    } http_modules;
     struct {
         IM3Environment env;
     } wasm_ctx;
+    struct {
+        IJS32 index;
+        IJS32 tcache;
+        IJS32 flags;
+    } arena;
+    struct {
+        uv_timer_t handle;
+        IJU64 now;
+        IJU64 due;
+        IJU32 refs;
+        IJU64 pending[IJJS_TIMER_LEVELS];
+        struct list_head slots[IJJS_TIMER_LEVELS][IJJS_TIMER_SLOTS];
+    } timers;
+    struct {
+        uv_check_t check;
+        IJS64 next_id;
+        IJJSImmediateQueue queue;
+        IJJSImmediateQueue batch;
+    } immediates;
+    struct {
+        uv_timer_t timer;
+        struct IJJSCronJob** heap;
+        IJU32 count;
+        IJU32 size;
+    } cron;
+    struct {
+        uv_timer_t timer;
+        uv_idle_t idle;
+#if IJJS_PLATFORM == IJJS_PLATFORM_LINUX
+        uv_poll_t poll;
+        IJS32 fd;
+#endif
+        struct list_head list;
+    } hrtimers;
+    struct {
+        IJU64 start;
+        IJU64 last_check;
+        IJU64 last_idle;
+        IJU64 ticks;
+        IJU64 jobs;
+        IJU64 tick_jobs;
+        IJU64 max_tick_jobs;
+        IJU64 budget_hits;
+        IJJSHistogram lag;
+    } metrics;
+    struct {
+        IJU64 origin;
+        IJU32 lazy_loaded;
+        IJU32 count;
+        IJJSStartupEntry entries[IJJS_STARTUP_ENTRIES];
+    } startup;
+    struct {
+        IJBool enabled;
+        IJU64 since;
+        uv_timer_t dump;
+        IJJSHistogram phases[IJJS_PHASE_COUNT];
+    } profiler;
+    struct {
+        IJU64 start;
+        size_t start_size;
+        IJU32 head;
+        IJU32 count;
+        IJJSGCEntry entries[IJJS_GC_ENTRIES];
+    } gc;
+    struct IJJSCpuProfiler* cpu_profiler;
+    struct IJJSResolveCache* resolve;
+    struct IJJSJsonModule* json_modules;
+    struct {
+        uv_mutex_t mutex;
+        uv_cond_t cond;
+        struct IJJSPrefetch** table;
+    } prefetch;
+    struct {
+        const IJU8* data;
+        size_t size;
+        IJBool owned;
+        struct IJJSBundleBuilder* builder;
+    } bundle;
     struct {
         JSValue u8array_ctor;
     } builtins;
@@ -122,6 +256,10 @@ IJ_API JSValue ijEvalFile(
     IJBool is_main, 
     IJAnsi* override_filename);
 
+IJ_API JSValue ijEvalBundle(
+    JSContext* ctx, 
+    IJBool is_main);
+
 IJ_API IJVoid ijAssert(
     const struct IJJSAssertionInfo info);
 
@@ -212,8 +350,20 @@ IJ_API JSValue ijNewUint8Array(
     IJU8* data, 
     size_t size);
 
+IJ_API IJS32 ijDiagnosticFilename(
+    IJAnsi* buf,
+    size_t size,
+    const IJAnsi* dir,
+    const IJAnsi* prefix);
+
 IJ_API IJVoid ijCurlInit(IJVoid);
 
+IJ_API size_t ijCurlWriteCb(
+    IJAnsi* ptr,
+    size_t size,
+    size_t nmemb,
+    IJVoid* userdata);
+
 IJ_API IJS32 ijCurlLoadHttp(
     DynBuf* dbuf, 
     const IJAnsi* url);
@@ -221,6 +371,142 @@ IJ_API IJS32 ijCurlLoadHttp(
 IJ_API void* ijGetCurlm(
     JSContext* ctx);
     
+IJ_API IJVoid ijModAllocatorInit(
+    JSContext* ctx, 
+    JSModuleDef* m);
+
+IJ_API IJVoid ijModAllocatorExport(
+    JSContext* ctx, 
+    JSModuleDef* m);
+
+IJ_API IJS32 ijAllocatorConfigure(
+    const IJAnsi* conf);
+
+IJ_API IJVoid ijAllocatorAttach(
+    IJJSRuntime* qrt);
+
+IJ_API IJVoid ijAllocatorDetach(
+    IJJSRuntime* qrt);
+
+IJ_API size_t ijAllocatorArenaAllocated(
+    IJJSRuntime* qrt);
+
+IJ_API IJBool ijBundleDetect(
+    const IJU8* buf,
+    size_t len);
+
+IJ_API IJS32 ijBundleAttach(
+    JSContext* ctx,
+    const IJU8* data,
+    size_t size,
+    IJBool owned);
+
+IJ_API JSValue ijBundleEntry(
+    JSContext* ctx);
+
+IJ_API const IJU8* ijBundleEmbedded(
+    size_t* size);
+
+IJ_API IJS32 ijBundleFind(
+    IJJSRuntime* qrt,
+    const IJAnsi* module_name);
+
+IJ_API JSValue ijBundleLoadModule(
+    JSContext* ctx,
+    const IJAnsi* module_name);
+
+IJ_API IJVoid ijBundleClose(
+    IJJSRuntime* qrt);
+
+IJ_API IJS32 ijBundleAdd(
+    JSContext* ctx,
+    const IJAnsi* module_name,
+    JSModuleDef* m,
+    IJBool native);
+
+IJ_API IJS32 ijBundleScanWorkers(
+    JSContext* ctx,
+    const IJAnsi* source,
+    size_t len);
+
+IJ_API IJS32 ijBundleCompile(
+    JSContext* ctx,
+    const IJAnsi* filename,
+    const IJAnsi* output,
+    IJBool strip_debug,
+    IJBool executable);
+
+IJ_API struct IJJSResolveCache* ijResolveCacheNew(
+    struct IJJSResolveCache* parent);
+
+IJ_API IJVoid ijResolveCacheRelease(
+    struct IJJSResolveCache* cache);
+
+IJ_API IJBool ijResolveExists(
+    IJJSRuntime* qrt,
+    const IJAnsi* path);
+
+IJ_API IJS32 ijResolveRealpath(
+    IJJSRuntime* qrt,
+    const IJAnsi* path,
+    IJAnsi* buf,
+    size_t size);
+
+IJ_API IJVoid ijPrefetchInit(
+    IJJSRuntime* qrt);
+
+IJ_API IJVoid ijPrefetchShutdown(
+    IJJSRuntime* qrt);
+
+IJ_API IJVoid ijPrefetchImports(
+    JSContext* ctx,
+    const IJAnsi* filename,
+    const DynBuf* source);
+
+IJ_API IJBool ijPrefetchTake(
+    JSContext* ctx,
+    const IJAnsi* filename,
+    DynBuf* source);
+
+IJ_API IJVoid ijHttpModulePrefetch(
+    JSContext* ctx,
+    const IJAnsi* url);
+
+IJ_API IJS32 ijHttpModuleLoad(
+    JSContext* ctx,
+    const IJAnsi* url,
+    DynBuf* dbuf);
+
+IJ_API IJVoid ijHttpModuleForget(
+    JSContext* ctx,
+    const IJAnsi* url);
+
+IJ_API IJVoid ijHttpModuleShutdown(
+    IJJSRuntime* qrt);
+
+IJ_API JSValue ijCodeCacheLoad(
+    JSContext* ctx,
+    const IJAnsi* filename,
+    DynBuf* source);
+
+IJ_API IJVoid ijCodeCacheStore(
+    JSContext* ctx,
+    const IJAnsi* filename,
+    JSValueConst module,
+    const DynBuf* source);
+
+IJ_API IJS32 ijCodeCacheBuild(
+    JSContext* ctx,
+    const IJAnsi* filename);
+
+IJ_API IJVoid ijModCronInit(
+    JSContext* ctx, 
+    JSModuleDef* m);
+
+IJ_API IJVoid ijModCronExport(
+    JSContext* ctx, 
+    JSModuleDef* m);
+
 IJ_API IJVoid ijModDNSInit(
     JSContext* ctx, 
     JSModuleDef* m);
@@ -245,6 +531,38 @@ IJ_API IJVoid ijModFSExport(
     JSContext* ctx, 
     JSModuleDef* m);
 
+IJ_API IJVoid ijModHeapInit(
+    JSContext* ctx, 
+    JSModuleDef* m);
+
+IJ_API IJVoid ijModHeapExport(
+    JSContext* ctx, 
+    JSModuleDef* m);
+
+IJ_API IJVoid ijModHrTimerInit(
+    JSContext* ctx, 
+    JSModuleDef* m);
+
+IJ_API IJVoid ijModHrTimerExport(
+    JSContext* ctx, 
+    JSModuleDef* m);
+
+IJ_API IJVoid ijModLoopProfInit(
+    JSContext* ctx, 
+    JSModuleDef* m);
+
+IJ_API IJVoid ijModLoopProfExport(
+    JSContext* ctx, 
+    JSModuleDef* m);
+
+IJ_API IJVoid ijModProfilerInit(
+    JSContext* ctx, 
+    JSModuleDef* m);
+
+IJ_API IJVoid ijModProfilerExport(
+    JSContext* ctx, 
+    JSModuleDef* m);
+
 IJ_API IJVoid ijModMiscInit(
     JSContext* ctx, 
     JSModuleDef* m);
@@ -293,6 +611,9 @@ IJ_API IJVoid ijModTimersExport(
     JSContext* ctx, 
     JSModuleDef* m);
 
+IJ_API IJVoid ijTimersShutdown(
+    JSContext* ctx);
+
 IJ_API IJVoid ijModUdpInit(
     JSContext* ctx, 
     JSModuleDef* m);
@@ -309,6 +630,9 @@ IJ_API IJVoid ijModWasmExport(
     JSContext* ctx, 
     JSModuleDef* m);
 
+IJ_API zlog_category_t* ijGetLogCategory(
+    IJVoid);
+
 IJ_API IJVoid ijModLogInit(
     JSContext* ctx,
     JSModuleDef* m);
@@ -359,6 +683,32 @@ IJ_API uv_stream_t* ijPipeGetStream(
 IJ_API IJVoid ijExecuteJobs(
     JSContext* ctx);
 
+IJ_API IJVoid ijHistogramRecord(
+    IJJSHistogram* h,
+    IJU64 value);
+
+IJ_API IJU64 ijHistogramPercentile(
+    IJJSHistogram* h,
+    IJF64 percentile);
+
+IJ_API IJVoid ijHistogramReset(
+    IJJSHistogram* h);
+
+IJ_API IJU64 ijProfileBegin(
+    IJJSRuntime* qrt);
+
+IJ_API IJVoid ijProfileEnd(
+    IJJSRuntime* qrt,
+    IJS32 phase,
+    IJU64 start);
+
+IJ_API IJS32 ijCpuProfilerStart(
+    IJJSRuntime* qrt,
+    IJU32 interval);
+
+IJ_API IJS32 ijCpuProfilerShutdown(
+    IJJSRuntime* qrt);
+
 IJ_API IJS32 ijLoadFile(
     JSContext* ctx, 
     DynBuf* dbuf, 
@@ -375,6 +725,18 @@ IJ_API IJAnsi* ijModuleNormalizer(
     const IJAnsi* name, 
     IJVoid* opaque);
 
+IJ_API JSModuleDef* ijModuleNewJson(
+    JSContext* ctx,
+    const IJAnsi* module_name,
+    JSValue value);
+
+IJ_API JSValue ijModuleJsonValue(
+    JSContext* ctx,
+    JSModuleDef* m);
+
+IJ_API IJVoid ijModuleFreeJson(
+    IJJSRuntime* qrt);
+
 IJ_API JSModuleDef* ijInitModuleStd(
     JSContext* ctx, 
     const IJAnsi* module_name);
@@ -395,6 +757,11 @@ IJ_API IJS32 ijEvalBinary(
     const IJU8* buf, 
     size_t buf_len);
 
+IJ_API IJVoid ijStartupMark(
+    IJJSRuntime* qrt,
+    const IJAnsi* name,
+    IJU64 start);
+
 IJ_API IJVoid ijBootstrapGlobals(
     JSContext* ctx);
 
@@ -404,7 +771,8 @@ IJ_API IJVoid ijAddBuiltins(
 IJ_API uv_loop_t* ijGetLoopRT(
     IJJSRuntime *qrt);
 
-IJ_API IJJSRuntime* ijNewRuntimeWorker(IJVoid);
+IJ_API IJJSRuntime* ijNewRuntimeWorker(
+    IJJSRunOptions* options);
 
 IJ_API IJJSRuntime* ijNewRuntimeInternal(
     IJBool is_worker, 
@@ -66,6 +66,20 @@
 
 #define IJJS_DEFAULt_READ_SIZE 65536
 
+#define IJJS_TIMER_LEVELS 4
+
+#define IJJS_TIMER_BITS 6
+
+#define IJJS_TIMER_SLOTS (1 << IJJS_TIMER_BITS)
+
+#define IJJS_HIST_SUB_BITS 3
+
+#define IJJS_HIST_BUCKETS ((64 - IJJS_HIST_SUB_BITS + 1) << IJJS_HIST_SUB_BITS)
+
+#define IJJS_STARTUP_ENTRIES 32
+
+#define IJJS_GC_ENTRIES 256
+
 #define STDIN_FILENO 0
 
 #define STDOUT_FILENO 1
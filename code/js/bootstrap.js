@@ -4,6 +4,9 @@ globalThis.setTimeout = core.setTimeout;
 globalThis.clearTimeout = core.clearTimeout;
 globalThis.setInterval = core.setInterval;
 globalThis.clearInterval = core.clearInterval;
+globalThis.setImmediate = core.setImmediate;
+globalThis.clearImmediate = core.clearImmediate;
+globalThis.queueMicrotask = core.queueMicrotask;
 globalThis.alert = core.alert;
 
 Object.defineProperty(globalThis, 'global', {
@@ -31,6 +34,9 @@ const noExport = [
     'setInterval',
     'clearTimeout',
     'clearInterval',
+    'setImmediate',
+    'clearImmediate',
+    'queueMicrotask',
     'alert',
     'XMLHttpRequest',
     'Worker',
@@ -389,7 +389,8 @@ function hasOwnProperty(obj, v) {
     return Object.prototype.hasOwnProperty.call(obj, v);
 }
 
-const encoder = new TextEncoder();
+// created on first use so the console does not pull in the encoding module at startup
+let encoder;
 
 const tableChars = {
   middleMiddle: "─",
@@ -416,6 +417,9 @@ function removeColors(str) {
 function countBytes(str) {
   const normalized = removeColors(String(str)).normalize("NFC");
 
+  if (!encoder) {
+    encoder = new TextEncoder();
+  }
   return encoder.encode(normalized).byteLength;
 }
 
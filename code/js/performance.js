@@ -1,16 +1,44 @@
 // https://www.w3.org/TR/user-timing/
 // Derived from: https://github.com/blackswanny/performance-polyfill
+
+// as many collections as the runtime buffers, IJJS_GC_ENTRIES
+const kMaxGCEntries = 256;
+
 class Performance {
     constructor() {
         this._startTime = hrtimeMs();
         this._entries = [];
         this._marksIndex = Object.create(null);
+        this._gcCount = 0;
     }
 
     get timeOrigin() {
         return this._startTime;
     }
 
+    eventLoopUtilization(util1, util2) {
+        let { idle, active, ticks, jobs } = util2 ? util1 : ijjs.loopMetrics();
+        const base = util2 || util1;
+        if (base) {
+            idle -= base.idle;
+            active -= base.active;
+            ticks -= base.ticks;
+            jobs -= base.jobs;
+        }
+        return {
+            idle,
+            active,
+            utilization: idle + active > 0 ? active / (idle + active) : 0,
+            ticks,
+            jobs,
+            jobsPerTick: ticks > 0 ? jobs / ticks : 0
+        };
+    }
+
+    eventLoopLag(reset = false) {
+        return ijjs.loopMetrics(reset).lag;
+    }
+
     now() {
         return hrtimeMs() - this._startTime;
     }
@@ -60,13 +88,41 @@ class Performance {
     }
 
     getEntriesByType(type) {
+        this._takeGCEntries();
         return this._entries.filter(entry => entry.entryType === type);
     }
 
     getEntriesByName(name) {
+        this._takeGCEntries();
         return this._entries.filter(entry => entry.name === name);
     }
 
+    clearGC() {
+        this._takeGCEntries();
+        this._entries = this._entries.filter(entry => entry.entryType !== 'gc');
+        this._gcCount = 0;
+    }
+
+    // the runtime buffers the most recent collections until they are asked for,
+    // only as many are kept here so that polling does not grow the entries forever
+    _takeGCEntries() {
+        for (const { startTime, duration, freed, heapSize } of ijjs.gcEntries()) {
+            this._entries.push({
+                name: 'gc',
+                entryType: 'gc',
+                startTime: startTime - this._startTime,
+                duration,
+                detail: { freed, heapSize }
+            });
+            this._gcCount++;
+        }
+        let excess = this._gcCount - kMaxGCEntries;
+        if (excess > 0) {
+            this._entries = this._entries.filter(entry => entry.entryType !== 'gc' || excess-- <= 0);
+            this._gcCount = kMaxGCEntries;
+        }
+    }
+
     clearMarks(name) {
         if (typeof name === 'undefined') {
             this._entries = this._entries.filter(entry => entry.entryType !== 'mark');
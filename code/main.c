@@ -22,6 +22,7 @@
 #include "headers/ijjs.h"
 #include "externals/jsmin/jsmin.c"
 #include "jemalloc/jemalloc.h"
+#include <ctype.h>
 #include <stdarg.h>
 #include <stdlib.h>
 #include <string.h>
@@ -30,6 +31,11 @@
 #define EXIT_INVALID_ARG 2
 #define OPT_PREFIX '-'
 #define OPT_ASSIGN '='
+#if defined(_WIN32) || defined(_WIN64) || defined(WIN32) || defined(WIN64)
+#define EXE_SUFFIX ".exe"
+#else
+#define EXE_SUFFIX ""
+#endif
 
 #define is_longopt(opt, str) (opt.name && !strncmp(opt.name, str, opt.length))
 
@@ -47,11 +53,24 @@ typedef struct FileItem {
 typedef struct Flags {
     bool empty_run;
     bool strict_module_detection;
+    bool build_code_cache;
+    bool strip_debug;
+    bool executable;
+    char* compile_entry;
+    char* compile_output;
     struct list_head preload_modules;
     char* eval_expr;
     char* override_filename;
+    char malloc_conf[512];
 } Flags;
 
+static bool append_malloc_conf(Flags* flags, const char* key, const char* value) {
+    size_t len = strlen(flags->malloc_conf);
+    int n = snprintf(flags->malloc_conf + len, sizeof(flags->malloc_conf) - len, "%s%s%s%s",
+                     len ? "," : "", key ? key : "", key ? ":" : "", value);
+    return n > 0 && (size_t) n < sizeof(flags->malloc_conf) - len;
+}
+
 static int eprintf(const char* format, ...) {
     va_list argp;
     va_start(argp, format);
@@ -100,6 +119,21 @@ static int eval_module(JSContext* ctx, const char* filepath, char* override_file
     return ret;
 }
 
+static int eval_bundle(JSContext* ctx, const uint8_t* bundle, size_t bundle_size) {
+    JSValue val;
+    int ret = 0;
+    if (ijBundleAttach(ctx, bundle, bundle_size, false))
+        val = JS_EXCEPTION;
+    else
+        val = ijEvalBundle(ctx, true);
+    if (JS_IsException(val)) {
+        ijDumpError(ctx);
+        ret = -1;
+    }
+    JS_FreeValue(ctx, val);
+    return ret;
+}
+
 static void print_help(void) {
     printf("Usage: ijjs [options] [file]\n"
            "\n"
@@ -110,8 +144,28 @@ static void print_help(void) {
            "  -l, --load FILENAME             module to preload (option can be repeated)\n"
            "  -q, --quit                      just instantiate the interpreter and quit\n"
            "  --abort-on-unhandled-rejection  abort when a rejected promise is not caught\n"
+           "  --background-thread             purge unused allocator pages from background threads\n"
+           "  --build-code-cache              compile file and its imports into the code cache and quit\n"
+           "  --code-cache DIR                cache compiled modules in DIR and load them from there\n"
+           "  --compile FILENAME              compile FILENAME and its imports into a bytecode bundle\n"
+           "  --cpu-prof                      write a .cpuprofile and a .folded CPU profile on exit\n"
+           "  --cpu-prof-dir DIR              directory the CPU profiles are written to\n"
+           "  --cpu-prof-interval MICROSECONDS  CPU profiler sampling interval (default 1000)\n"
+           "  --dirty-decay-ms MS             time before unused dirty pages are purged (-1 never)\n"
+           "  --executable                    make --compile write a standalone executable that runs the bundle\n"
+           "  --gc-threshold SIZE             heap size below which the GC does not run (default 256k)\n"
+           "  --http-cache DIR                keep modules imported from urls in DIR (default ~/.cache/ijjs/http)\n"
+           "  --job-budget COUNT              max promise jobs run per loop iteration\n"
+           "  --job-budget-time MICROSECONDS  max time spent running promise jobs per loop iteration\n"
+           "  --malloc-conf CONF              run time allocator options, same syntax as MALLOC_CONF\n"
+           "  --max-heap-size SIZE            fail allocations that would grow the heap past SIZE, e.g. 512m\n"
+           "  --muzzy-decay-ms MS             time before unused muzzy pages are purged (-1 never)\n"
+           "  --no-module-prefetch            do not read the imports of a module on the thread pool\n"
+           "  --offline                       load modules imported from urls from the http cache only\n"
+           "  --output FILENAME               where --compile writes the bundle (default: the entry with .ijb)\n"
            "  --override-filename FILENAME    override filename in error messages\n"
            "  --stack-size STACKSIZE          set max stack size\n"
+           "  --strip-debug                   leave line numbers out of the --compile bundle\n"
            "  --strict-module-detection       only run code as a module if its extension is \".mjs\"\n");
 }
 #ifdef WIN32
@@ -471,6 +525,24 @@ static char* get_option_value(char* arg, int argc, char** argv, int* optind) {
     return value;
 }
 
+/* a byte count with an optional k, m or g suffix */
+static bool parse_size(const char* value, size_t* size) {
+    char* end;
+    unsigned long long n;
+    if (!value || !isdigit((unsigned char)*value))
+        return false;
+    n = strtoull(value, &end, 10);
+    switch (*end) {
+    case 'g': case 'G': n <<= 10; /* fall through */
+    case 'm': case 'M': n <<= 10; /* fall through */
+    case 'k': case 'K': n <<= 10; end++; break;
+    }
+    if (*end || n == 0)
+        return false;
+    *size = (size_t) n;
+    return true;
+}
+
 int main(int argc, char** argv) {
     IJJSRuntime* qrt = NULL;
     JSContext* ctx = NULL;
@@ -479,12 +551,21 @@ int main(int argc, char** argv) {
     ijDefaultOptions(&runOptions);
     Flags flags = { .empty_run = false,
                     .strict_module_detection = false,
+                    .build_code_cache = false,
+                    .strip_debug = false,
+                    .executable = false,
+                    .compile_entry = NULL,
+                    .compile_output = NULL,
                     .eval_expr = NULL,
                     .override_filename = NULL,
+                    .malloc_conf = { 0 },
                     .preload_modules = LIST_HEAD_INIT(flags.preload_modules) };
     ijSetupArgs(argc, argv);
+    /* a packaged app gets all of its arguments */
+    size_t bundle_size = 0;
+    const uint8_t* bundle = ijBundleEmbedded(&bundle_size);
     int optind = 1;
-    while (optind < argc && *argv[optind] == OPT_PREFIX) {
+    while (!bundle && optind < argc && *argv[optind] == OPT_PREFIX) {
         char* arg = argv[optind] + 1;
         CLIOption opt = { .key = 0, .name = NULL, .length = 0 };
         if (!get_option(&arg, &opt))
@@ -541,6 +622,27 @@ int main(int argc, char** argv) {
                 list_add_tail(&file->link, &flags.preload_modules);
                 break;
             }
+            if (is_longopt(opt, "compile") || is_longopt(opt, "output")) {
+                char* filename = get_option_value(arg, argc, argv, &optind);
+                if (filename) {
+                    if (is_longopt(opt, "compile"))
+                        flags.compile_entry = filename;
+                    else
+                        flags.compile_output = filename;
+                    break;
+                }
+                report_missing_argument(&opt);
+                exit_code = EXIT_INVALID_ARG;
+                goto exit;
+            }
+            if (is_longopt(opt, "executable")) {
+                flags.executable = true;
+                break;
+            }
+            if (is_longopt(opt, "strip-debug")) {
+                flags.strip_debug = true;
+                break;
+            }
             if (is_longopt(opt, "override-filename")) {
                 flags.override_filename = get_option_value(arg, argc, argv, &optind);
                 if (flags.override_filename)
@@ -562,6 +664,103 @@ int main(int argc, char** argv) {
                 exit_code = EXIT_INVALID_ARG;
                 goto exit;
             }
+            if (is_longopt(opt, "max-heap-size") || is_longopt(opt, "gc-threshold")) {
+                char* size = get_option_value(arg, argc, argv, &optind);
+                if (parse_size(size, *opt.name == 'm' ? &runOptions.memory_limit : &runOptions.gc_threshold))
+                    break;
+                report_missing_argument(&opt);
+                exit_code = EXIT_INVALID_ARG;
+                goto exit;
+            }
+            if (is_longopt(opt, "job-budget") || is_longopt(opt, "job-budget-time")) {
+                char* budget = get_option_value(arg, argc, argv, &optind);
+                if (budget) {
+                    long n = strtol(budget, NULL, 10);
+                    if (n > 0) {
+                        if (is_longopt(opt, "job-budget"))
+                            runOptions.job_budget = (IJU32) n;
+                        else
+                            runOptions.job_budget_us = (IJU32) n;
+                        break;
+                    }
+                }
+                report_missing_argument(&opt);
+                exit_code = EXIT_INVALID_ARG;
+                goto exit;
+            }
+            if (is_longopt(opt, "cpu-prof")) {
+                runOptions.cpu_prof = true;
+                break;
+            }
+            if (is_longopt(opt, "cpu-prof-dir")) {
+                runOptions.cpu_prof_dir = get_option_value(arg, argc, argv, &optind);
+                if (runOptions.cpu_prof_dir)
+                    break;
+                report_missing_argument(&opt);
+                exit_code = EXIT_INVALID_ARG;
+                goto exit;
+            }
+            if (is_longopt(opt, "cpu-prof-interval")) {
+                char* interval = get_option_value(arg, argc, argv, &optind);
+                if (interval) {
+                    long n = strtol(interval, NULL, 10);
+                    if (n > 0) {
+                        runOptions.cpu_prof_interval = (IJU32) n;
+                        break;
+                    }
+                }
+                report_missing_argument(&opt);
+                exit_code = EXIT_INVALID_ARG;
+                goto exit;
+            }
+            if (is_longopt(opt, "code-cache")) {
+                runOptions.code_cache_dir = get_option_value(arg, argc, argv, &optind);
+                if (runOptions.code_cache_dir)
+                    break;
+                report_missing_argument(&opt);
+                exit_code = EXIT_INVALID_ARG;
+                goto exit;
+            }
+            if (is_longopt(opt, "build-code-cache")) {
+                flags.build_code_cache = true;
+                break;
+            }
+            if (is_longopt(opt, "http-cache")) {
+                runOptions.http_cache_dir = get_option_value(arg, argc, argv, &optind);
+                if (runOptions.http_cache_dir)
+                    break;
+                report_missing_argument(&opt);
+                exit_code = EXIT_INVALID_ARG;
+                goto exit;
+            }
+            if (is_longopt(opt, "offline")) {
+                runOptions.offline = true;
+                break;
+            }
+            if (is_longopt(opt, "no-module-prefetch")) {
+                runOptions.module_prefetch = false;
+                break;
+            }
+            if (is_longopt(opt, "malloc-conf")) {
+                char* conf = get_option_value(arg, argc, argv, &optind);
+                if (conf && append_malloc_conf(&flags, NULL, conf))
+                    break;
+                report_missing_argument(&opt);
+                exit_code = EXIT_INVALID_ARG;
+                goto exit;
+            }
+            if (is_longopt(opt, "dirty-decay-ms") || is_longopt(opt, "muzzy-decay-ms")) {
+                char* ms = get_option_value(arg, argc, argv, &optind);
+                if (ms && append_malloc_conf(&flags, *opt.name == 'd' ? "dirty_decay_ms" : "muzzy_decay_ms", ms))
+                    break;
+                report_missing_argument(&opt);
+                exit_code = EXIT_INVALID_ARG;
+                goto exit;
+            }
+            if (is_longopt(opt, "background-thread")) {
+                append_malloc_conf(&flags, "background_thread", "true");
+                break;
+            }
             if (opt.key == 'q' || is_longopt(opt, "quit")) {
                 flags.empty_run = true;
                 break;
@@ -579,10 +778,43 @@ int main(int argc, char** argv) {
             goto exit;
         }
     }
+    if (flags.build_code_cache && (!runOptions.code_cache_dir || optind >= argc)) {
+        eprintf("--build-code-cache needs --code-cache DIR and a file\n");
+        exit_code = EXIT_INVALID_ARG;
+        goto exit;
+    }
+    if (*flags.malloc_conf) {
+        int r = ijAllocatorConfigure(flags.malloc_conf);
+        if (r) {
+            eprintf("invalid allocator options \"%s\": %s\n", flags.malloc_conf, strerror(r));
+            exit_code = EXIT_INVALID_ARG;
+            goto exit;
+        }
+    }
     qrt = ijNewRuntimeOptions(&runOptions);
     ctx = ijGetJSContext(qrt);
     if (flags.empty_run)
         goto exit;
+    if (flags.compile_entry) {
+        char output[PATH_MAX];
+        if (flags.compile_output)
+            snprintf(output, sizeof(output), "%s", flags.compile_output);
+        else
+            snprintf(output, sizeof(output), "%.*s%s", (int) (strlen(flags.compile_entry) - (has_suffix2(flags.compile_entry, ".js") ? 3 : 0)),
+                     flags.compile_entry, flags.executable ? EXE_SUFFIX : ".ijb");
+        if (ijBundleCompile(ctx, flags.compile_entry, output, flags.strip_debug, flags.executable)) {
+            ijDumpError(ctx);
+            exit_code = EXIT_FAILURE;
+        }
+        goto exit;
+    }
+    if (flags.build_code_cache) {
+        if (ijCodeCacheBuild(ctx, argv[optind])) {
+            ijDumpError(ctx);
+            exit_code = EXIT_FAILURE;
+        }
+        goto exit;
+    }
     struct list_head* el = NULL;
     struct list_head* el1 = NULL;
     list_for_each(el, &flags.preload_modules) {
@@ -594,7 +826,12 @@ int main(int argc, char** argv) {
         }
     }
 
-    if (flags.eval_expr) {
+    if (bundle) {
+        if (eval_bundle(ctx, bundle, bundle_size)) {
+            exit_code = EXIT_FAILURE;
+            goto exit;
+        }
+    } else if (flags.eval_expr) {
         if (eval_buf(ctx, flags.eval_expr, "<cmdline>", JS_EVAL_TYPE_GLOBAL)) {
             exit_code = EXIT_FAILURE;
             goto exit;
@@ -615,6 +852,9 @@ exit:
         free(file);
     }
     if (qrt) {
+        /* the profile is written before the runtime goes away, a failed write fails the run */
+        if (ijCpuProfilerShutdown(qrt) != 0 && exit_code == EXIT_SUCCESS)
+            exit_code = EXIT_FAILURE;
         ijFreeRuntime(qrt);
     }
     return exit_code;
@@ -0,0 +1,316 @@
+/*
+ ijjs javascript runtime engine
+ Copyright (C) 2010-2017 Trix
+
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include "ijjs.h"
+#include <errno.h>
+#include <string.h>
+
+/* arenas of freed runtimes are handed to the next runtime, jemalloc cannot
+   destroy an arena that may still own memory freed later by another thread */
+static uv_once_t arena__init_once = UV_ONCE_INIT;
+static uv_mutex_t arena__mutex;
+static IJU32* arena__free;
+static IJU32 arena__free_count;
+static IJU32 arena__free_size;
+
+static IJVoid ijAllocatorInitOnce(IJVoid) {
+    CHECK_EQ(uv_mutex_init(&arena__mutex), 0);
+}
+
+IJVoid ijAllocatorAttach(IJJSRuntime* qrt) {
+    IJU32 arena = 0;
+    IJU32 tcache = 0;
+    size_t len = sizeof(arena);
+    IJBool reused = false;
+    qrt->arena.index = -1;
+    qrt->arena.tcache = -1;
+    qrt->arena.flags = 0;
+    uv_once(&arena__init_once, ijAllocatorInitOnce);
+    uv_mutex_lock(&arena__mutex);
+    if (arena__free_count > 0) {
+        arena = arena__free[--arena__free_count];
+        reused = true;
+    }
+    uv_mutex_unlock(&arena__mutex);
+    /* without an arena of its own the runtime shares the automatic ones */
+    if (!reused && je_mallctl("arenas.create", &arena, &len, NULL, 0))
+        return;
+    qrt->arena.index = (IJS32)arena;
+    qrt->arena.flags = MALLOCX_ARENA(arena);
+    len = sizeof(tcache);
+    if (je_mallctl("tcache.create", &tcache, &len, NULL, 0) == 0) {
+        qrt->arena.tcache = (IJS32)tcache;
+        qrt->arena.flags |= MALLOCX_TCACHE(tcache);
+    } else {
+        qrt->arena.flags |= MALLOCX_TCACHE_NONE;
+    }
+    /* the C side of the runtime (libuv, curl, wasm3) allocates on the same thread */
+    je_mallctl("thread.arena", NULL, NULL, &arena, sizeof(arena));
+}
+
+IJVoid ijAllocatorDetach(IJJSRuntime* qrt) {
+    if (qrt->arena.tcache >= 0) {
+        IJU32 tcache = (IJU32)qrt->arena.tcache;
+        je_mallctl("tcache.destroy", NULL, NULL, &tcache, sizeof(tcache));
+        qrt->arena.tcache = -1;
+    }
+    if (qrt->arena.index < 0)
+        return;
+    uv_mutex_lock(&arena__mutex);
+    if (arena__free_count == arena__free_size) {
+        IJU32 size = arena__free_size ? arena__free_size * 2 : 8;
+        IJU32* free_list = je_realloc(arena__free, size * sizeof(*free_list));
+        if (free_list) {
+            arena__free = free_list;
+            arena__free_size = size;
+        }
+    }
+    if (arena__free_count < arena__free_size)
+        arena__free[arena__free_count++] = (IJU32)qrt->arena.index;
+    uv_mutex_unlock(&arena__mutex);
+    qrt->arena.index = -1;
+    qrt->arena.flags = 0;
+}
+
+static JSValue ijThrowMallctl(JSContext* ctx, const IJAnsi* name, IJS32 err) {
+    return JS_ThrowInternalError(ctx, "mallctl %s failed: %s", name, strerror(err));
+}
+
+static size_t ijMallctlSize(const IJAnsi* name) {
+    size_t value = 0;
+    size_t len = sizeof(value);
+    if (je_mallctl(name, &value, &len, NULL, 0))
+        return 0;
+    return value;
+}
+
+static size_t ijMallctlArenaSize(IJU32 arena, const IJAnsi* stat) {
+    IJAnsi name[128];
+    snprintf(name, sizeof(name), "stats.arenas.%u.%s", arena, stat);
+    return ijMallctlSize(name);
+}
+
+size_t ijAllocatorArenaAllocated(IJJSRuntime* qrt) {
+    IJU64 epoch = 1;
+    size_t len = sizeof(epoch);
+    if (qrt->arena.index < 0)
+        return 0;
+    je_mallctl("epoch", &epoch, &len, &epoch, len);
+    return ijMallctlArenaSize((IJU32)qrt->arena.index, "small.allocated") +
+        ijMallctlArenaSize((IJU32)qrt->arena.index, "large.allocated");
+}
+
+static intptr_t ijMallctlDecay(const IJAnsi* name) {
+    intptr_t value = 0;
+    size_t len = sizeof(value);
+    if (je_mallctl(name, &value, &len, NULL, 0))
+        return 0;
+    return value;
+}
+
+static JSValue ijAllocatorStats(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJU64 epoch = 1;
+    size_t len = sizeof(epoch);
+    /* the statistics are a snapshot taken when the epoch advances */
+    IJS32 r = je_mallctl("epoch", &epoch, &len, &epoch, len);
+    if (r)
+        return ijThrowMallctl(ctx, "epoch", r);
+    size_t page = ijMallctlSize("arenas.page");
+    IJU32 narenas = 0;
+    len = sizeof(narenas);
+    je_mallctl("arenas.narenas", &narenas, &len, NULL, 0);
+    IJBool background = false;
+    len = sizeof(background);
+    je_mallctl("background_thread", &background, &len, NULL, 0);
+    JSValue obj = JS_NewObjectProto(ctx, JS_NULL);
+    JS_DefinePropertyValueStr(ctx, obj, "allocated", JS_NewInt64(ctx, ijMallctlSize("stats.allocated")), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "active", JS_NewInt64(ctx, ijMallctlSize("stats.active")), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "metadata", JS_NewInt64(ctx, ijMallctlSize("stats.metadata")), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "resident", JS_NewInt64(ctx, ijMallctlSize("stats.resident")), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "mapped", JS_NewInt64(ctx, ijMallctlSize("stats.mapped")), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "retained", JS_NewInt64(ctx, ijMallctlSize("stats.retained")), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "dirtyDecayMs", JS_NewInt64(ctx, ijMallctlDecay("arenas.dirty_decay_ms")), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "muzzyDecayMs", JS_NewInt64(ctx, ijMallctlDecay("arenas.muzzy_decay_ms")), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "backgroundThread", JS_NewBool(ctx, background), JS_PROP_C_W_E);
+    JSValue arenas = JS_NewArray(ctx);
+    IJU32 count = 0;
+    for (IJU32 i = 0; i < narenas; i++) {
+        IJAnsi name[64];
+        IJBool initialized = false;
+        len = sizeof(initialized);
+        snprintf(name, sizeof(name), "arena.%u.initialized", i);
+        if (je_mallctl(name, &initialized, &len, NULL, 0) || !initialized)
+            continue;
+        IJU32 nthreads = 0;
+        len = sizeof(nthreads);
+        snprintf(name, sizeof(name), "stats.arenas.%u.nthreads", i);
+        je_mallctl(name, &nthreads, &len, NULL, 0);
+        JSValue arena = JS_NewObjectProto(ctx, JS_NULL);
+        JS_DefinePropertyValueStr(ctx, arena, "index", JS_NewUint32(ctx, i), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, arena, "threads", JS_NewUint32(ctx, nthreads), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, arena, "allocated", JS_NewInt64(ctx,
+            ijMallctlArenaSize(i, "small.allocated") + ijMallctlArenaSize(i, "large.allocated")), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, arena, "active", JS_NewInt64(ctx, ijMallctlArenaSize(i, "pactive") * page), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, arena, "dirty", JS_NewInt64(ctx, ijMallctlArenaSize(i, "pdirty") * page), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, arena, "muzzy", JS_NewInt64(ctx, ijMallctlArenaSize(i, "pmuzzy") * page), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, arena, "resident", JS_NewInt64(ctx, ijMallctlArenaSize(i, "resident")), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, arena, "mapped", JS_NewInt64(ctx, ijMallctlArenaSize(i, "mapped")), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, arena, "retained", JS_NewInt64(ctx, ijMallctlArenaSize(i, "retained")), JS_PROP_C_W_E);
+        JS_DefinePropertyValueUint32(ctx, arenas, count++, arena, JS_PROP_C_W_E);
+    }
+    JS_DefinePropertyValueStr(ctx, obj, "arenas", arenas, JS_PROP_C_W_E);
+    return obj;
+}
+
+static IJS32 ijAllocatorSetDecay(const IJAnsi* which, intptr_t ms) {
+    IJAnsi name[64];
+    IJU32 narenas = 0;
+    size_t len = sizeof(narenas);
+    /* the default applies to arenas created later on, existing ones are updated one by one */
+    snprintf(name, sizeof(name), "arenas.%s_decay_ms", which);
+    IJS32 r = je_mallctl(name, NULL, NULL, &ms, sizeof(ms));
+    if (r)
+        return r;
+    je_mallctl("arenas.narenas", &narenas, &len, NULL, 0);
+    for (IJU32 i = 0; i < narenas; i++) {
+        IJBool initialized = false;
+        len = sizeof(initialized);
+        snprintf(name, sizeof(name), "arena.%u.initialized", i);
+        if (je_mallctl(name, &initialized, &len, NULL, 0) || !initialized)
+            continue;
+        snprintf(name, sizeof(name), "arena.%u.%s_decay_ms", i, which);
+        r = je_mallctl(name, NULL, NULL, &ms, sizeof(ms));
+        if (r)
+            return r;
+    }
+    return 0;
+}
+
+/* the allocator is shared by every runtime of the process and jemalloc reads
+   MALLOC_CONF before main runs, so the options that can still change at run time
+   are applied with mallctl */
+IJS32 ijAllocatorConfigure(const IJAnsi* conf) {
+    IJAnsi buf[512];
+    IJAnsi* next;
+    if (!conf || strlen(conf) >= sizeof(buf))
+        return EINVAL;
+    strcpy(buf, conf);
+    for (IJAnsi* opt = buf; *opt; opt = next) {
+        IJAnsi* value;
+        IJAnsi* end = NULL;
+        IJS32 r;
+        next = strchr(opt, ',');
+        if (next)
+            *next++ = '\0';
+        else
+            next = opt + strlen(opt);
+        value = strchr(opt, ':');
+        if (!value)
+            return EINVAL;
+        *value++ = '\0';
+        if (!strcmp(opt, "background_thread")) {
+            IJBool enable;
+            if (!strcmp(value, "true"))
+                enable = true;
+            else if (!strcmp(value, "false"))
+                enable = false;
+            else
+                return EINVAL;
+            r = je_mallctl("background_thread", NULL, NULL, &enable, sizeof(enable));
+        } else if (!strcmp(opt, "max_background_threads")) {
+            size_t n = (size_t)strtoul(value, &end, 10);
+            if (end == value || *end)
+                return EINVAL;
+            r = je_mallctl("max_background_threads", NULL, NULL, &n, sizeof(n));
+        } else if (!strcmp(opt, "dirty_decay_ms") || !strcmp(opt, "muzzy_decay_ms")) {
+            intptr_t ms = (intptr_t)strtol(value, &end, 10);
+            if (end == value || *end || ms < -1)
+                return EINVAL;
+            opt[5] = '\0';
+            r = ijAllocatorSetDecay(opt, ms);
+        } else {
+            return ENOTSUP;
+        }
+        if (r)
+            return r;
+    }
+    return 0;
+}
+
+static JSValue ijAllocatorDecay(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    static const IJAnsi* which[] = { "dirty", "muzzy" };
+    for (IJS32 i = 0; i < 2; i++) {
+        IJS64 ms;
+        if (JS_IsUndefined(argv[i]))
+            continue;
+        if (JS_ToInt64(ctx, &ms, argv[i]))
+            return JS_EXCEPTION;
+        /* -1 disables purging, 0 purges right away */
+        if (ms < -1)
+            return JS_ThrowRangeError(ctx, "invalid %s decay time", which[i]);
+        IJS32 r = ijAllocatorSetDecay(which[i], (intptr_t)ms);
+        if (r)
+            return ijThrowMallctl(ctx, i ? "arenas.muzzy_decay_ms" : "arenas.dirty_decay_ms", r);
+    }
+    return JS_UNDEFINED;
+}
+
+static JSValue ijAllocatorBackgroundThread(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJBool enabled = false;
+    size_t len = sizeof(enabled);
+    IJS32 r;
+    if (JS_IsUndefined(argv[0])) {
+        r = je_mallctl("background_thread", &enabled, &len, NULL, 0);
+    } else {
+        IJBool enable = JS_ToBool(ctx, argv[0]);
+        r = je_mallctl("background_thread", &enabled, &len, &enable, sizeof(enable));
+        enabled = enable;
+    }
+    if (r)
+        return ijThrowMallctl(ctx, "background_thread", r);
+    return JS_NewBool(ctx, enabled);
+}
+
+static JSValue ijAllocatorPurge(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJAnsi name[64];
+    snprintf(name, sizeof(name), "arena.%u.purge", MALLCTL_ARENAS_ALL);
+    IJS32 r = je_mallctl(name, NULL, NULL, NULL, 0);
+    if (r)
+        return ijThrowMallctl(ctx, name, r);
+    return JS_UNDEFINED;
+}
+
+static const JSCFunctionListEntry ijjs_allocator_funcs[] = {
+    JS_CFUNC_DEF("stats", 0, ijAllocatorStats),
+    JS_CFUNC_DEF("setDecay", 2, ijAllocatorDecay),
+    JS_CFUNC_DEF("backgroundThread", 1, ijAllocatorBackgroundThread),
+    JS_CFUNC_DEF("purge", 0, ijAllocatorPurge),
+};
+
+IJVoid ijModAllocatorInit(JSContext* ctx, JSModuleDef* m) {
+    JSValue obj = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, obj, ijjs_allocator_funcs, countof(ijjs_allocator_funcs));
+    JS_SetModuleExport(ctx, m, "allocator", obj);
+}
+
+IJVoid ijModAllocatorExport(JSContext* ctx, JSModuleDef* m) {
+    JS_AddModuleExport(ctx, m, "allocator");
+}
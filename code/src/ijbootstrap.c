@@ -88,23 +88,164 @@ error:
     return -1;
 }
 
+IJVoid ijStartupMark(IJJSRuntime* qrt, const IJAnsi* name, IJU64 start) {
+    if (qrt->startup.count == IJJS_STARTUP_ENTRIES)
+        return;
+    IJJSStartupEntry* entry = &qrt->startup.entries[qrt->startup.count++];
+    entry->name = name;
+    entry->start = start;
+    entry->duration = uv_hrtime() - start;
+}
+
+/* times every builtin module, they make up most of the startup time */
+static IJVoid ijBootstrapModule(JSContext* ctx, const IJAnsi* name, const IJU8* buf, IJU32 buf_len) {
+    IJU64 start = uv_hrtime();
+    CHECK_EQ(0, ijEvalBinary(ctx, buf, buf_len));
+    ijStartupMark(ijGetRuntime(ctx), name, start);
+}
+
+/* rarely used builtins are evaluated the first time one of their properties is read */
+typedef struct {
+    const IJAnsi* name;
+    const IJU8* buf;
+    const IJU32* buf_len;
+    IJBool on_ijjs;
+    const IJAnsi* props[8];
+} IJJSLazyModule;
+
+enum {
+    IJJS_LAZY_ENCODING = 0,
+    IJJS_LAZY_URL,
+    IJJS_LAZY_FETCH,
+    IJJS_LAZY_WASM,
+    IJJS_LAZY_GETOPTS,
+    IJJS_LAZY_HASHLIB,
+    IJJS_LAZY_PATH,
+    IJJS_LAZY_UUID,
+    IJJS_LAZY_COUNT
+};
+
+static const IJJSLazyModule ijjs_lazy_modules[IJJS_LAZY_COUNT] = {
+    { "encoding", encoding, &encoding_size, false, { "TextEncoder", "TextDecoder" } },
+    { "url", url, &url_size, false, { "URL", "URLSearchParams" } },
+    { "fetch", fetch, &fetch_size, false, { "fetch", "Headers", "Request", "Response" } },
+    { "wasm", wasm, &wasm_size, false, { "WebAssembly" } },
+    { "getopts", getopts, &getopts_size, true, { "getopts" } },
+    { "hashlib", hashlib, &hashlib_size, true, { "hash" } },
+    { "path", path, &path_size, true, { "basename", "dirname", "extname", "format", "isAbsolute", "join", "parse" } },
+    { "uuid", uuid, &uuid_size, true, { "uuidv1", "uuidv3", "uuidv4", "uuidv5" } },
+};
+
+static JSValue ijLazyTarget(JSContext* ctx, const IJJSLazyModule* mod) {
+    JSValue global_obj = JS_GetGlobalObject(ctx);
+    if (!mod->on_ijjs)
+        return global_obj;
+    JSValue obj = JS_GetPropertyStr(ctx, global_obj, "ijjs");
+    JS_FreeValue(ctx, global_obj);
+    return obj;
+}
+
+static IJS32 ijLazyLoad(JSContext* ctx, IJS32 idx) {
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    const IJJSLazyModule* mod = &ijjs_lazy_modules[idx];
+    JSValue saved[countof(mod->props)];
+    IJS32 r = 0;
+    if (qrt->startup.lazy_loaded & (1u << idx))
+        return 0;
+    qrt->startup.lazy_loaded |= 1u << idx;
+    JSValue target = ijLazyTarget(ctx, mod);
+    /* drop the remaining accessors, values assigned by the script meanwhile are kept */
+    for (IJS32 i = 0; i < countof(mod->props); i++) {
+        JSPropertyDescriptor desc;
+        saved[i] = JS_UNINITIALIZED;
+        if (!mod->props[i])
+            continue;
+        JSAtom atom = JS_NewAtom(ctx, mod->props[i]);
+        if (JS_GetOwnProperty(ctx, &desc, target, atom) > 0) {
+            if (desc.flags & JS_PROP_GETSET)
+                JS_DeleteProperty(ctx, target, atom, 0);
+            else
+                saved[i] = JS_DupValue(ctx, desc.value);
+            JS_FreeValue(ctx, desc.getter);
+            JS_FreeValue(ctx, desc.setter);
+            JS_FreeValue(ctx, desc.value);
+        }
+        JS_FreeAtom(ctx, atom);
+    }
+    /* the builtin may import internal modules like during the bootstrap */
+    IJBool in_bootstrap = qrt->in_bootstrap;
+    IJU64 start = uv_hrtime();
+    qrt->in_bootstrap = true;
+    r = ijEvalBinary(ctx, mod->buf, *mod->buf_len);
+    qrt->in_bootstrap = in_bootstrap;
+    ijStartupMark(qrt, mod->name, start);
+    for (IJS32 i = 0; i < countof(mod->props); i++) {
+        if (JS_IsUninitialized(saved[i]))
+            continue;
+        JS_DefinePropertyValueStr(ctx, target, mod->props[i], saved[i], JS_PROP_C_W_E);
+    }
+    JS_FreeValue(ctx, target);
+    return r;
+}
+
+static JSValue ijLazyGet(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv, IJS32 magic, JSValue* func_data) {
+    const IJJSLazyModule* mod = &ijjs_lazy_modules[magic];
+    if (ijLazyLoad(ctx, magic))
+        return JS_ThrowInternalError(ctx, "could not initialize the %s module", mod->name);
+    JSValue target = ijLazyTarget(ctx, mod);
+    JSAtom atom = JS_ValueToAtom(ctx, func_data[0]);
+    JSValue val = JS_GetProperty(ctx, target, atom);
+    JS_FreeAtom(ctx, atom);
+    JS_FreeValue(ctx, target);
+    return val;
+}
+
+static JSValue ijLazySet(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv, IJS32 magic, JSValue* func_data) {
+    JSValue target = ijLazyTarget(ctx, &ijjs_lazy_modules[magic]);
+    JSAtom atom = JS_ValueToAtom(ctx, func_data[0]);
+    /* overriding a lazy builtin does not need the module */
+    IJS32 r = JS_DefinePropertyValue(ctx, target, atom, JS_DupValue(ctx, argv[0]), JS_PROP_C_W_E);
+    JS_FreeAtom(ctx, atom);
+    JS_FreeValue(ctx, target);
+    return r < 0 ? JS_EXCEPTION : JS_UNDEFINED;
+}
+
+static IJVoid ijLazyInstall(JSContext* ctx, IJS32 idx) {
+    const IJJSLazyModule* mod = &ijjs_lazy_modules[idx];
+    JSValue target = ijLazyTarget(ctx, mod);
+    for (IJS32 i = 0; i < countof(mod->props) && mod->props[i]; i++) {
+        JSValue name = JS_NewString(ctx, mod->props[i]);
+        JSAtom atom = JS_NewAtom(ctx, mod->props[i]);
+        JSValue getter = JS_NewCFunctionData(ctx, ijLazyGet, 0, idx, 1, &name);
+        JSValue setter = JS_NewCFunctionData(ctx, ijLazySet, 1, idx, 1, &name);
+        CHECK_EQ(JS_DefineProperty(ctx, target, atom, JS_UNDEFINED, getter, setter,
+            JS_PROP_HAS_GET | JS_PROP_HAS_SET | JS_PROP_HAS_CONFIGURABLE | JS_PROP_CONFIGURABLE |
+            JS_PROP_HAS_ENUMERABLE | JS_PROP_ENUMERABLE), 1);
+        JS_FreeValue(ctx, getter);
+        JS_FreeValue(ctx, setter);
+        JS_FreeValue(ctx, name);
+        JS_FreeAtom(ctx, atom);
+    }
+    JS_FreeValue(ctx, target);
+}
+
 IJVoid ijBootstrapGlobals(JSContext* ctx) {
-    CHECK_EQ(0, ijEvalBinary(ctx, bootstrap, bootstrap_size));
-    CHECK_EQ(0, ijEvalBinary(ctx, encoding, encoding_size));
-    CHECK_EQ(0, ijEvalBinary(ctx, console, console_size));
-    CHECK_EQ(0, ijEvalBinary(ctx, crypto, crypto_size));
-    CHECK_EQ(0, ijEvalBinary(ctx, event_target, event_target_size));
-    CHECK_EQ(0, ijEvalBinary(ctx, performance, performance_size));
-    CHECK_EQ(0, ijEvalBinary(ctx, url, url_size));
-    CHECK_EQ(0, ijEvalBinary(ctx, fetch, fetch_size));
-    CHECK_EQ(0, ijEvalBinary(ctx, abort_controller, abort_controller_size));
-    CHECK_EQ(0, ijEvalBinary(ctx, wasm, wasm_size));
-    CHECK_EQ(0, ijEvalBinary(ctx, bootstrap2, bootstrap2_size));
+    ijBootstrapModule(ctx, "bootstrap", bootstrap, bootstrap_size);
+    ijLazyInstall(ctx, IJJS_LAZY_ENCODING);
+    ijBootstrapModule(ctx, "console", console, console_size);
+    ijBootstrapModule(ctx, "crypto", crypto, crypto_size);
+    ijBootstrapModule(ctx, "event-target", event_target, event_target_size);
+    ijBootstrapModule(ctx, "performance", performance, performance_size);
+    ijLazyInstall(ctx, IJJS_LAZY_URL);
+    ijLazyInstall(ctx, IJJS_LAZY_FETCH);
+    ijBootstrapModule(ctx, "abort-controller", abort_controller, abort_controller_size);
+    ijLazyInstall(ctx, IJJS_LAZY_WASM);
+    ijBootstrapModule(ctx, "bootstrap2", bootstrap2, bootstrap2_size);
 }
 
 IJVoid ijAddBuiltins(JSContext* ctx) {
-    CHECK_EQ(0, ijEvalBinary(ctx, getopts, getopts_size));
-    CHECK_EQ(0, ijEvalBinary(ctx, hashlib, hashlib_size));
-    CHECK_EQ(0, ijEvalBinary(ctx, path, path_size));
-    CHECK_EQ(0, ijEvalBinary(ctx, uuid, uuid_size));
+    ijLazyInstall(ctx, IJJS_LAZY_GETOPTS);
+    ijLazyInstall(ctx, IJJS_LAZY_HASHLIB);
+    ijLazyInstall(ctx, IJJS_LAZY_PATH);
+    ijLazyInstall(ctx, IJJS_LAZY_UUID);
 }
@@ -0,0 +1,525 @@
+/*
+ ijjs javascript runtime engine
+ Copyright (C) 2010-2017 Trix
+
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include "ijjs.h"
+#include <string.h>
+#if IJJS_PLATFORM != IJJS_PLATFORM_WIN32
+#include <sys/mman.h>
+#endif
+
+#define IJJS_BUNDLE_MAGIC 0x424a4a49
+
+/* bundles appended to an executable start on a boundary both mmap and MapViewOfFile accept */
+#define IJJS_BUNDLE_ALIGN 65536
+
+/* a bundle is this header, the engine version, the module table, the module names and the bytecode */
+typedef struct {
+    IJU32 magic;
+    IJU32 version_len;
+    IJU32 count;
+    IJU32 entry;
+} IJJSBundleHeader;
+
+/* offsets are from the start of the bundle */
+typedef struct {
+    IJU32 name_off;
+    IJU32 name_len;
+    IJU32 data_off;
+    IJU32 data_len;
+} IJJSBundleModule;
+
+/* the last bytes of an executable that carries a bundle */
+typedef struct {
+    IJU64 offset;
+    IJU64 size;
+    IJAnsi magic[8];
+} IJJSBundleTrailer;
+
+static const IJAnsi bundle__trailer_magic[8] = { 'I', 'J', 'J', 'S', 'B', 'N', 'D', 'L' };
+
+/* the bundle of the running executable, mapped once and shared by every runtime */
+static uv_once_t bundle__once = UV_ONCE_INIT;
+static const IJU8* bundle__data;
+static size_t bundle__size;
+static IJU64 bundle__offset;
+
+/* every module the module loader compiles while a bundle is being built */
+typedef struct IJJSBundleBuilder {
+    IJAnsi** names;
+    JSModuleDef** modules;
+    IJU32 count;
+    IJU32 size;
+    /* entry scripts named by new Worker('...') in the compiled sources */
+    IJAnsi** workers;
+    IJU32 worker_count;
+    IJU32 worker_size;
+} IJJSBundleBuilder;
+
+/* bytecode only runs on the engine that wrote it, JS_ReadObject checks the bytecode version too */
+static const IJAnsi* ijBundleVersion(IJVoid) {
+    static IJAnsi version[64];
+    if (!version[0])
+        snprintf(version, sizeof(version), "%s/%s", ijVersion(), QJS_VERSION_STR);
+    return version;
+}
+
+static IJVoid ijBundleModuleAt(const IJU8* data, IJU32 index, IJJSBundleModule* mod) {
+    memcpy(mod, data + sizeof(IJJSBundleHeader) + ((IJJSBundleHeader*)data)->version_len + index * sizeof(*mod), sizeof(*mod));
+}
+
+IJBool ijBundleDetect(const IJU8* buf, size_t len) {
+    IJU32 magic;
+    if (len < sizeof(IJJSBundleHeader))
+        return FALSE;
+    memcpy(&magic, buf, sizeof(magic));
+    return magic == IJJS_BUNDLE_MAGIC;
+}
+
+static IJS32 ijBundleValidate(JSContext* ctx, const IJU8* data, size_t size) {
+    const IJAnsi* version = ijBundleVersion();
+    IJJSBundleHeader hdr;
+    IJJSBundleModule mod;
+    if (!ijBundleDetect(data, size))
+        goto invalid;
+    memcpy(&hdr, data, sizeof(hdr));
+    if (size < sizeof(hdr) + hdr.version_len || hdr.count == 0 || hdr.entry >= hdr.count)
+        goto invalid;
+    if (hdr.version_len != strlen(version) || memcmp(data + sizeof(hdr), version, hdr.version_len) != 0) {
+        JS_ThrowRangeError(ctx, "bundle was not built by ijjs %s", version);
+        return -1;
+    }
+    if ((size - sizeof(hdr) - hdr.version_len) / sizeof(mod) < hdr.count)
+        goto invalid;
+    for (IJU32 i = 0; i < hdr.count; i++) {
+        ijBundleModuleAt(data, i, &mod);
+        if (mod.name_off > size || size - mod.name_off <= mod.name_len || data[mod.name_off + mod.name_len] != '\0')
+            goto invalid;
+        if (mod.data_off > size || size - mod.data_off < mod.data_len)
+            goto invalid;
+    }
+    return 0;
+invalid:
+    JS_ThrowTypeError(ctx, "invalid bundle");
+    return -1;
+}
+
+static JSValue ijBundleReadModule(JSContext* ctx, IJU32 index) {
+    const IJU8* data = ijGetRuntime(ctx)->bundle.data;
+    IJJSBundleModule mod;
+    ijBundleModuleAt(data, index, &mod);
+    JSValue obj = JS_ReadObject(ctx, data + mod.data_off, mod.data_len, JS_READ_OBJ_BYTECODE);
+    if (JS_IsException(obj))
+        return obj;
+    /* json modules are stored as their value */
+    if (JS_VALUE_GET_TAG(obj) != JS_TAG_MODULE && has_suffix((const IJAnsi*)data + mod.name_off, ".json")) {
+        JSModuleDef* m = ijModuleNewJson(ctx, (const IJAnsi*)data + mod.name_off, obj);
+        return m ? JS_DupValue(ctx, JS_MKPTR(JS_TAG_MODULE, m)) : JS_EXCEPTION;
+    }
+    if (JS_VALUE_GET_TAG(obj) != JS_TAG_MODULE) {
+        JS_FreeValue(ctx, obj);
+        return JS_ThrowTypeError(ctx, "invalid bundle");
+    }
+    return obj;
+}
+
+IJS32 ijBundleAttach(JSContext* ctx, const IJU8* data, size_t size, IJBool owned) {
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    if (qrt->bundle.data) {
+        JS_ThrowTypeError(ctx, "a bundle is already loaded");
+        return -1;
+    }
+    if (ijBundleValidate(ctx, data, size) < 0)
+        return -1;
+    /* modules are read the first time they are imported, so the bundle stays around */
+    qrt->bundle.data = data;
+    qrt->bundle.size = size;
+    qrt->bundle.owned = owned;
+    return 0;
+}
+
+JSValue ijBundleEntry(JSContext* ctx) {
+    const IJU8* data = ijGetRuntime(ctx)->bundle.data;
+    IJJSBundleHeader hdr;
+    if (!data)
+        return JS_ThrowTypeError(ctx, "no bundle is loaded");
+    memcpy(&hdr, data, sizeof(hdr));
+    JSValue obj = ijBundleReadModule(ctx, hdr.entry);
+    if (JS_IsException(obj))
+        return obj;
+    if (JS_ResolveModule(ctx, obj) < 0)
+        return JS_EXCEPTION;
+    return obj;
+}
+
+static IJVoid ijBundleMapExecutable(IJVoid) {
+    IJAnsi path[PATH_MAX];
+    size_t len = sizeof(path);
+    IJJSBundleTrailer trailer;
+    uv_fs_t req;
+    if (uv_exepath(path, &len) != 0)
+        return;
+    IJS32 fd = uv_fs_open(NULL, &req, path, O_RDONLY, 0, NULL);
+    uv_fs_req_cleanup(&req);
+    if (fd < 0)
+        return;
+    IJS32 r = uv_fs_fstat(NULL, &req, fd, NULL);
+    IJU64 file_size = req.statbuf.st_size;
+    uv_fs_req_cleanup(&req);
+    if (r != 0 || file_size < sizeof(trailer))
+        goto done;
+    uv_buf_t buf = uv_buf_init((IJAnsi*)&trailer, sizeof(trailer));
+    r = uv_fs_read(NULL, &req, fd, &buf, 1, file_size - sizeof(trailer), NULL);
+    uv_fs_req_cleanup(&req);
+    if (r != sizeof(trailer) || memcmp(trailer.magic, bundle__trailer_magic, sizeof(trailer.magic)) != 0)
+        goto done;
+    if (trailer.offset % IJJS_BUNDLE_ALIGN != 0 || trailer.offset + trailer.size + sizeof(trailer) != file_size)
+        goto done;
+    /* read only and never unmapped, modules are read from it for the life of the process */
+#if IJJS_PLATFORM == IJJS_PLATFORM_WIN32
+    HANDLE mapping = CreateFileMappingA((HANDLE)uv_get_osfhandle(fd), NULL, PAGE_READONLY, 0, 0, NULL);
+    if (!mapping)
+        goto done;
+    IJVoid* data = MapViewOfFile(mapping, FILE_MAP_READ, (DWORD)(trailer.offset >> 32), (DWORD)trailer.offset, (SIZE_T)trailer.size);
+    CloseHandle(mapping);
+    if (!data)
+        goto done;
+#else
+    IJVoid* data = mmap(NULL, trailer.size, PROT_READ, MAP_PRIVATE, fd, (off_t)trailer.offset);
+    if (data == MAP_FAILED)
+        goto done;
+#endif
+    bundle__data = data;
+    bundle__size = trailer.size;
+    bundle__offset = trailer.offset;
+done:
+    uv_fs_close(NULL, &req, fd, NULL);
+    uv_fs_req_cleanup(&req);
+}
+
+const IJU8* ijBundleEmbedded(size_t* size) {
+    uv_once(&bundle__once, ijBundleMapExecutable);
+    *size = bundle__size;
+    return bundle__data;
+}
+
+IJS32 ijBundleFind(IJJSRuntime* qrt, const IJAnsi* module_name) {
+    const IJU8* data = qrt->bundle.data;
+    IJJSBundleHeader hdr;
+    IJJSBundleModule mod;
+    if (!data)
+        return -1;
+    memcpy(&hdr, data, sizeof(hdr));
+    for (IJU32 i = 0; i < hdr.count; i++) {
+        ijBundleModuleAt(data, i, &mod);
+        if (strcmp((const IJAnsi*)data + mod.name_off, module_name) == 0)
+            return (IJS32)i;
+    }
+    return -1;
+}
+
+JSValue ijBundleLoadModule(JSContext* ctx, const IJAnsi* module_name) {
+    IJS32 index = ijBundleFind(ijGetRuntime(ctx), module_name);
+    if (index < 0)
+        return JS_UNDEFINED;
+    JSValue obj = ijBundleReadModule(ctx, (IJU32)index);
+    if (!JS_IsException(obj) && ijModuleSetImportMeta(ctx, obj, FALSE, FALSE) < 0)
+        return JS_EXCEPTION;
+    return obj;
+}
+
+IJVoid ijBundleClose(IJJSRuntime* qrt) {
+    if (qrt->bundle.owned)
+        free((IJVoid*)qrt->bundle.data);
+    qrt->bundle.data = NULL;
+    qrt->bundle.size = 0;
+}
+
+IJS32 ijBundleAdd(JSContext* ctx, const IJAnsi* module_name, JSModuleDef* m, IJBool native) {
+    IJJSBundleBuilder* b = ijGetRuntime(ctx)->bundle.builder;
+    if (!b)
+        return 0;
+    if (native) {
+        JS_ThrowTypeError(ctx, "native module '%s' cannot be bundled", module_name);
+        return -1;
+    }
+    if (b->count == b->size) {
+        IJU32 size = b->size ? b->size * 2 : 16;
+        IJAnsi** names = js_realloc(ctx, b->names, size * sizeof(*names));
+        if (!names)
+            return -1;
+        b->names = names;
+        JSModuleDef** modules = js_realloc(ctx, b->modules, size * sizeof(*modules));
+        if (!modules)
+            return -1;
+        b->modules = modules;
+        b->size = size;
+    }
+    b->names[b->count] = js_strdup(ctx, module_name);
+    if (!b->names[b->count])
+        return -1;
+    b->modules[b->count++] = m;
+    return 0;
+}
+
+static IJBool ijBundleHasWorker(IJJSBundleBuilder* b, const IJAnsi* name) {
+    for (IJU32 i = 0; i < b->worker_count; i++) {
+        if (!strcmp(b->workers[i], name))
+            return TRUE;
+    }
+    return FALSE;
+}
+
+static IJBool ijBundleHasModule(IJJSBundleBuilder* b, const IJAnsi* name) {
+    for (IJU32 i = 0; i < b->count; i++) {
+        if (!strcmp(b->names[i], name))
+            return TRUE;
+    }
+    return FALSE;
+}
+
+/* only string literals are found, a worker path computed at run time has to be shipped next to the executable */
+IJS32 ijBundleScanWorkers(JSContext* ctx, const IJAnsi* source, size_t len) {
+    IJJSBundleBuilder* b = ijGetRuntime(ctx)->bundle.builder;
+    static const IJAnsi pattern[] = "new Worker(";
+    const IJAnsi* end = source + len;
+    if (!b)
+        return 0;
+    for (const IJAnsi* p = source; p + sizeof(pattern) - 1 < end; p++) {
+        if (memcmp(p, pattern, sizeof(pattern) - 1))
+            continue;
+        const IJAnsi* s = p + sizeof(pattern) - 1;
+        while (s < end && (*s == ' ' || *s == '\t' || *s == '\r' || *s == '\n'))
+            s++;
+        if (s == end || (*s != '\'' && *s != '"' && *s != '`'))
+            continue;
+        IJAnsi quote = *s++;
+        const IJAnsi* e = s;
+        while (e < end && *e != quote && *e != '\\' && *e != '\n' && !(*e == '$' && quote == '`'))
+            e++;
+        if (e == end || *e != quote || e == s)
+            continue;
+        IJAnsi* name = js_strndup(ctx, s, e - s);
+        if (!name)
+            return -1;
+        if (ijBundleHasWorker(b, name)) {
+            js_free(ctx, name);
+            continue;
+        }
+        if (b->worker_count == b->worker_size) {
+            IJU32 size = b->worker_size ? b->worker_size * 2 : 4;
+            IJAnsi** workers = js_realloc(ctx, b->workers, size * sizeof(*workers));
+            if (!workers) {
+                js_free(ctx, name);
+                return -1;
+            }
+            b->workers = workers;
+            b->worker_size = size;
+        }
+        b->workers[b->worker_count++] = name;
+    }
+    return 0;
+}
+
+/* compiles the file as a module, the module loader adds its imports to the builder */
+static JSValue ijBundleCompileFile(JSContext* ctx, const IJAnsi* filename) {
+    DynBuf dbuf;
+    dbuf_init(&dbuf);
+    if (ijLoadFile(ctx, &dbuf, filename) != 0) {
+        dbuf_free(&dbuf);
+        return JS_ThrowReferenceError(ctx, "could not load '%s'", filename);
+    }
+    dbuf_putc(&dbuf, '\0');
+    JSValue module = JS_UNDEFINED;
+    if (ijBundleScanWorkers(ctx, (const IJAnsi*)dbuf.buf, dbuf.size - 1) < 0)
+        module = JS_EXCEPTION;
+    else
+        module = JS_Eval(ctx, (IJAnsi*)dbuf.buf, dbuf.size - 1, filename, JS_EVAL_TYPE_MODULE | JS_EVAL_FLAG_COMPILE_ONLY);
+    dbuf_free(&dbuf);
+    return module;
+}
+
+static IJS32 ijBundleWrite(JSContext* ctx, IJJSBundleBuilder* b, DynBuf* out, IJS32 flags) {
+    const IJAnsi* version = ijBundleVersion();
+    IJJSBundleHeader hdr = {
+        .magic = IJJS_BUNDLE_MAGIC,
+        .version_len = (IJU32)strlen(version),
+        .count = b->count,
+        .entry = b->count - 1
+    };
+    DynBuf names, code;
+    IJS32 r = -1;
+    IJJSBundleModule* table = js_mallocz(ctx, b->count * sizeof(*table));
+    if (!table)
+        return -1;
+    dbuf_init(&names);
+    dbuf_init(&code);
+    for (IJU32 i = 0; i < b->count; i++) {
+        size_t len;
+        JSValue value = ijModuleJsonValue(ctx, b->modules[i]);
+        IJU8* bc;
+        if (JS_IsUndefined(value))
+            bc = JS_WriteObject(ctx, &len, JS_MKPTR(JS_TAG_MODULE, b->modules[i]), flags);
+        else
+            bc = JS_WriteObject(ctx, &len, value, flags);
+        JS_FreeValue(ctx, value);
+        if (!bc)
+            goto done;
+        table[i].name_off = (IJU32)names.size;
+        table[i].name_len = (IJU32)strlen(b->names[i]);
+        table[i].data_off = (IJU32)code.size;
+        table[i].data_len = (IJU32)len;
+        dbuf_put(&names, (const IJU8*)b->names[i], table[i].name_len + 1);
+        dbuf_put(&code, bc, len);
+        js_free(ctx, bc);
+    }
+    size_t base = sizeof(hdr) + hdr.version_len + b->count * sizeof(*table);
+    for (IJU32 i = 0; i < b->count; i++) {
+        table[i].name_off += (IJU32)base;
+        table[i].data_off += (IJU32)(base + names.size);
+    }
+    dbuf_put(out, (const IJU8*)&hdr, sizeof(hdr));
+    dbuf_put(out, (const IJU8*)version, hdr.version_len);
+    dbuf_put(out, (const IJU8*)table, b->count * sizeof(*table));
+    dbuf_put(out, names.buf, names.size);
+    dbuf_put(out, code.buf, code.size);
+    r = 0;
+done:
+    dbuf_free(&names);
+    dbuf_free(&code);
+    js_free(ctx, table);
+    return r;
+}
+
+/* a copy of this executable with the bundle and a trailer appended, ijBundleEmbedded() finds it at startup */
+static IJS32 ijBundleSaveExecutable(const IJAnsi* output, const DynBuf* bundle) {
+    static const IJU8 zeros[IJJS_BUNDLE_ALIGN];
+    IJAnsi path[PATH_MAX];
+    size_t len = sizeof(path);
+    size_t embedded_size;
+    uv_fs_t req;
+    IJS32 r = uv_exepath(path, &len);
+    if (r != 0)
+        return r;
+    r = uv_fs_copyfile(NULL, &req, path, output, 0, NULL);
+    uv_fs_req_cleanup(&req);
+    if (r != 0)
+        return r;
+    IJS32 fd = uv_fs_open(NULL, &req, output, O_WRONLY, 0, NULL);
+    uv_fs_req_cleanup(&req);
+    if (fd < 0)
+        return fd;
+    r = uv_fs_fstat(NULL, &req, fd, NULL);
+    IJU64 offset = req.statbuf.st_size;
+    uv_fs_req_cleanup(&req);
+    if (r != 0)
+        goto done;
+    /* packaging from a packaged executable replaces its bundle */
+    if (ijBundleEmbedded(&embedded_size)) {
+        offset = bundle__offset;
+        r = uv_fs_ftruncate(NULL, &req, fd, offset, NULL);
+        uv_fs_req_cleanup(&req);
+        if (r != 0)
+            goto done;
+    }
+    IJU32 pad = (IJU32)((IJJS_BUNDLE_ALIGN - offset % IJJS_BUNDLE_ALIGN) % IJJS_BUNDLE_ALIGN);
+    IJJSBundleTrailer trailer = { .offset = offset + pad, .size = bundle->size };
+    memcpy(trailer.magic, bundle__trailer_magic, sizeof(trailer.magic));
+    uv_buf_t bufs[3] = {
+        uv_buf_init((IJAnsi*)zeros, pad),
+        uv_buf_init((IJAnsi*)bundle->buf, (IJU32)bundle->size),
+        uv_buf_init((IJAnsi*)&trailer, sizeof(trailer))
+    };
+    r = uv_fs_write(NULL, &req, fd, bufs, countof(bufs), offset, NULL);
+    uv_fs_req_cleanup(&req);
+    if (r >= 0)
+        r = r == (IJS32)(pad + bundle->size + sizeof(trailer)) ? 0 : UV_EIO;
+    if (r == 0) {
+        r = uv_fs_fchmod(NULL, &req, fd, 0755, NULL);
+        uv_fs_req_cleanup(&req);
+    }
+done:
+    uv_fs_close(NULL, &req, fd, NULL);
+    uv_fs_req_cleanup(&req);
+    return r;
+}
+
+static IJS32 ijBundleSave(const IJAnsi* output, const DynBuf* bundle) {
+    uv_fs_t req;
+    IJS32 fd = uv_fs_open(NULL, &req, output, O_WRONLY | O_CREAT | O_TRUNC, 0644, NULL);
+    uv_fs_req_cleanup(&req);
+    if (fd < 0)
+        return fd;
+    uv_buf_t buf = uv_buf_init((IJAnsi*)bundle->buf, (IJU32)bundle->size);
+    IJS32 r = uv_fs_write(NULL, &req, fd, &buf, 1, 0, NULL);
+    uv_fs_req_cleanup(&req);
+    uv_fs_close(NULL, &req, fd, NULL);
+    uv_fs_req_cleanup(&req);
+    return r < 0 ? r : 0;
+}
+
+IJS32 ijBundleCompile(JSContext* ctx, const IJAnsi* filename, const IJAnsi* output, IJBool strip_debug, IJBool executable) {
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    IJJSBundleBuilder b = { 0 };
+    DynBuf out;
+    IJS32 r = -1;
+    /* compiling resolves the imports, the module loader adds each of them to the builder */
+    qrt->bundle.builder = &b;
+    JSValue module = ijBundleCompileFile(ctx, filename);
+    /* worker entry scripts are evaluated by name in the worker, their own workers are found as they compile */
+    for (IJU32 i = 0; i < b.worker_count && !JS_IsException(module); i++) {
+        if (ijBundleHasModule(&b, b.workers[i]) || !strcmp(b.workers[i], filename))
+            continue;
+        JSValue worker = ijBundleCompileFile(ctx, b.workers[i]);
+        if (JS_IsException(worker) || ijBundleAdd(ctx, b.workers[i], JS_VALUE_GET_PTR(worker), FALSE) < 0) {
+            JS_FreeValue(ctx, module);
+            module = JS_EXCEPTION;
+        }
+        JS_FreeValue(ctx, worker);
+    }
+    qrt->bundle.builder = NULL;
+    if (JS_IsException(module))
+        goto done;
+    /* the entry goes last, it is the only module evaluated directly */
+    qrt->bundle.builder = &b;
+    r = ijBundleAdd(ctx, filename, JS_VALUE_GET_PTR(module), FALSE);
+    qrt->bundle.builder = NULL;
+    JS_FreeValue(ctx, module);
+    dbuf_init(&out);
+    if (r == 0)
+        r = ijBundleWrite(ctx, &b, &out, JS_WRITE_OBJ_BYTECODE | (strip_debug ? JS_WRITE_OBJ_STRIP_DEBUG : 0));
+    if (r == 0) {
+        r = executable ? ijBundleSaveExecutable(output, &out) : ijBundleSave(output, &out);
+        if (r != 0) {
+            ijThrowErrno(ctx, r);
+            r = -1;
+        }
+    }
+    dbuf_free(&out);
+done:
+    for (IJU32 i = 0; i < b.count; i++)
+        js_free(ctx, b.names[i]);
+    js_free(ctx, b.names);
+    js_free(ctx, b.modules);
+    for (IJU32 i = 0; i < b.worker_count; i++)
+        js_free(ctx, b.workers[i]);
+    js_free(ctx, b.workers);
+    return r;
+}
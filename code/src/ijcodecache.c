@@ -0,0 +1,197 @@
+/*
+ ijjs javascript runtime engine
+ Copyright (C) 2010-2017 Trix
+
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include "ijjs.h"
+#include <string.h>
+
+#define IJJS_CODE_CACHE_MAGIC 0x43424a49
+
+/* an entry is this header, the module name, the engine version and the bytecode */
+typedef struct {
+    IJU32 magic;
+    IJU32 name_len;
+    IJU32 version_len;
+    IJU32 reserved;
+    IJS64 mtime_sec;
+    IJS64 mtime_nsec;
+    IJU64 size;
+    IJU64 hash;
+} IJJSCodeCacheHeader;
+
+/* bytecode is only valid for the binary that wrote it, the build time covers local engine changes */
+static const IJAnsi* ijCodeCacheVersion(IJVoid) {
+    static IJAnsi version[128];
+    if (!version[0])
+        snprintf(version, sizeof(version), "%s/%s %s %s", ijVersion(), QJS_VERSION_STR, __DATE__, __TIME__);
+    return version;
+}
+
+/* FNV-1a */
+static IJU64 ijCodeCacheHash(const IJU8* buf, size_t len) {
+    IJU64 h = 14695981039346656037ULL;
+    for (size_t i = 0; i < len; i++) {
+        h ^= buf[i];
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+static IJVoid ijCodeCachePath(IJAnsi* buf, size_t size, const IJAnsi* dir, const IJAnsi* filename) {
+    IJU64 h = ijCodeCacheHash((const IJU8*)filename, strlen(filename));
+    snprintf(buf, size, "%s/%016llx.jsc", dir, (unsigned long long)h);
+}
+
+static IJS32 ijCodeCacheStat(const IJAnsi* filename, uv_stat_t* st) {
+    uv_fs_t req;
+    IJS32 r = uv_fs_stat(NULL, &req, filename, NULL);
+    if (r == 0)
+        memcpy(st, &req.statbuf, sizeof(*st));
+    uv_fs_req_cleanup(&req);
+    return r;
+}
+
+JSValue ijCodeCacheLoad(JSContext* ctx, const IJAnsi* filename, DynBuf* source) {
+    const IJAnsi* dir = ijGetRuntime(ctx)->options.code_cache_dir;
+    const IJAnsi* version = ijCodeCacheVersion();
+    IJAnsi path[PATH_MAX];
+    IJJSCodeCacheHeader hdr;
+    uv_stat_t st;
+    DynBuf entry;
+    JSValue obj = JS_UNDEFINED;
+    if (!dir || ijCodeCacheStat(filename, &st) != 0)
+        return JS_UNDEFINED;
+    ijCodeCachePath(path, sizeof(path), dir, filename);
+    dbuf_init(&entry);
+    if (ijLoadFile(ctx, &entry, path) != 0 || entry.size < sizeof(hdr))
+        goto done;
+    memcpy(&hdr, entry.buf, sizeof(hdr));
+    if (hdr.magic != IJJS_CODE_CACHE_MAGIC || entry.size < sizeof(hdr) + hdr.name_len + hdr.version_len)
+        goto done;
+    const IJAnsi* p = (const IJAnsi*)entry.buf + sizeof(hdr);
+    if (hdr.name_len != strlen(filename) || memcmp(p, filename, hdr.name_len) != 0)
+        goto done;
+    p += hdr.name_len;
+    if (hdr.version_len != strlen(version) || memcmp(p, version, hdr.version_len) != 0)
+        goto done;
+    p += hdr.version_len;
+    if (hdr.size != st.st_size)
+        goto done;
+    if (hdr.mtime_sec != st.st_mtim.tv_sec || hdr.mtime_nsec != st.st_mtim.tv_nsec) {
+        /* copied or touched, e.g. a cache shipped with the app: compare the contents instead */
+        if (source->size == 0 && ijLoadFile(ctx, source, filename) != 0)
+            goto done;
+        if (source->size < hdr.size || ijCodeCacheHash(source->buf, hdr.size) != hdr.hash)
+            goto done;
+    }
+    obj = JS_ReadObject(ctx, (const IJU8*)p, entry.size - ((const IJU8*)p - entry.buf), JS_READ_OBJ_BYTECODE);
+    if (JS_IsException(obj)) {
+        /* a stale or corrupted entry is a miss, the module is compiled again */
+        JS_FreeValue(ctx, JS_GetException(ctx));
+        obj = JS_UNDEFINED;
+    } else if (JS_VALUE_GET_TAG(obj) != JS_TAG_MODULE) {
+        JS_FreeValue(ctx, obj);
+        obj = JS_UNDEFINED;
+    }
+done:
+    dbuf_free(&entry);
+    return obj;
+}
+
+IJVoid ijCodeCacheStore(JSContext* ctx, const IJAnsi* filename, JSValueConst module, const DynBuf* source) {
+    const IJAnsi* dir = ijGetRuntime(ctx)->options.code_cache_dir;
+    const IJAnsi* version = ijCodeCacheVersion();
+    IJAnsi path[PATH_MAX];
+    IJAnsi tmp[PATH_MAX + 32];
+    IJJSCodeCacheHeader hdr;
+    uv_stat_t st;
+    uv_fs_t req;
+    size_t len;
+    /* the file changed while it was being read */
+    if (!dir || ijCodeCacheStat(filename, &st) != 0 || st.st_size > source->size)
+        return;
+    IJU8* bc = JS_WriteObject(ctx, &len, module, JS_WRITE_OBJ_BYTECODE);
+    if (!bc) {
+        JS_FreeValue(ctx, JS_GetException(ctx));
+        return;
+    }
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.magic = IJJS_CODE_CACHE_MAGIC;
+    hdr.name_len = (IJU32)strlen(filename);
+    hdr.version_len = (IJU32)strlen(version);
+    hdr.mtime_sec = st.st_mtim.tv_sec;
+    hdr.mtime_nsec = st.st_mtim.tv_nsec;
+    hdr.size = st.st_size;
+    hdr.hash = ijCodeCacheHash(source->buf, st.st_size);
+    uv_fs_mkdir(NULL, &req, dir, 0755, NULL);
+    uv_fs_req_cleanup(&req);
+    ijCodeCachePath(path, sizeof(path), dir, filename);
+    /* written next to the entry and renamed, so other processes never read half of it */
+    snprintf(tmp, sizeof(tmp), "%s.%d.tmp", path, (IJS32)uv_os_getpid());
+    IJS32 fd = uv_fs_open(NULL, &req, tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644, NULL);
+    uv_fs_req_cleanup(&req);
+    if (fd < 0)
+        goto done;
+    uv_buf_t bufs[4] = {
+        uv_buf_init((IJAnsi*)&hdr, sizeof(hdr)),
+        uv_buf_init((IJAnsi*)filename, hdr.name_len),
+        uv_buf_init((IJAnsi*)version, hdr.version_len),
+        uv_buf_init((IJAnsi*)bc, (IJU32)len)
+    };
+    IJS32 r = uv_fs_write(NULL, &req, fd, bufs, countof(bufs), 0, NULL);
+    uv_fs_req_cleanup(&req);
+    uv_fs_close(NULL, &req, fd, NULL);
+    uv_fs_req_cleanup(&req);
+    if (r == (IJS32)(sizeof(hdr) + hdr.name_len + hdr.version_len + len))
+        r = uv_fs_rename(NULL, &req, tmp, path, NULL);
+    else
+        r = -1;
+    uv_fs_req_cleanup(&req);
+    if (r != 0) {
+        uv_fs_unlink(NULL, &req, tmp, NULL);
+        uv_fs_req_cleanup(&req);
+    }
+done:
+    js_free(ctx, bc);
+}
+
+IJS32 ijCodeCacheBuild(JSContext* ctx, const IJAnsi* filename) {
+    DynBuf dbuf;
+    dbuf_init(&dbuf);
+    JSValue module = ijCodeCacheLoad(ctx, filename, &dbuf);
+    if (JS_IsUndefined(module)) {
+        if (dbuf.size == 0 && ijLoadFile(ctx, &dbuf, filename) != 0) {
+            dbuf_free(&dbuf);
+            JS_ThrowReferenceError(ctx, "could not load '%s'", filename);
+            return -1;
+        }
+        dbuf_putc(&dbuf, '\0');
+        module = JS_Eval(ctx, (IJAnsi*)dbuf.buf, dbuf.size - 1, filename, JS_EVAL_TYPE_MODULE | JS_EVAL_FLAG_COMPILE_ONLY);
+        if (!JS_IsException(module))
+            ijCodeCacheStore(ctx, filename, module, &dbuf);
+    }
+    dbuf_free(&dbuf);
+    if (JS_IsException(module))
+        return -1;
+    /* resolving goes through the module loader, which caches every static import */
+    IJS32 r = JS_ResolveModule(ctx, module);
+    JS_FreeValue(ctx, module);
+    return r;
+}
@@ -0,0 +1,532 @@
+/*
+ ijjs javascript runtime engine
+ Copyright (C) 2010-2017 Trix
+
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include "ijjs.h"
+#include <ctype.h>
+#include <string.h>
+#include <time.h>
+#if IJJS_PLATFORM == IJJS_PLATFORM_WIN32
+#define strncasecmp _strnicmp
+#endif
+
+#define IJJS_CRON_MAX_DELAY 60000
+
+typedef struct {
+    IJU64 second;
+    IJU64 minute;
+    IJU32 hour;
+    IJU32 dom;
+    IJU32 month;
+    IJU32 dow;
+    IJBool dom_any;
+    IJBool dow_any;
+} IJJSCronExpr;
+
+typedef struct IJJSCronJob {
+    JSContext* ctx;
+    IJJSCronExpr expr;
+    IJBool utc;
+    IJS32 offset;
+    IJS64 next;
+    IJS32 heap_idx;
+    JSValue obj;
+    JSValue func;
+} IJJSCronJob;
+
+static const IJAnsi* cron_months[] = { "january", "february", "march", "april", "may", "june", "july", "august", "september", "october", "november", "december" };
+static const IJAnsi* cron_days[] = { "sunday", "monday", "tuesday", "wednesday", "thursday", "friday", "saturday" };
+static const IJAnsi* cron_fields[] = { "second", "minute", "hour", "day of month", "month", "week day" };
+static const IJS32 cron_min[] = { 0, 0, 0, 1, 1, 0 };
+static const IJS32 cron_max[] = { 59, 59, 23, 31, 12, 7 };
+
+static IJS32 ijCronParseName(const IJAnsi* s, size_t len, IJS32 field) {
+    const IJAnsi** names = field == 4 ? cron_months : cron_days;
+    IJS32 count = field == 4 ? 12 : 7;
+    if (len < 3)
+        return -1;
+    for (IJS32 i = 0; i < count; i++) {
+        size_t n = strlen(names[i]);
+        if ((len == 3 || len == n) && strncasecmp(s, names[i], len) == 0)
+            return field == 4 ? i + 1 : i;
+    }
+    return -1;
+}
+
+static IJS32 ijCronParseValue(const IJAnsi** p, const IJAnsi* end, IJS32 field) {
+    const IJAnsi* s = *p;
+    IJS32 v = 0;
+    if (s < end && isdigit((IJU8)*s)) {
+        while (s < end && isdigit((IJU8)*s) && v < 1000)
+            v = v * 10 + (*s++ - '0');
+    }
+    else if (field >= 4) {
+        while (s < end && isalpha((IJU8)*s))
+            s++;
+        v = ijCronParseName(*p, s - *p, field);
+    }
+    else
+        v = -1;
+    if (s == *p)
+        return -1;
+    *p = s;
+    return v;
+}
+
+/* a field is a comma separated list of '*', 'a' or 'a-b', each optionally followed by '/step' */
+static IJS32 ijCronParseField(const IJAnsi* s, const IJAnsi* end, IJS32 field, IJU64* mask) {
+    IJS32 min = cron_min[field], max = cron_max[field];
+    *mask = 0;
+    while (s < end) {
+        IJS32 lo, hi, step = 0;
+        if (*s == '*') {
+            lo = min;
+            hi = max;
+            s++;
+        }
+        else {
+            lo = hi = ijCronParseValue(&s, end, field);
+            if (lo < 0)
+                return -1;
+            if (s < end && *s == '-') {
+                s++;
+                hi = ijCronParseValue(&s, end, field);
+                if (hi < 0)
+                    return -1;
+            }
+        }
+        if (s < end && *s == '/') {
+            s++;
+            if (s == end || !isdigit((IJU8)*s))
+                return -1;
+            step = ijCronParseValue(&s, end, 0);
+            if (step <= 0)
+                return -1;
+        }
+        if (s < end && *s++ != ',')
+            return -1;
+        if (lo > hi) {
+            IJS32 t = lo;
+            lo = hi;
+            hi = t;
+        }
+        if (lo < min || hi > max)
+            return -1;
+        /* steps select the multiples of step, as the JS implementation always did */
+        for (IJS32 v = lo; v <= hi; v++) {
+            if (!step || v % step == 0)
+                *mask |= 1ULL << v;
+        }
+    }
+    if (field == 5 && (*mask & (1ULL << 7)))
+        *mask = (*mask | 1) & 0x7f;
+    return *mask ? 0 : -1;
+}
+
+static JSValue ijCronParse(JSContext* ctx, const IJAnsi* str, IJJSCronExpr* e, IJBool throw) {
+    const IJAnsi* fields[6][2];
+    IJS32 n = 0;
+    const IJAnsi* s = str;
+    while (*s) {
+        while (*s == ' ' || *s == '\t')
+            s++;
+        if (!*s)
+            break;
+        if (n == 6)
+            return throw ? JS_ThrowSyntaxError(ctx, "%s is a invalid cron expression", str) : JS_EXCEPTION;
+        fields[n][0] = s;
+        while (*s && *s != ' ' && *s != '\t')
+            s++;
+        fields[n++][1] = s;
+    }
+    if (n < 5)
+        return throw ? JS_ThrowSyntaxError(ctx, "%s is a invalid cron expression", str) : JS_EXCEPTION;
+    IJU64 masks[6];
+    IJS32 first = n == 5 ? 1 : 0;
+    masks[0] = 1;
+    for (IJS32 i = first; i < 6; i++) {
+        const IJAnsi* b = fields[i - first][0];
+        const IJAnsi* end = fields[i - first][1];
+        if (ijCronParseField(b, end, i, &masks[i]) != 0)
+            return throw ? JS_ThrowSyntaxError(ctx, "%.*s is a invalid expression for %s", (IJS32)(end - b), b, cron_fields[i]) : JS_EXCEPTION;
+    }
+    e->second = masks[0];
+    e->minute = masks[1];
+    e->hour = (IJU32)masks[2];
+    e->dom = (IJU32)masks[3];
+    e->month = (IJU32)masks[4];
+    e->dow = (IJU32)masks[5];
+    e->dom_any = fields[3 - first][1] - fields[3 - first][0] == 1 && *fields[3 - first][0] == '*';
+    e->dow_any = fields[5 - first][1] - fields[5 - first][0] == 1 && *fields[5 - first][0] == '*';
+    return JS_UNDEFINED;
+}
+
+static IJS64 ijCronDaysFromCivil(IJS64 y, IJS32 m, IJS32 d) {
+    y -= m <= 2;
+    IJS64 era = (y >= 0 ? y : y - 399) / 400;
+    IJS64 yoe = y - era * 400;
+    IJS64 doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    IJS64 doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+/* broken down time of the job's zone, either the local one or a fixed UTC offset */
+static IJVoid ijCronBreak(IJJSCronJob* job, IJS64 t, struct tm* tm) {
+    time_t x = (time_t)(job->utc ? t - job->offset * 60 : t);
+#if IJJS_PLATFORM == IJJS_PLATFORM_WIN32
+    if (job->utc)
+        gmtime_s(tm, &x);
+    else
+        localtime_s(tm, &x);
+#else
+    if (job->utc)
+        gmtime_r(&x, tm);
+    else
+        localtime_r(&x, tm);
+#endif
+}
+
+static IJS64 ijCronMake(IJJSCronJob* job, struct tm* tm) {
+    if (job->utc) {
+        IJS64 days = ijCronDaysFromCivil(tm->tm_year + 1900LL + tm->tm_mon / 12, tm->tm_mon % 12 + 1, 1) + tm->tm_mday - 1;
+        return days * 86400 + tm->tm_hour * 3600 + tm->tm_min * 60 + tm->tm_sec + job->offset * 60;
+    }
+    tm->tm_isdst = -1;
+    return (IJS64)mktime(tm);
+}
+
+static IJS32 ijCronNextBit(IJU64 mask, IJS32 from, IJS32 max) {
+    for (IJS32 v = from; v <= max; v++) {
+        if (mask & (1ULL << v))
+            return v;
+    }
+    return -1;
+}
+
+/* first matching second strictly after `after`, or -1 if the expression never matches */
+static IJS64 ijCronNext(IJJSCronJob* job, IJS64 after) {
+    IJJSCronExpr* e = &job->expr;
+    struct tm tm;
+    IJS64 t = after + 1;
+    ijCronBreak(job, t, &tm);
+    for (IJS32 guard = 0; guard < 4096; guard++) {
+        IJS32 v;
+        if (!(e->month & (1U << (tm.tm_mon + 1)))) {
+            tm.tm_mon++;
+            tm.tm_mday = 1;
+            tm.tm_hour = tm.tm_min = tm.tm_sec = 0;
+        }
+        else if (!(e->dom_any && e->dow_any) &&
+            !(e->dom_any ? e->dow & (1U << tm.tm_wday) :
+              e->dow_any ? e->dom & (1U << tm.tm_mday) :
+              (e->dom & (1U << tm.tm_mday)) || (e->dow & (1U << tm.tm_wday)))) {
+            tm.tm_mday++;
+            tm.tm_hour = tm.tm_min = tm.tm_sec = 0;
+        }
+        else if ((v = ijCronNextBit(e->hour, tm.tm_hour, 23)) != tm.tm_hour) {
+            if (v < 0)
+                tm.tm_mday++, v = 0;
+            tm.tm_hour = v;
+            tm.tm_min = tm.tm_sec = 0;
+        }
+        else if ((v = ijCronNextBit(e->minute, tm.tm_min, 59)) != tm.tm_min) {
+            if (v < 0)
+                tm.tm_hour++, v = 0;
+            tm.tm_min = v;
+            tm.tm_sec = 0;
+        }
+        else if ((v = ijCronNextBit(e->second, tm.tm_sec, 59)) != tm.tm_sec) {
+            if (v < 0)
+                tm.tm_min++, v = 0;
+            tm.tm_sec = v;
+        }
+        else
+            return ijCronMake(job, &tm);
+        t = ijCronMake(job, &tm);
+        ijCronBreak(job, t, &tm);
+    }
+    return -1;
+}
+
+static IJS64 ijCronNowMs(IJVoid) {
+    uv_timeval64_t tv;
+    CHECK_EQ(uv_gettimeofday(&tv), 0);
+    return tv.tv_sec * 1000 + tv.tv_usec / 1000;
+}
+
+static IJBool ijCronLess(IJJSCronJob* a, IJJSCronJob* b) {
+    return a->next < b->next;
+}
+
+static IJVoid ijCronHeapSet(IJJSRuntime* qrt, IJU32 i, IJJSCronJob* job) {
+    qrt->cron.heap[i] = job;
+    job->heap_idx = i;
+}
+
+static IJVoid ijCronHeapUp(IJJSRuntime* qrt, IJU32 i) {
+    IJJSCronJob* job = qrt->cron.heap[i];
+    while (i > 0) {
+        IJU32 parent = (i - 1) / 2;
+        if (!ijCronLess(job, qrt->cron.heap[parent]))
+            break;
+        ijCronHeapSet(qrt, i, qrt->cron.heap[parent]);
+        i = parent;
+    }
+    ijCronHeapSet(qrt, i, job);
+}
+
+static IJVoid ijCronHeapDown(IJJSRuntime* qrt, IJU32 i) {
+    IJJSCronJob* job = qrt->cron.heap[i];
+    for (;;) {
+        IJU32 child = 2 * i + 1;
+        if (child >= qrt->cron.count)
+            break;
+        if (child + 1 < qrt->cron.count && ijCronLess(qrt->cron.heap[child + 1], qrt->cron.heap[child]))
+            child++;
+        if (!ijCronLess(qrt->cron.heap[child], job))
+            break;
+        ijCronHeapSet(qrt, i, qrt->cron.heap[child]);
+        i = child;
+    }
+    ijCronHeapSet(qrt, i, job);
+}
+
+static IJS32 ijCronHeapPush(IJJSRuntime* qrt, IJJSCronJob* job) {
+    if (qrt->cron.count == qrt->cron.size) {
+        IJU32 size = qrt->cron.size ? qrt->cron.size * 2 : 16;
+        IJJSCronJob** heap = je_realloc(qrt->cron.heap, size * sizeof(*heap));
+        if (!heap)
+            return -1;
+        qrt->cron.heap = heap;
+        qrt->cron.size = size;
+    }
+    ijCronHeapSet(qrt, qrt->cron.count++, job);
+    ijCronHeapUp(qrt, job->heap_idx);
+    return 0;
+}
+
+static IJVoid ijCronHeapRemove(IJJSRuntime* qrt, IJJSCronJob* job) {
+    IJU32 i = job->heap_idx;
+    IJJSCronJob* last = qrt->cron.heap[--qrt->cron.count];
+    job->heap_idx = -1;
+    if (last == job)
+        return;
+    ijCronHeapSet(qrt, i, last);
+    ijCronHeapDown(qrt, i);
+    ijCronHeapUp(qrt, last->heap_idx);
+}
+
+static IJVoid uvCronTimerCb(uv_timer_t* handle);
+
+static IJVoid ijCronSchedule(IJJSRuntime* qrt) {
+    if (qrt->cron.count == 0) {
+        uv_timer_stop(&qrt->cron.timer);
+        return;
+    }
+    IJS64 delay = qrt->cron.heap[0]->next * 1000 - ijCronNowMs();
+    /* re-check at least once a minute in case the wall clock jumps */
+    if (delay < 0)
+        delay = 0;
+    else if (delay > IJJS_CRON_MAX_DELAY)
+        delay = IJJS_CRON_MAX_DELAY;
+    CHECK_EQ(uv_timer_start(&qrt->cron.timer, uvCronTimerCb, delay, 0), 0);
+}
+
+static IJVoid ijCronCall(IJJSCronJob* job) {
+    JSContext* ctx = job->ctx;
+    JSValue func = JS_DupValue(ctx, job->func);
+    JSValue ret = JS_Call(ctx, func, JS_UNDEFINED, 0, NULL);
+    JS_FreeValue(ctx, func);
+    if (JS_IsException(ret))
+        ijDumpError(ctx);
+    JS_FreeValue(ctx, ret);
+}
+
+static IJVoid uvCronTimerCb(uv_timer_t* handle) {
+    IJJSRuntime* qrt = handle->data;
+    CHECK_NOT_NULL(qrt);
+    IJU64 t0 = ijProfileBegin(qrt);
+    IJS64 now = ijCronNowMs() / 1000;
+    while (qrt->cron.count && qrt->cron.heap[0]->next <= now) {
+        IJJSCronJob* job = qrt->cron.heap[0];
+        JSContext* ctx = job->ctx;
+        /* runs missed while the loop was blocked are skipped, not replayed */
+        job->next = ijCronNext(job, job->next > now ? job->next : now);
+        if (job->next < 0)
+            ijCronHeapRemove(qrt, job);
+        else
+            ijCronHeapDown(qrt, 0);
+        JSValue obj = JS_DupValue(ctx, job->obj);
+        if (job->heap_idx < 0) {
+            JS_FreeValue(ctx, job->obj);
+            job->obj = JS_UNDEFINED;
+        }
+        ijCronCall(job);
+        ijExecuteJobs(ctx);
+        JS_FreeValue(ctx, obj);
+    }
+    ijCronSchedule(qrt);
+    ijProfileEnd(qrt, IJJS_PHASE_TIMERS, t0);
+}
+
+static JSClassID ijjs_cron_job_class_id;
+
+static IJVoid ijCronJobStop(IJJSCronJob* job) {
+    if (job->heap_idx >= 0) {
+        IJJSRuntime* qrt = ijGetRuntime(job->ctx);
+        IJBool first = job->heap_idx == 0;
+        ijCronHeapRemove(qrt, job);
+        if (first)
+            ijCronSchedule(qrt);
+        JSValue obj = job->obj;
+        job->obj = JS_UNDEFINED;
+        JS_FreeValue(job->ctx, obj);
+    }
+}
+
+static IJVoid ijCronJobFinalizer(JSRuntime* rt, JSValue val) {
+    IJJSCronJob* job = JS_GetOpaque(val, ijjs_cron_job_class_id);
+    if (job) {
+        JS_FreeValueRT(rt, job->func);
+        je_free(job);
+    }
+}
+
+static IJVoid ijCronJobMark(JSRuntime* rt, JSValueConst val, JS_MarkFunc* mark_func) {
+    IJJSCronJob* job = JS_GetOpaque(val, ijjs_cron_job_class_id);
+    if (job)
+        JS_MarkValue(rt, job->func, mark_func);
+}
+
+static JSClassDef ijjs_cron_job_class = { "CronJob", .finalizer = ijCronJobFinalizer, .gc_mark = ijCronJobMark };
+
+static JSValue ijCronJobConstructor(JSContext* ctx, JSValueConst new_target, IJS32 argc, JSValueConst* argv) {
+    IJJSCronExpr expr;
+    const IJAnsi* str = JS_ToCString(ctx, argv[0]);
+    if (!str)
+        return JS_EXCEPTION;
+    JSValue r = ijCronParse(ctx, str, &expr, true);
+    JS_FreeCString(ctx, str);
+    if (JS_IsException(r))
+        return r;
+    if (!JS_IsFunction(ctx, argv[1]))
+        return JS_ThrowTypeError(ctx, "not a function");
+    IJS32 offset = 0;
+    IJBool utc = !JS_IsUndefined(argv[2]);
+    if (utc && JS_ToInt32(ctx, &offset, argv[2]))
+        return JS_EXCEPTION;
+    JSValue obj = JS_NewObjectClass(ctx, ijjs_cron_job_class_id);
+    if (JS_IsException(obj))
+        return obj;
+    IJJSCronJob* job = je_calloc(1, sizeof(*job));
+    if (!job) {
+        JS_FreeValue(ctx, obj);
+        return JS_EXCEPTION;
+    }
+    job->ctx = ctx;
+    job->expr = expr;
+    job->utc = utc;
+    job->offset = offset;
+    job->heap_idx = -1;
+    job->next = -1;
+    job->obj = JS_UNDEFINED;
+    job->func = JS_DupValue(ctx, argv[1]);
+    JS_SetOpaque(obj, job);
+    return obj;
+}
+
+static JSValue ijCronJobStart(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSCronJob* job = JS_GetOpaque2(ctx, this_val, ijjs_cron_job_class_id);
+    if (!job)
+        return JS_EXCEPTION;
+    if (job->heap_idx < 0) {
+        IJJSRuntime* qrt = ijGetRuntime(ctx);
+        job->next = ijCronNext(job, ijCronNowMs() / 1000);
+        if (job->next >= 0) {
+            if (ijCronHeapPush(qrt, job) != 0)
+                return JS_ThrowOutOfMemory(ctx);
+            job->obj = JS_DupValue(ctx, this_val);
+            if (job->heap_idx == 0)
+                ijCronSchedule(qrt);
+        }
+    }
+    return JS_DupValue(ctx, this_val);
+}
+
+static JSValue ijCronJobStopFunc(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSCronJob* job = JS_GetOpaque2(ctx, this_val, ijjs_cron_job_class_id);
+    if (!job)
+        return JS_EXCEPTION;
+    ijCronJobStop(job);
+    return JS_DupValue(ctx, this_val);
+}
+
+static JSValue ijCronJobNext(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSCronJob* job = JS_GetOpaque2(ctx, this_val, ijjs_cron_job_class_id);
+    if (!job)
+        return JS_EXCEPTION;
+    IJS64 next = job->heap_idx >= 0 ? job->next : ijCronNext(job, ijCronNowMs() / 1000);
+    if (next < 0)
+        return JS_NULL;
+    return JS_NewInt64(ctx, next * 1000);
+}
+
+static JSValue ijCronValidate(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSCronExpr expr;
+    if (!JS_IsString(argv[0]))
+        return JS_FALSE;
+    const IJAnsi* str = JS_ToCString(ctx, argv[0]);
+    if (!str)
+        return JS_EXCEPTION;
+    JSValue r = ijCronParse(ctx, str, &expr, false);
+    JS_FreeCString(ctx, str);
+    return JS_NewBool(ctx, !JS_IsException(r));
+}
+
+static const JSCFunctionListEntry ijjs_cron_job_proto_funcs[] = {
+    JS_CFUNC_DEF("start", 0, ijCronJobStart),
+    JS_CFUNC_DEF("stop", 0, ijCronJobStopFunc),
+    JS_CFUNC_DEF("next", 0, ijCronJobNext),
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "CronJob", JS_PROP_CONFIGURABLE),
+};
+
+static const JSCFunctionListEntry ijjs_cron_funcs[] = {
+    JS_CFUNC_DEF("validate", 1, ijCronValidate),
+};
+
+IJVoid ijModCronInit(JSContext* ctx, JSModuleDef* m) {
+    JSValue proto, obj;
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    CHECK_EQ(uv_timer_init(&qrt->loop, &qrt->cron.timer), 0);
+    qrt->cron.timer.data = qrt;
+    JS_NewClassID(&ijjs_cron_job_class_id);
+    JS_NewClass(JS_GetRuntime(ctx), ijjs_cron_job_class_id, &ijjs_cron_job_class);
+    proto = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, proto, ijjs_cron_job_proto_funcs, countof(ijjs_cron_job_proto_funcs));
+    JS_SetClassProto(ctx, ijjs_cron_job_class_id, proto);
+    obj = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, obj, ijjs_cron_funcs, countof(ijjs_cron_funcs));
+    JS_SetPropertyStr(ctx, obj, "Job", JS_NewCFunction2(ctx, ijCronJobConstructor, "CronJob", 3, JS_CFUNC_constructor, 0));
+    JS_SetModuleExport(ctx, m, "cron", obj);
+}
+
+IJVoid ijModCronExport(JSContext* ctx, JSModuleDef* m) {
+    JS_AddModuleExport(ctx, m, "cron");
+}
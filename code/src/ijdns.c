@@ -71,6 +71,7 @@ static IJVoid uvGetAddrInfoCb(uv_getaddrinfo_t* req, IJS32 status, struct addrin
     IJJSGetAddrInfoReq* gr = req->data;
     CHECK_NOT_NULL(gr);
     JSContext* ctx = gr->ctx;
+    IJU64 t0 = ijProfileBegin(ijGetRuntime(ctx));
     JSValue arg;
     IJBool is_reject = status != 0;
     if (status != 0)
@@ -80,6 +81,7 @@ static IJVoid uvGetAddrInfoCb(uv_getaddrinfo_t* req, IJS32 status, struct addrin
     ijSettlePromise(ctx, &gr->result, is_reject, 1, (JSValueConst *) &arg);
     uv_freeaddrinfo(res);
     js_free(ctx, gr);
+    ijProfileEnd(ijGetRuntime(ctx), IJJS_PHASE_IO, t0);
 }
 
 static JSValue ijDnsGetAddrInfo(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
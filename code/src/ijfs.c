@@ -184,6 +184,7 @@ static IJVoid uvFsReqCb(uv_fs_t* req) {
     if (!fr)
         return;
     JSContext* ctx = fr->ctx;
+    IJU64 t0 = ijProfileBegin(ijGetRuntime(ctx));
     IJJSFsReadReq* rr;
     JSValue arg;
     IJJSFile* f;
@@ -268,6 +269,7 @@ skip:
     JS_FreeValue(ctx, fr->obj);
     uv_fs_req_cleanup(&fr->req);
     js_free(ctx, fr);
+    ijProfileEnd(ijGetRuntime(ctx), IJJS_PHASE_FS, t0);
 }
 
 static JSValue ijFileRead(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
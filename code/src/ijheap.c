@@ -0,0 +1,337 @@
+/*
+ ijjs javascript runtime engine
+ Copyright (C) 2010-2017 Trix
+
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include "ijjs.h"
+#include <errno.h>
+
+#define IJJS_HEAP_NODE_FIELDS 6
+#define IJJS_HEAP_EDGE_DROPPED 0xff
+
+typedef struct {
+    IJU8 type;
+    IJU32 name;
+    IJU64 size;
+    IJS32 ref_count;
+    IJU32 incoming;
+    IJU32 edge_count;
+} IJJSHeapNode;
+
+typedef struct {
+    IJU8 type;
+    IJU32 name_or_index;
+    IJU32 from;
+    const IJVoid* to;
+} IJJSHeapEdge;
+
+typedef struct {
+    IJJSHeapNode* nodes;
+    IJU32 node_count;
+    IJU32 node_size;
+    IJJSHeapEdge* edges;
+    IJU32 edge_count;
+    IJU32 edge_size;
+    /* pointer to node index + 1 */
+    const IJVoid** ptrs;
+    IJU32* ptr_nodes;
+    IJU32 ptr_size;
+    /* interned strings, string to index + 1 */
+    IJAnsi** strings;
+    IJU32 string_count;
+    IJU32 string_size;
+    IJU32* string_table;
+    IJU32 string_table_size;
+    IJU32 current;
+} IJJSHeapSnapshot;
+
+static inline IJU32 ijHeapHashPtr(const IJVoid* ptr, IJU32 size) {
+    uintptr_t h = (uintptr_t)ptr;
+    h ^= h >> 17;
+    h *= 0x9E3779B1u;
+    return (IJU32)(h ^ (h >> 15)) & (size - 1);
+}
+
+static inline IJU32 ijHeapHashStr(const IJAnsi* str, IJU32 size) {
+    IJU32 h = 2166136261u;
+    for (; *str; str++)
+        h = (h ^ (IJU8)*str) * 16777619u;
+    return h & (size - 1);
+}
+
+static IJU32 ijHeapFindPtr(IJJSHeapSnapshot* hs, const IJVoid* ptr) {
+    IJU32 h = ijHeapHashPtr(ptr, hs->ptr_size);
+    while (hs->ptr_nodes[h]) {
+        if (hs->ptrs[h] == ptr)
+            return hs->ptr_nodes[h];
+        h = (h + 1) & (hs->ptr_size - 1);
+    }
+    return 0;
+}
+
+static IJVoid ijHeapInsertPtr(IJJSHeapSnapshot* hs, const IJVoid* ptr, IJU32 node) {
+    IJU32 h;
+    if ((hs->node_count + 1) * 2 > hs->ptr_size) {
+        IJU32 size = hs->ptr_size ? hs->ptr_size * 2 : 4096;
+        const IJVoid** ptrs = je_calloc(size, sizeof(*ptrs));
+        IJU32* ptr_nodes = je_calloc(size, sizeof(*ptr_nodes));
+        CHECK_NOT_NULL(ptrs);
+        CHECK_NOT_NULL(ptr_nodes);
+        for (IJU32 i = 0; i < hs->ptr_size; i++) {
+            if (!hs->ptr_nodes[i])
+                continue;
+            h = ijHeapHashPtr(hs->ptrs[i], size);
+            while (ptr_nodes[h])
+                h = (h + 1) & (size - 1);
+            ptrs[h] = hs->ptrs[i];
+            ptr_nodes[h] = hs->ptr_nodes[i];
+        }
+        je_free(hs->ptrs);
+        je_free(hs->ptr_nodes);
+        hs->ptrs = ptrs;
+        hs->ptr_nodes = ptr_nodes;
+        hs->ptr_size = size;
+    }
+    h = ijHeapHashPtr(ptr, hs->ptr_size);
+    while (hs->ptr_nodes[h])
+        h = (h + 1) & (hs->ptr_size - 1);
+    hs->ptrs[h] = ptr;
+    hs->ptr_nodes[h] = node + 1;
+}
+
+static IJU32 ijHeapString(IJJSHeapSnapshot* hs, const IJAnsi* str) {
+    IJU32 h;
+    if ((hs->string_count + 1) * 2 > hs->string_table_size) {
+        IJU32 size = hs->string_table_size ? hs->string_table_size * 2 : 1024;
+        IJU32* table = je_calloc(size, sizeof(*table));
+        CHECK_NOT_NULL(table);
+        for (IJU32 i = 0; i < hs->string_count; i++) {
+            h = ijHeapHashStr(hs->strings[i], size);
+            while (table[h])
+                h = (h + 1) & (size - 1);
+            table[h] = i + 1;
+        }
+        je_free(hs->string_table);
+        hs->string_table = table;
+        hs->string_table_size = size;
+    }
+    h = ijHeapHashStr(str, hs->string_table_size);
+    while (hs->string_table[h]) {
+        if (!strcmp(hs->strings[hs->string_table[h] - 1], str))
+            return hs->string_table[h] - 1;
+        h = (h + 1) & (hs->string_table_size - 1);
+    }
+    if (hs->string_count == hs->string_size) {
+        hs->string_size = hs->string_size ? hs->string_size * 2 : 1024;
+        hs->strings = je_realloc(hs->strings, hs->string_size * sizeof(*hs->strings));
+        CHECK_NOT_NULL(hs->strings);
+    }
+    size_t len = strlen(str);
+    hs->strings[hs->string_count] = je_malloc(len + 1);
+    CHECK_NOT_NULL(hs->strings[hs->string_count]);
+    memcpy(hs->strings[hs->string_count], str, len + 1);
+    hs->string_table[h] = ++hs->string_count;
+    return hs->string_count - 1;
+}
+
+static IJU32 ijHeapAddNode(IJJSHeapSnapshot* hs, IJS32 type, const IJAnsi* name, size_t size, IJS32 ref_count) {
+    if (hs->node_count == hs->node_size) {
+        hs->node_size = hs->node_size ? hs->node_size * 2 : 4096;
+        hs->nodes = je_realloc(hs->nodes, hs->node_size * sizeof(*hs->nodes));
+        CHECK_NOT_NULL(hs->nodes);
+    }
+    IJJSHeapNode* n = &hs->nodes[hs->node_count];
+    n->type = type;
+    n->name = ijHeapString(hs, name);
+    n->size = size;
+    n->ref_count = ref_count;
+    n->incoming = 0;
+    n->edge_count = 0;
+    return hs->node_count++;
+}
+
+static IJVoid ijHeapNodeCb(IJVoid* opaque, const IJVoid* ptr, JSHeapNodeType type, const IJAnsi* name, size_t self_size, IJS32 ref_count) {
+    IJJSHeapSnapshot* hs = opaque;
+    hs->current = ijHeapAddNode(hs, type, name, self_size, ref_count);
+    ijHeapInsertPtr(hs, ptr, hs->current);
+}
+
+static IJVoid ijHeapStringCb(IJVoid* opaque, const IJVoid* ptr, const IJAnsi* value, size_t self_size) {
+    IJJSHeapSnapshot* hs = opaque;
+    /* strings have no outgoing references, the current node stays the same */
+    if (!ijHeapFindPtr(hs, ptr))
+        ijHeapInsertPtr(hs, ptr, ijHeapAddNode(hs, JS_HEAP_NODE_STRING, value, self_size, 0));
+}
+
+static IJVoid ijHeapEdgeCb(IJVoid* opaque, const IJVoid* to, JSHeapEdgeType type, const IJAnsi* name, IJU32 index) {
+    IJJSHeapSnapshot* hs = opaque;
+    if (hs->edge_count == hs->edge_size) {
+        hs->edge_size = hs->edge_size ? hs->edge_size * 2 : 8192;
+        hs->edges = je_realloc(hs->edges, hs->edge_size * sizeof(*hs->edges));
+        CHECK_NOT_NULL(hs->edges);
+    }
+    IJJSHeapEdge* e = &hs->edges[hs->edge_count++];
+    e->type = type;
+    if (type == JS_HEAP_EDGE_ELEMENT || type == JS_HEAP_EDGE_HIDDEN)
+        e->name_or_index = index;
+    else
+        e->name_or_index = ijHeapString(hs, name ? name : "");
+    e->from = hs->current;
+    e->to = to;
+    hs->nodes[hs->current].edge_count++;
+}
+
+static IJVoid ijHeapFree(IJJSHeapSnapshot* hs) {
+    for (IJU32 i = 0; i < hs->string_count; i++)
+        je_free(hs->strings[i]);
+    je_free(hs->strings);
+    je_free(hs->string_table);
+    je_free(hs->ptrs);
+    je_free(hs->ptr_nodes);
+    je_free(hs->nodes);
+    je_free(hs->edges);
+}
+
+static IJVoid ijHeapPutString(FILE* fp, const IJAnsi* str) {
+    fputc('"', fp);
+    for (; *str; str++) {
+        IJU8 c = *str;
+        if (c == '"' || c == '\\')
+            fprintf(fp, "\\%c", c);
+        else if (c == '\n')
+            fputs("\\n", fp);
+        else if (c < 0x20)
+            fprintf(fp, "\\u%04x", c);
+        else
+            fputc(c, fp);
+    }
+    fputc('"', fp);
+}
+
+/* V8 .heapsnapshot layout, node 0 is a synthetic root pointing at every
+   object referenced from outside of the heap */
+static IJVoid ijHeapWrite(IJJSHeapSnapshot* hs, FILE* fp) {
+    IJU32 roots = 0, edges = 0;
+    for (IJU32 i = 0; i < hs->edge_count; i++) {
+        IJJSHeapEdge* e = &hs->edges[i];
+        IJU32 to = ijHeapFindPtr(hs, e->to);
+        /* references to objects which are being freed are dropped */
+        if (!to) {
+            hs->nodes[e->from].edge_count--;
+            e->type = IJJS_HEAP_EDGE_DROPPED;
+            continue;
+        }
+        e->to = (const IJVoid*)(uintptr_t)(to - 1);
+        hs->nodes[to - 1].incoming++;
+    }
+    for (IJU32 i = 1; i < hs->node_count; i++) {
+        IJJSHeapNode* n = &hs->nodes[i];
+        if (n->type != JS_HEAP_NODE_STRING && n->ref_count > (IJS32)n->incoming)
+            roots++;
+    }
+    hs->nodes[0].edge_count = roots;
+    fputs("{\"snapshot\":{\"meta\":{"
+        "\"node_fields\":[\"type\",\"name\",\"id\",\"self_size\",\"edge_count\",\"trace_node_id\"],"
+        "\"node_types\":[[\"hidden\",\"array\",\"string\",\"object\",\"code\",\"closure\",\"regexp\",\"number\",\"native\",\"synthetic\","
+        "\"concatenated string\",\"sliced string\",\"symbol\",\"bigint\"],\"string\",\"number\",\"number\",\"number\",\"number\"],"
+        "\"edge_fields\":[\"type\",\"name_or_index\",\"to_node\"],"
+        "\"edge_types\":[[\"context\",\"element\",\"property\",\"internal\",\"hidden\",\"shortcut\",\"weak\"],\"string_or_number\",\"node\"],"
+        "\"trace_function_info_fields\":[\"function_id\",\"name\",\"script_name\",\"script_id\",\"line\",\"column\"],"
+        "\"trace_node_fields\":[\"id\",\"function_info_index\",\"count\",\"size\",\"children\"],"
+        "\"sample_fields\":[\"timestamp_us\",\"last_assigned_id\"],"
+        "\"location_fields\":[\"object_index\",\"script_id\",\"line\",\"column\"]},", fp);
+    for (IJU32 i = 0; i < hs->node_count; i++)
+        edges += hs->nodes[i].edge_count;
+    fprintf(fp, "\"node_count\":%u,\"edge_count\":%u,\"trace_function_count\":0},\n\"nodes\":[", hs->node_count, edges);
+    for (IJU32 i = 0; i < hs->node_count; i++) {
+        IJJSHeapNode* n = &hs->nodes[i];
+        fprintf(fp, "%s%u,%u,%u,%llu,%u,0\n", i ? "," : "", n->type, n->name, i * 2 + 1,
+            (unsigned long long)n->size, n->edge_count);
+    }
+    fputs("],\n\"edges\":[", fp);
+    edges = 0;
+    for (IJU32 i = 1; i < hs->node_count; i++) {
+        IJJSHeapNode* n = &hs->nodes[i];
+        if (n->type != JS_HEAP_NODE_STRING && n->ref_count > (IJS32)n->incoming) {
+            fprintf(fp, "%s%u,%u,%u\n", edges ? "," : "", JS_HEAP_EDGE_ELEMENT, edges, i * IJJS_HEAP_NODE_FIELDS);
+            edges++;
+        }
+    }
+    for (IJU32 i = 0; i < hs->edge_count; i++) {
+        IJJSHeapEdge* e = &hs->edges[i];
+        if (e->type == IJJS_HEAP_EDGE_DROPPED)
+            continue;
+        fprintf(fp, "%s%u,%u,%u\n", edges ? "," : "", e->type, e->name_or_index,
+            (IJU32)(uintptr_t)e->to * IJJS_HEAP_NODE_FIELDS);
+        edges++;
+    }
+    fputs("],\n\"trace_function_infos\":[],\"trace_tree\":[],\"samples\":[],\"locations\":[],\n\"strings\":[", fp);
+    for (IJU32 i = 0; i < hs->string_count; i++) {
+        if (i)
+            fputs(",\n", fp);
+        ijHeapPutString(fp, hs->strings[i]);
+    }
+    fputs("]}\n", fp);
+}
+
+static JSValue ijWriteHeapSnapshot(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJAnsi path[1024];
+    if (JS_IsUndefined(argv[0])) {
+        IJS32 len = ijDiagnosticFilename(path, sizeof(path) - 16, NULL, "Heap");
+        strcpy(path + len, ".heapsnapshot");
+    } else {
+        const IJAnsi* filename = JS_ToCString(ctx, argv[0]);
+        if (!filename)
+            return JS_EXCEPTION;
+        IJS32 n = snprintf(path, sizeof(path), "%s", filename);
+        JS_FreeCString(ctx, filename);
+        if (n < 0 || (size_t)n >= sizeof(path))
+            return JS_ThrowRangeError(ctx, "the snapshot filename is too long");
+    }
+    FILE* fp = fopen(path, "wb");
+    if (!fp)
+        return ijThrowErrno(ctx, uv_translate_sys_error(errno));
+    static const JSHeapWalker walker = { ijHeapNodeCb, ijHeapStringCb, ijHeapEdgeCb };
+    IJJSHeapSnapshot hs;
+    memset(&hs, 0, sizeof(hs));
+    JSRuntime* rt = JS_GetRuntime(ctx);
+    /* only what survives a collection is of interest */
+    JS_RunGC(rt);
+    ijHeapInsertPtr(&hs, &hs, ijHeapAddNode(&hs, JS_HEAP_NODE_SYNTHETIC, "(GC roots)", 0, 0));
+    JS_WalkHeap(rt, &walker, &hs);
+    ijHeapWrite(&hs, fp);
+    IJS32 failed = ferror(fp);
+    fclose(fp);
+    ijHeapFree(&hs);
+    if (failed)
+        return ijThrowErrno(ctx, UV_EIO);
+    return JS_NewString(ctx, path);
+}
+
+static const JSCFunctionListEntry ijjs_heap_funcs[] = {
+    JS_CFUNC_DEF("writeHeapSnapshot", 1, ijWriteHeapSnapshot),
+};
+
+IJVoid ijModHeapInit(JSContext* ctx, JSModuleDef* m) {
+    JS_SetModuleExportList(ctx, m, ijjs_heap_funcs, countof(ijjs_heap_funcs));
+}
+
+IJVoid ijModHeapExport(JSContext* ctx, JSModuleDef* m) {
+    JS_AddModuleExportList(ctx, m, ijjs_heap_funcs, countof(ijjs_heap_funcs));
+}
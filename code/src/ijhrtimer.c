@@ -0,0 +1,300 @@
+/*
+ ijjs javascript runtime engine
+ Copyright (C) 2010-2017 Trix
+
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include "ijjs.h"
+#include <math.h>
+#if IJJS_PLATFORM == IJJS_PLATFORM_LINUX
+#include <sys/timerfd.h>
+#include <unistd.h>
+#endif
+
+/* the coarse millisecond timer wakes up this early and the rest is spun away */
+#define IJJS_HRTIMER_SPIN_NS 1000000ULL
+
+typedef struct {
+    JSContext* ctx;
+    struct list_head link;
+    IJBool active;
+    IJU64 interval;
+    IJU64 deadline;
+    IJU64 ticks;
+    IJU64 missed;
+    IJU64 jitter_min;
+    IJU64 jitter_max;
+    IJF64 jitter_mean;
+    IJF64 jitter_m2;
+    JSValue obj;
+    JSValue func;
+} IJJSHrTimer;
+
+static JSClassID ijjs_hrtimer_class_id;
+
+static IJVoid ijHrTimerArm(IJJSRuntime* qrt);
+
+static IJVoid ijHrTimerInsert(IJJSRuntime* qrt, IJJSHrTimer* t) {
+    struct list_head* el;
+    list_for_each(el, &qrt->hrtimers.list) {
+        IJJSHrTimer* o = list_entry(el, IJJSHrTimer, link);
+        if (o->deadline > t->deadline)
+            break;
+    }
+    list_add_tail(&t->link, el);
+}
+
+static IJVoid ijHrTimerRecord(IJJSHrTimer* t, IJU64 late) {
+    IJF64 delta = (IJF64)late - t->jitter_mean;
+    if (t->ticks == 0 || late < t->jitter_min)
+        t->jitter_min = late;
+    if (late > t->jitter_max)
+        t->jitter_max = late;
+    t->ticks++;
+    t->jitter_mean += delta / t->ticks;
+    t->jitter_m2 += delta * ((IJF64)late - t->jitter_mean);
+}
+
+static IJVoid ijHrTimerCall(IJJSHrTimer* t) {
+    JSContext* ctx = t->ctx;
+    JSValue func = JS_DupValue(ctx, t->func);
+    JSValue ret = JS_Call(ctx, func, JS_UNDEFINED, 0, NULL);
+    JS_FreeValue(ctx, func);
+    if (JS_IsException(ret))
+        ijDumpError(ctx);
+    JS_FreeValue(ctx, ret);
+}
+
+static IJVoid ijHrTimerRun(IJJSRuntime* qrt) {
+    /* every due timer fires at most once per wake up so slow callbacks can't starve the loop */
+    IJU64 now = uv_hrtime();
+    IJU64 t0 = ijProfileBegin(qrt);
+    while (!list_empty(&qrt->hrtimers.list)) {
+        IJJSHrTimer* t = list_entry(qrt->hrtimers.list.next, IJJSHrTimer, link);
+        if (t->deadline > now)
+            break;
+        JSContext* ctx = t->ctx;
+        list_del(&t->link);
+        ijHrTimerRecord(t, now - t->deadline);
+        /* deadlines are absolute so lateness never accumulates into drift */
+        t->deadline += t->interval;
+        if (t->deadline <= now) {
+            IJU64 skipped = (now - t->deadline) / t->interval + 1;
+            t->missed += skipped;
+            t->deadline += skipped * t->interval;
+        }
+        ijHrTimerInsert(qrt, t);
+        JSValue obj = JS_DupValue(ctx, t->obj);
+        ijHrTimerCall(t);
+        ijExecuteJobs(ctx);
+        JS_FreeValue(ctx, obj);
+    }
+    ijProfileEnd(qrt, IJJS_PHASE_TIMERS, t0);
+    ijHrTimerArm(qrt);
+}
+
+static IJVoid ijHrTimerSpin(IJJSRuntime* qrt) {
+    if (list_empty(&qrt->hrtimers.list))
+        return;
+    IJJSHrTimer* t = list_entry(qrt->hrtimers.list.next, IJJSHrTimer, link);
+    if (t->deadline > uv_hrtime() + IJJS_HRTIMER_SPIN_NS) {
+        ijHrTimerArm(qrt);
+        return;
+    }
+    while (uv_hrtime() < t->deadline)
+        ;
+    ijHrTimerRun(qrt);
+}
+
+static IJVoid uvHrTimerCb(uv_timer_t* handle) {
+    IJJSRuntime* qrt = handle->data;
+    CHECK_NOT_NULL(qrt);
+    ijHrTimerSpin(qrt);
+}
+
+static IJVoid uvHrTimerIdleCb(uv_idle_t* handle) {
+    IJJSRuntime* qrt = handle->data;
+    CHECK_NOT_NULL(qrt);
+    ijHrTimerSpin(qrt);
+}
+
+#if IJJS_PLATFORM == IJJS_PLATFORM_LINUX
+static IJVoid uvHrTimerPollCb(uv_poll_t* handle, IJS32 status, IJS32 events) {
+    IJJSRuntime* qrt = handle->data;
+    CHECK_NOT_NULL(qrt);
+    IJU64 expirations;
+    while (read(qrt->hrtimers.fd, &expirations, sizeof(expirations)) < 0 && errno == EINTR)
+        ;
+    ijHrTimerRun(qrt);
+}
+#endif
+
+static IJVoid ijHrTimerArm(IJJSRuntime* qrt) {
+    if (list_empty(&qrt->hrtimers.list)) {
+        uv_timer_stop(&qrt->hrtimers.timer);
+        uv_idle_stop(&qrt->hrtimers.idle);
+#if IJJS_PLATFORM == IJJS_PLATFORM_LINUX
+        if (qrt->hrtimers.fd >= 0)
+            uv_poll_stop(&qrt->hrtimers.poll);
+#endif
+        return;
+    }
+    IJJSHrTimer* t = list_entry(qrt->hrtimers.list.next, IJJSHrTimer, link);
+#if IJJS_PLATFORM == IJJS_PLATFORM_LINUX
+    /* uv_hrtime() reads CLOCK_MONOTONIC, so its deadlines can be used as absolute timerfd expirations */
+    if (qrt->hrtimers.fd >= 0) {
+        struct itimerspec its = { { 0, 0 }, { t->deadline / 1000000000ULL, t->deadline % 1000000000ULL } };
+        CHECK_EQ(timerfd_settime(qrt->hrtimers.fd, TFD_TIMER_ABSTIME, &its, NULL), 0);
+        CHECK_EQ(uv_poll_start(&qrt->hrtimers.poll, UV_READABLE, uvHrTimerPollCb), 0);
+        return;
+    }
+#endif
+    /* a zero timeout restarted from a timer callback would run again before the loop time advances,
+       so the last stretch is waited for from an idle handle, once per loop iteration */
+    IJU64 now = uv_hrtime();
+    if (t->deadline >= now + 2 * IJJS_HRTIMER_SPIN_NS) {
+        uv_idle_stop(&qrt->hrtimers.idle);
+        CHECK_EQ(uv_timer_start(&qrt->hrtimers.timer, uvHrTimerCb, (t->deadline - now - IJJS_HRTIMER_SPIN_NS) / 1000000ULL, 0), 0);
+    }
+    else {
+        uv_timer_stop(&qrt->hrtimers.timer);
+        CHECK_EQ(uv_idle_start(&qrt->hrtimers.idle, uvHrTimerIdleCb), 0);
+    }
+}
+
+static IJVoid ijHrTimerStop(IJJSHrTimer* t) {
+    if (t->active) {
+        IJJSRuntime* qrt = ijGetRuntime(t->ctx);
+        IJBool first = qrt->hrtimers.list.next == &t->link;
+        t->active = false;
+        list_del(&t->link);
+        if (first)
+            ijHrTimerArm(qrt);
+        JSValue obj = t->obj;
+        t->obj = JS_UNDEFINED;
+        JS_FreeValue(t->ctx, obj);
+    }
+}
+
+static IJVoid ijHrTimerFinalizer(JSRuntime* rt, JSValue val) {
+    IJJSHrTimer* t = JS_GetOpaque(val, ijjs_hrtimer_class_id);
+    if (t) {
+        JS_FreeValueRT(rt, t->func);
+        je_free(t);
+    }
+}
+
+static IJVoid ijHrTimerMark(JSRuntime* rt, JSValueConst val, JS_MarkFunc* mark_func) {
+    IJJSHrTimer* t = JS_GetOpaque(val, ijjs_hrtimer_class_id);
+    if (t)
+        JS_MarkValue(rt, t->func, mark_func);
+}
+
+static JSClassDef ijjs_hrtimer_class = { "HighResTimer", .finalizer = ijHrTimerFinalizer, .gc_mark = ijHrTimerMark };
+
+static JSValue ijSetHighResInterval(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJF64 us;
+    JSValueConst func = argv[0];
+    if (!JS_IsFunction(ctx, func))
+        return JS_ThrowTypeError(ctx, "not a function");
+    if (JS_ToFloat64(ctx, &us, argv[1]))
+        return JS_EXCEPTION;
+    if (!(us >= 1 && us <= 3600e6))
+        return JS_ThrowRangeError(ctx, "invalid interval");
+    JSValue obj = JS_NewObjectClass(ctx, ijjs_hrtimer_class_id);
+    if (JS_IsException(obj))
+        return obj;
+    IJJSHrTimer* t = je_calloc(1, sizeof(*t));
+    if (!t) {
+        JS_FreeValue(ctx, obj);
+        return JS_EXCEPTION;
+    }
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    t->ctx = ctx;
+    t->interval = (IJU64)(us * 1000);
+    t->deadline = uv_hrtime() + t->interval;
+    t->func = JS_DupValue(ctx, func);
+    t->obj = JS_DupValue(ctx, obj);
+    t->active = true;
+    JS_SetOpaque(obj, t);
+    ijHrTimerInsert(qrt, t);
+    if (qrt->hrtimers.list.next == &t->link)
+        ijHrTimerArm(qrt);
+    return obj;
+}
+
+static JSValue ijClearHighResInterval(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSHrTimer* t = JS_GetOpaque(argv[0], ijjs_hrtimer_class_id);
+    if (t)
+        ijHrTimerStop(t);
+    return JS_UNDEFINED;
+}
+
+static JSValue ijHrTimerStats(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSHrTimer* t = JS_GetOpaque2(ctx, this_val, ijjs_hrtimer_class_id);
+    if (!t)
+        return JS_EXCEPTION;
+    JSValue obj = JS_NewObjectProto(ctx, JS_NULL);
+    IJF64 stddev = t->ticks > 1 ? sqrt(t->jitter_m2 / (t->ticks - 1)) : 0;
+    /* jitter is how late each callback started relative to its deadline, in microseconds */
+    JS_DefinePropertyValueStr(ctx, obj, "interval", JS_NewFloat64(ctx, t->interval / 1e3), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "ticks", JS_NewInt64(ctx, t->ticks), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "missed", JS_NewInt64(ctx, t->missed), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "jitterMin", JS_NewFloat64(ctx, t->jitter_min / 1e3), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "jitterMax", JS_NewFloat64(ctx, t->jitter_max / 1e3), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "jitterMean", JS_NewFloat64(ctx, t->jitter_mean / 1e3), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "jitterStdDev", JS_NewFloat64(ctx, stddev / 1e3), JS_PROP_C_W_E);
+    return obj;
+}
+
+static const JSCFunctionListEntry ijjs_hrtimer_proto_funcs[] = {
+    JS_CFUNC_DEF("stats", 0, ijHrTimerStats),
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "HighResTimer", JS_PROP_CONFIGURABLE),
+};
+
+static const JSCFunctionListEntry ijjs_hrtimer_funcs[] = {
+    JS_CFUNC_DEF("setHighResInterval", 2, ijSetHighResInterval),
+    JS_CFUNC_DEF("clearHighResInterval", 1, ijClearHighResInterval),
+};
+
+IJVoid ijModHrTimerInit(JSContext* ctx, JSModuleDef* m) {
+    JS_NewClassID(&ijjs_hrtimer_class_id);
+    JS_NewClass(JS_GetRuntime(ctx), ijjs_hrtimer_class_id, &ijjs_hrtimer_class);
+    JSValue proto = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, proto, ijjs_hrtimer_proto_funcs, countof(ijjs_hrtimer_proto_funcs));
+    JS_SetClassProto(ctx, ijjs_hrtimer_class_id, proto);
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    init_list_head(&qrt->hrtimers.list);
+    CHECK_EQ(uv_timer_init(&qrt->loop, &qrt->hrtimers.timer), 0);
+    qrt->hrtimers.timer.data = qrt;
+    CHECK_EQ(uv_idle_init(&qrt->loop, &qrt->hrtimers.idle), 0);
+    qrt->hrtimers.idle.data = qrt;
+#if IJJS_PLATFORM == IJJS_PLATFORM_LINUX
+    /* without a timerfd the timer plus spin fallback is used */
+    qrt->hrtimers.fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (qrt->hrtimers.fd >= 0) {
+        CHECK_EQ(uv_poll_init(&qrt->loop, &qrt->hrtimers.poll, qrt->hrtimers.fd), 0);
+        qrt->hrtimers.poll.data = qrt;
+    }
+#endif
+    JS_SetModuleExportList(ctx, m, ijjs_hrtimer_funcs, countof(ijjs_hrtimer_funcs));
+}
+
+IJVoid ijModHrTimerExport(JSContext* ctx, JSModuleDef* m) {
+    JS_AddModuleExportList(ctx, m, ijjs_hrtimer_funcs, countof(ijjs_hrtimer_funcs));
+}
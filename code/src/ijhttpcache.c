@@ -0,0 +1,388 @@
+/*
+ ijjs javascript runtime engine
+ Copyright (C) 2010-2017 Trix
+
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include "ijjs.h"
+#include <string.h>
+#include <curl/curl.h>
+#if IJJS_PLATFORM == IJJS_PLATFORM_WIN32
+#define strncasecmp _strnicmp
+#endif
+
+#define IJJS_HTTP_MAX_CONNECTIONS 8
+
+/*
+ * Remote modules are fetched on a multi handle of their own, the loader has to wait for them
+ * without running the loop, so the socket callbacks of the XHR handle cannot drive it. Every
+ * module that arrives is scanned for its imports and those are fetched alongside, the loader
+ * only waits for the one it asked for while the rest of the graph keeps downloading.
+ *
+ * The cache keeps <hash of the body>.js next to <hash of the url>.meta, which holds the url,
+ * the validators of the response and the body it points to.
+ */
+typedef struct IJJSHttpModule {
+    struct IJJSHttpModule* next;
+    IJAnsi* url;
+    CURL* easy;
+    struct curl_slist* headers;
+    DynBuf body;
+    IJAnsi etag[256];
+    IJAnsi last_modified[64];
+    IJAnsi cached[17];  /* hash of the cached body, empty when there is none */
+    IJS32 status;       /* http status, a negative CURLcode or 0 when offline without a copy */
+    IJBool done;
+} IJJSHttpModule;
+
+/* FNV-1a */
+static IJVoid ijHttpHash(const IJU8* buf, size_t len, IJAnsi* hex) {
+    IJU64 h = 14695981039346656037ULL;
+    for (size_t i = 0; i < len; i++) {
+        h ^= buf[i];
+        h *= 1099511628211ULL;
+    }
+    snprintf(hex, 17, "%016llx", (unsigned long long)h);
+}
+
+static IJVoid ijHttpMkdir(const IJAnsi* path) {
+    uv_fs_t req;
+    uv_fs_mkdir(NULL, &req, path, 0755, NULL);
+    uv_fs_req_cleanup(&req);
+}
+
+static uv_once_t ijHttpCacheOnce = UV_ONCE_INIT;
+static IJAnsi ijHttpCacheHome[PATH_MAX];
+
+static IJVoid ijHttpCacheInitHome(IJVoid) {
+    static const IJAnsi* const dirs[] = { "/.cache", "/.cache/ijjs", "/.cache/ijjs/http" };
+    IJAnsi home[PATH_MAX];
+    size_t len = sizeof(home);
+    if (uv_os_homedir(home, &len) != 0)
+        return;
+    for (IJU32 i = 0; i < countof(dirs); i++) {
+        IJS32 n = snprintf(ijHttpCacheHome, sizeof(ijHttpCacheHome), "%s%s", home, dirs[i]);
+        /* a home directory too long for the cache leaves it off */
+        if (n < 0 || (size_t)n >= sizeof(ijHttpCacheHome)) {
+            ijHttpCacheHome[0] = '\0';
+            return;
+        }
+        ijHttpMkdir(ijHttpCacheHome);
+    }
+}
+
+/* --http-cache DIR, or .cache/ijjs/http in the home directory */
+static const IJAnsi* ijHttpCacheDir(IJJSRuntime* qrt) {
+    if (qrt->options.http_cache_dir) {
+        ijHttpMkdir(qrt->options.http_cache_dir);
+        return qrt->options.http_cache_dir;
+    }
+    uv_once(&ijHttpCacheOnce, ijHttpCacheInitHome);
+    return ijHttpCacheHome[0] ? ijHttpCacheHome : NULL;
+}
+
+static IJS32 ijHttpCachePath(IJAnsi* buf, size_t size, const IJAnsi* dir, const IJAnsi* name, const IJAnsi* ext) {
+    IJS32 n = snprintf(buf, size, "%s/%s%s", dir, name, ext);
+    return n < 0 || (size_t)n >= size ? -1 : 0;
+}
+
+/* written next to the file and renamed, so other processes never read half of it */
+static IJVoid ijHttpCacheWrite(const IJAnsi* path, const IJU8* data, size_t len) {
+    IJAnsi tmp[PATH_MAX + 32];
+    uv_fs_t req;
+    snprintf(tmp, sizeof(tmp), "%s.%d.tmp", path, (IJS32)uv_os_getpid());
+    IJS32 fd = uv_fs_open(NULL, &req, tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644, NULL);
+    uv_fs_req_cleanup(&req);
+    if (fd < 0)
+        return;
+    uv_buf_t b = uv_buf_init((IJAnsi*)data, (IJU32)len);
+    IJS32 r = uv_fs_write(NULL, &req, fd, &b, 1, 0, NULL);
+    uv_fs_req_cleanup(&req);
+    uv_fs_close(NULL, &req, fd, NULL);
+    uv_fs_req_cleanup(&req);
+    r = r == (IJS32)len ? uv_fs_rename(NULL, &req, tmp, path, NULL) : -1;
+    uv_fs_req_cleanup(&req);
+    if (r != 0) {
+        uv_fs_unlink(NULL, &req, tmp, NULL);
+        uv_fs_req_cleanup(&req);
+    }
+}
+
+static IJVoid ijHttpMetaValue(const IJAnsi* line, size_t len, const IJAnsi* key, IJAnsi* value, size_t size) {
+    size_t klen = strlen(key);
+    if (len > klen && !memcmp(line, key, klen))
+        snprintf(value, size, "%.*s", (IJS32)(len - klen), line + klen);
+}
+
+static IJVoid ijHttpCacheReadMeta(JSContext* ctx, IJJSHttpModule* m) {
+    const IJAnsi* dir = ijHttpCacheDir(ijGetRuntime(ctx));
+    IJAnsi path[PATH_MAX];
+    IJAnsi hash[17];
+    IJAnsi url[2048] = { 0 };
+    DynBuf meta;
+    if (!dir)
+        return;
+    ijHttpHash((const IJU8*)m->url, strlen(m->url), hash);
+    if (ijHttpCachePath(path, sizeof(path), dir, hash, ".meta") < 0)
+        return;
+    dbuf_init(&meta);
+    if (ijLoadFile(ctx, &meta, path) == 0) {
+        const IJAnsi* p = (const IJAnsi*)meta.buf;
+        const IJAnsi* end = p + meta.size;
+        while (p < end) {
+            const IJAnsi* nl = memchr(p, '\n', end - p);
+            size_t len = (nl ? nl : end) - p;
+            ijHttpMetaValue(p, len, "url: ", url, sizeof(url));
+            ijHttpMetaValue(p, len, "etag: ", m->etag, sizeof(m->etag));
+            ijHttpMetaValue(p, len, "last-modified: ", m->last_modified, sizeof(m->last_modified));
+            ijHttpMetaValue(p, len, "body: ", m->cached, sizeof(m->cached));
+            p += len + 1;
+        }
+    }
+    dbuf_free(&meta);
+    /* two urls with the same hash, the entry belongs to the other one */
+    if (strcmp(url, m->url) != 0)
+        m->etag[0] = m->last_modified[0] = m->cached[0] = '\0';
+}
+
+static IJS32 ijHttpCacheReadBody(JSContext* ctx, IJJSHttpModule* m) {
+    const IJAnsi* dir = ijHttpCacheDir(ijGetRuntime(ctx));
+    IJAnsi path[PATH_MAX];
+    IJAnsi hash[17];
+    if (!dir || !m->cached[0] || ijHttpCachePath(path, sizeof(path), dir, m->cached, ".js") < 0)
+        return -1;
+    dbuf_free(&m->body);
+    dbuf_init(&m->body);
+    if (ijLoadFile(ctx, &m->body, path) != 0)
+        return -1;
+    ijHttpHash(m->body.buf, m->body.size, hash);
+    return strcmp(hash, m->cached) == 0 ? 0 : -1;
+}
+
+static IJVoid ijHttpCacheStore(JSContext* ctx, IJJSHttpModule* m) {
+    const IJAnsi* dir = ijHttpCacheDir(ijGetRuntime(ctx));
+    IJAnsi path[PATH_MAX];
+    IJAnsi hash[17];
+    uv_fs_t req;
+    if (!dir)
+        return;
+    ijHttpHash(m->body.buf, m->body.size, m->cached);
+    if (ijHttpCachePath(path, sizeof(path), dir, m->cached, ".js") < 0)
+        return;
+    /* bodies are named by their contents, one that is there already is the same */
+    IJS32 r = uv_fs_access(NULL, &req, path, F_OK, NULL);
+    uv_fs_req_cleanup(&req);
+    if (r != 0)
+        ijHttpCacheWrite(path, m->body.buf, m->body.size);
+    DynBuf meta;
+    dbuf_init(&meta);
+    dbuf_printf(&meta, "url: %s\netag: %s\nlast-modified: %s\nbody: %s\n", m->url, m->etag, m->last_modified, m->cached);
+    ijHttpHash((const IJU8*)m->url, strlen(m->url), hash);
+    if (ijHttpCachePath(path, sizeof(path), dir, hash, ".meta") == 0)
+        ijHttpCacheWrite(path, meta.buf, meta.size);
+    dbuf_free(&meta);
+}
+
+static size_t ijHttpHeaderCb(IJAnsi* buffer, size_t size, size_t nitems, IJVoid* userdata) {
+    IJJSHttpModule* m = userdata;
+    size_t len = size * nitems;
+    const IJAnsi* colon = memchr(buffer, ':', len);
+    if (!colon)
+        return len;
+    size_t klen = colon - buffer;
+    const IJAnsi* v = colon + 1;
+    const IJAnsi* end = buffer + len;
+    while (v < end && (*v == ' ' || *v == '\t'))
+        v++;
+    while (end > v && (end[-1] == '\r' || end[-1] == '\n' || end[-1] == ' '))
+        end--;
+    IJAnsi* value = NULL;
+    size_t vsize = 0;
+    if (klen == 4 && !strncasecmp(buffer, "etag", 4)) {
+        value = m->etag;
+        vsize = sizeof(m->etag);
+    } else if (klen == 13 && !strncasecmp(buffer, "last-modified", 13)) {
+        value = m->last_modified;
+        vsize = sizeof(m->last_modified);
+    }
+    if (value)
+        snprintf(value, vsize, "%.*s", (IJS32)(end - v), v);
+    return len;
+}
+
+static CURLM* ijHttpMulti(IJJSRuntime* qrt) {
+    if (!qrt->http_modules.curlm_h) {
+        ijCurlInit();
+        qrt->http_modules.curlm_h = curl_multi_init();
+        CHECK_NOT_NULL(qrt->http_modules.curlm_h);
+        curl_multi_setopt(qrt->http_modules.curlm_h, CURLMOPT_MAX_TOTAL_CONNECTIONS, (long)IJJS_HTTP_MAX_CONNECTIONS);
+    }
+    return qrt->http_modules.curlm_h;
+}
+
+static IJJSHttpModule* ijHttpFind(IJJSRuntime* qrt, const IJAnsi* url) {
+    for (IJJSHttpModule* m = qrt->http_modules.list; m; m = m->next) {
+        if (!strcmp(m->url, url))
+            return m;
+    }
+    return NULL;
+}
+
+static IJVoid ijHttpDone(JSContext* ctx, IJJSHttpModule* m, CURLcode res) {
+    long code = 0;
+    if (res == CURLE_OK)
+        curl_easy_getinfo(m->easy, CURLINFO_RESPONSE_CODE, &code);
+    m->status = res == CURLE_OK ? (IJS32)code : -(IJS32)res;
+    if (m->status == 200) {
+        ijHttpCacheStore(ctx, m);
+    } else if (m->status == 304 || (m->status < 0 && m->cached[0])) {
+        /* not modified, or the network is down and the last copy will do */
+        m->status = ijHttpCacheReadBody(ctx, m) == 0 ? 200 : m->status;
+    }
+    curl_multi_remove_handle(ijGetRuntime(ctx)->http_modules.curlm_h, m->easy);
+    curl_easy_cleanup(m->easy);
+    curl_slist_free_all(m->headers);
+    m->easy = NULL;
+    m->headers = NULL;
+    m->done = TRUE;
+    /* the imports of this module start downloading before the loader asks for them */
+    if (m->status == 200)
+        ijPrefetchImports(ctx, m->url, &m->body);
+}
+
+static IJVoid ijHttpCheckMultiInfo(JSContext* ctx) {
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    CURLMsg* message;
+    IJS32 pending;
+    while ((message = curl_multi_info_read(qrt->http_modules.curlm_h, &pending))) {
+        if (message->msg != CURLMSG_DONE)
+            continue;
+        IJJSHttpModule* m = NULL;
+        curl_easy_getinfo(message->easy_handle, CURLINFO_PRIVATE, &m);
+        CHECK_NOT_NULL(m);
+        ijHttpDone(ctx, m, message->data.result);
+    }
+}
+
+IJVoid ijHttpModulePrefetch(JSContext* ctx, const IJAnsi* url) {
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    if (qrt->bundle.data || ijHttpFind(qrt, url))
+        return;
+    IJJSHttpModule* m = je_calloc(1, sizeof(*m));
+    CHECK_NOT_NULL(m);
+    size_t len = strlen(url) + 1;
+    m->url = je_malloc(len);
+    CHECK_NOT_NULL(m->url);
+    memcpy(m->url, url, len);
+    dbuf_init(&m->body);
+    m->next = qrt->http_modules.list;
+    qrt->http_modules.list = m;
+    ijHttpCacheReadMeta(ctx, m);
+    if (qrt->options.offline) {
+        m->status = ijHttpCacheReadBody(ctx, m) == 0 ? 200 : 0;
+        m->done = TRUE;
+        if (m->status == 200)
+            ijPrefetchImports(ctx, m->url, &m->body);
+        return;
+    }
+    IJAnsi header[320];
+    if (m->cached[0] && m->etag[0]) {
+        snprintf(header, sizeof(header), "If-None-Match: %s", m->etag);
+        m->headers = curl_slist_append(m->headers, header);
+    }
+    if (m->cached[0] && m->last_modified[0]) {
+        snprintf(header, sizeof(header), "If-Modified-Since: %s", m->last_modified);
+        m->headers = curl_slist_append(m->headers, header);
+    }
+    /* the response brings its own validators */
+    m->etag[0] = m->last_modified[0] = '\0';
+    m->easy = curl_easy_init();
+    CHECK_NOT_NULL(m->easy);
+    curl_easy_setopt(m->easy, CURLOPT_URL, m->url);
+    curl_easy_setopt(m->easy, CURLOPT_PRIVATE, m);
+    curl_easy_setopt(m->easy, CURLOPT_WRITEFUNCTION, ijCurlWriteCb);
+    curl_easy_setopt(m->easy, CURLOPT_WRITEDATA, (IJVoid*)&m->body);
+    curl_easy_setopt(m->easy, CURLOPT_HEADERFUNCTION, ijHttpHeaderCb);
+    curl_easy_setopt(m->easy, CURLOPT_HEADERDATA, m);
+    curl_easy_setopt(m->easy, CURLOPT_HTTPHEADER, m->headers);
+    curl_easy_setopt(m->easy, CURLOPT_USERAGENT, "ijjs/1.0");
+    curl_easy_setopt(m->easy, CURLOPT_SSL_VERIFYPEER, 1L);
+    curl_easy_setopt(m->easy, CURLOPT_SSL_VERIFYHOST, 2L);
+    curl_multi_add_handle(ijHttpMulti(qrt), m->easy);
+}
+
+IJS32 ijHttpModuleLoad(JSContext* ctx, const IJAnsi* url, DynBuf* dbuf) {
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    ijHttpModulePrefetch(ctx, url);
+    IJJSHttpModule* m = ijHttpFind(qrt, url);
+    CHECK_NOT_NULL(m);
+    while (!m->done) {
+        IJS32 running = 0;
+        curl_multi_perform(qrt->http_modules.curlm_h, &running);
+        ijHttpCheckMultiInfo(ctx);
+        if (!m->done && running == 0) {
+            /* the transfer never started */
+            m->status = -CURLE_FAILED_INIT;
+            m->done = TRUE;
+        }
+        if (!m->done)
+            curl_multi_poll(qrt->http_modules.curlm_h, NULL, 0, 1000, NULL);
+    }
+    /* a module is loaded once, its entry stays so that it is not fetched again */
+    memcpy(dbuf, &m->body, sizeof(*dbuf));
+    dbuf_init(&m->body);
+    return m->status;
+}
+
+static IJVoid ijHttpModuleFree(IJJSRuntime* qrt, IJJSHttpModule* m) {
+    if (m->easy) {
+        curl_multi_remove_handle(qrt->http_modules.curlm_h, m->easy);
+        curl_easy_cleanup(m->easy);
+    }
+    curl_slist_free_all(m->headers);
+    dbuf_free(&m->body);
+    je_free(m->url);
+    je_free(m);
+}
+
+/* the body was handed out and did not compile, the next import loads it again */
+IJVoid ijHttpModuleForget(JSContext* ctx, const IJAnsi* url) {
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    for (IJJSHttpModule** pm = &qrt->http_modules.list; *pm; pm = &(*pm)->next) {
+        if (!strcmp((*pm)->url, url)) {
+            IJJSHttpModule* m = *pm;
+            *pm = m->next;
+            ijHttpModuleFree(qrt, m);
+            return;
+        }
+    }
+}
+
+IJVoid ijHttpModuleShutdown(IJJSRuntime* qrt) {
+    IJJSHttpModule* m = qrt->http_modules.list;
+    while (m) {
+        IJJSHttpModule* next = m->next;
+        ijHttpModuleFree(qrt, m);
+        m = next;
+    }
+    qrt->http_modules.list = NULL;
+    if (qrt->http_modules.curlm_h) {
+        curl_multi_cleanup(qrt->http_modules.curlm_h);
+        qrt->http_modules.curlm_h = NULL;
+    }
+}
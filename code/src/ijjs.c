@@ -202,10 +202,10 @@ const uint8_t abort_controller[1556] = {
  0x44, 0x26, 0xb2, 0x08,
 };
 
-const uint32_t bootstrap_size = 990;
+const uint32_t bootstrap_size = 1108;
 
-const uint8_t bootstrap[990] = {
- 0x02, 0x1a, 0x1e, 0x40, 0x69, 0x6a, 0x6a, 0x73,
+const uint8_t bootstrap[1108] = {
+ 0x02, 0x1d, 0x1e, 0x40, 0x69, 0x6a, 0x6a, 0x73,
  0x2f, 0x62, 0x6f, 0x6f, 0x74, 0x73, 0x74, 0x72,
  0x61, 0x70, 0x14, 0x40, 0x69, 0x6a, 0x6a, 0x73,
  0x2f, 0x63, 0x6f, 0x72, 0x65, 0x06, 0x6b, 0x65,
@@ -217,118 +217,133 @@ const uint8_t bootstrap[990] = {
  0x65, 0x6f, 0x75, 0x74, 0x16, 0x73, 0x65, 0x74,
  0x49, 0x6e, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c,
  0x1a, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x49, 0x6e,
- 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x0a, 0x61,
- 0x6c, 0x65, 0x72, 0x74, 0x0c, 0x77, 0x69, 0x6e,
- 0x64, 0x6f, 0x77, 0x08, 0x73, 0x65, 0x6c, 0x66,
- 0x0c, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x1c,
- 0x58, 0x4d, 0x4c, 0x48, 0x74, 0x74, 0x70, 0x52,
- 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x0c, 0x57,
- 0x6f, 0x72, 0x6b, 0x65, 0x72, 0x0c, 0x73, 0x69,
- 0x67, 0x6e, 0x61, 0x6c, 0x0c, 0x72, 0x61, 0x6e,
- 0x64, 0x6f, 0x6d, 0x08, 0x61, 0x72, 0x67, 0x73,
- 0x10, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e,
- 0x73, 0x08, 0x77, 0x61, 0x73, 0x6d, 0x0e, 0x65,
- 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x0e, 0x69,
- 0x6e, 0x64, 0x65, 0x78, 0x4f, 0x66, 0x14, 0x73,
- 0x74, 0x61, 0x72, 0x74, 0x73, 0x57, 0x69, 0x74,
- 0x68, 0x06, 0x53, 0x49, 0x47, 0x0c, 0x66, 0x72,
- 0x65, 0x65, 0x7a, 0x65, 0x0f, 0xc0, 0x03, 0x01,
- 0xc2, 0x03, 0x00, 0x00, 0x01, 0x00, 0xf8, 0x01,
- 0x00, 0x0e, 0x00, 0x06, 0x01, 0xa0, 0x01, 0x00,
- 0x02, 0x00, 0x0c, 0x03, 0x06, 0x9d, 0x04, 0x02,
- 0xc4, 0x03, 0x02, 0x00, 0x60, 0x80, 0x01, 0x02,
- 0x01, 0x60, 0xc6, 0x03, 0x00, 0x0d, 0xc8, 0x03,
- 0x00, 0x0d, 0xca, 0x03, 0x01, 0x0d, 0x38, 0x89,
- 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x41, 0xe6,
- 0x00, 0x00, 0x00, 0x43, 0xe6, 0x00, 0x00, 0x00,
- 0x38, 0x89, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00,
- 0x41, 0xe7, 0x00, 0x00, 0x00, 0x43, 0xe7, 0x00,
- 0x00, 0x00, 0x38, 0x89, 0x00, 0x00, 0x00, 0x65,
- 0x00, 0x00, 0x41, 0xe8, 0x00, 0x00, 0x00, 0x43,
- 0xe8, 0x00, 0x00, 0x00, 0x38, 0x89, 0x00, 0x00,
- 0x00, 0x65, 0x00, 0x00, 0x41, 0xe9, 0x00, 0x00,
- 0x00, 0x43, 0xe9, 0x00, 0x00, 0x00, 0x38, 0x89,
- 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x41, 0xea,
- 0x00, 0x00, 0x00, 0x43, 0xea, 0x00, 0x00, 0x00,
+ 0x74, 0x65, 0x72, 0x76, 0x61, 0x6c, 0x18, 0x73,
+ 0x65, 0x74, 0x49, 0x6d, 0x6d, 0x65, 0x64, 0x69,
+ 0x61, 0x74, 0x65, 0x1c, 0x63, 0x6c, 0x65, 0x61,
+ 0x72, 0x49, 0x6d, 0x6d, 0x65, 0x64, 0x69, 0x61,
+ 0x74, 0x65, 0x1c, 0x71, 0x75, 0x65, 0x75, 0x65,
+ 0x4d, 0x69, 0x63, 0x72, 0x6f, 0x74, 0x61, 0x73,
+ 0x6b, 0x0a, 0x61, 0x6c, 0x65, 0x72, 0x74, 0x0c,
+ 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x08, 0x73,
+ 0x65, 0x6c, 0x66, 0x0c, 0x63, 0x72, 0x65, 0x61,
+ 0x74, 0x65, 0x1c, 0x58, 0x4d, 0x4c, 0x48, 0x74,
+ 0x74, 0x70, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73,
+ 0x74, 0x0c, 0x57, 0x6f, 0x72, 0x6b, 0x65, 0x72,
+ 0x0c, 0x73, 0x69, 0x67, 0x6e, 0x61, 0x6c, 0x0c,
+ 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x08, 0x61,
+ 0x72, 0x67, 0x73, 0x10, 0x76, 0x65, 0x72, 0x73,
+ 0x69, 0x6f, 0x6e, 0x73, 0x08, 0x77, 0x61, 0x73,
+ 0x6d, 0x0e, 0x65, 0x6e, 0x74, 0x72, 0x69, 0x65,
+ 0x73, 0x0e, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x4f,
+ 0x66, 0x14, 0x73, 0x74, 0x61, 0x72, 0x74, 0x73,
+ 0x57, 0x69, 0x74, 0x68, 0x06, 0x53, 0x49, 0x47,
+ 0x0c, 0x66, 0x72, 0x65, 0x65, 0x7a, 0x65, 0x0f,
+ 0xc0, 0x03, 0x01, 0xc2, 0x03, 0x00, 0x00, 0x01,
+ 0x00, 0xf8, 0x01, 0x00, 0x0e, 0x00, 0x06, 0x01,
+ 0xa0, 0x01, 0x00, 0x02, 0x00, 0x0f, 0x03, 0x06,
+ 0xe2, 0x04, 0x02, 0xc4, 0x03, 0x02, 0x00, 0x60,
+ 0x80, 0x01, 0x02, 0x01, 0x60, 0xc6, 0x03, 0x00,
+ 0x0d, 0xc8, 0x03, 0x00, 0x0d, 0xca, 0x03, 0x01,
+ 0x0d, 0x38, 0x89, 0x00, 0x00, 0x00, 0x65, 0x00,
+ 0x00, 0x41, 0xe6, 0x00, 0x00, 0x00, 0x43, 0xe6,
+ 0x00, 0x00, 0x00, 0x38, 0x89, 0x00, 0x00, 0x00,
+ 0x65, 0x00, 0x00, 0x41, 0xe7, 0x00, 0x00, 0x00,
+ 0x43, 0xe7, 0x00, 0x00, 0x00, 0x38, 0x89, 0x00,
+ 0x00, 0x00, 0x65, 0x00, 0x00, 0x41, 0xe8, 0x00,
+ 0x00, 0x00, 0x43, 0xe8, 0x00, 0x00, 0x00, 0x38,
+ 0x89, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x41,
+ 0xe9, 0x00, 0x00, 0x00, 0x43, 0xe9, 0x00, 0x00,
+ 0x00, 0x38, 0x89, 0x00, 0x00, 0x00, 0x65, 0x00,
+ 0x00, 0x41, 0xea, 0x00, 0x00, 0x00, 0x43, 0xea,
+ 0x00, 0x00, 0x00, 0x38, 0x89, 0x00, 0x00, 0x00,
+ 0x65, 0x00, 0x00, 0x41, 0xeb, 0x00, 0x00, 0x00,
+ 0x43, 0xeb, 0x00, 0x00, 0x00, 0x38, 0x89, 0x00,
+ 0x00, 0x00, 0x65, 0x00, 0x00, 0x41, 0xec, 0x00,
+ 0x00, 0x00, 0x43, 0xec, 0x00, 0x00, 0x00, 0x38,
+ 0x89, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x41,
+ 0xed, 0x00, 0x00, 0x00, 0x43, 0xed, 0x00, 0x00,
+ 0x00, 0x38, 0x94, 0x00, 0x00, 0x00, 0x42, 0x64,
+ 0x00, 0x00, 0x00, 0x38, 0x89, 0x00, 0x00, 0x00,
+ 0x04, 0x6d, 0x00, 0x00, 0x00, 0x0b, 0x0a, 0x4c,
+ 0x3f, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x54, 0x41,
+ 0x00, 0x00, 0x00, 0x04, 0xc1, 0x01, 0x54, 0x42,
+ 0x00, 0x00, 0x00, 0x04, 0x24, 0x03, 0x00, 0x0e,
  0x38, 0x94, 0x00, 0x00, 0x00, 0x42, 0x64, 0x00,
  0x00, 0x00, 0x38, 0x89, 0x00, 0x00, 0x00, 0x04,
- 0x6d, 0x00, 0x00, 0x00, 0x0b, 0x0a, 0x4c, 0x3f,
- 0x00, 0x00, 0x00, 0xc1, 0x00, 0x54, 0x41, 0x00,
- 0x00, 0x00, 0x04, 0xc1, 0x01, 0x54, 0x42, 0x00,
+ 0xee, 0x00, 0x00, 0x00, 0x0b, 0x0a, 0x4c, 0x3f,
+ 0x00, 0x00, 0x00, 0xc1, 0x02, 0x54, 0x41, 0x00,
+ 0x00, 0x00, 0x04, 0xc1, 0x03, 0x54, 0x42, 0x00,
  0x00, 0x00, 0x04, 0x24, 0x03, 0x00, 0x0e, 0x38,
  0x94, 0x00, 0x00, 0x00, 0x42, 0x64, 0x00, 0x00,
- 0x00, 0x38, 0x89, 0x00, 0x00, 0x00, 0x04, 0xeb,
+ 0x00, 0x38, 0x89, 0x00, 0x00, 0x00, 0x04, 0xef,
  0x00, 0x00, 0x00, 0x0b, 0x0a, 0x4c, 0x3f, 0x00,
- 0x00, 0x00, 0xc1, 0x02, 0x54, 0x41, 0x00, 0x00,
- 0x00, 0x04, 0xc1, 0x03, 0x54, 0x42, 0x00, 0x00,
+ 0x00, 0x00, 0xc1, 0x04, 0x54, 0x41, 0x00, 0x00,
+ 0x00, 0x04, 0xc1, 0x05, 0x54, 0x42, 0x00, 0x00,
  0x00, 0x04, 0x24, 0x03, 0x00, 0x0e, 0x38, 0x94,
- 0x00, 0x00, 0x00, 0x42, 0x64, 0x00, 0x00, 0x00,
- 0x38, 0x89, 0x00, 0x00, 0x00, 0x04, 0xec, 0x00,
- 0x00, 0x00, 0x0b, 0x0a, 0x4c, 0x3f, 0x00, 0x00,
- 0x00, 0xc1, 0x04, 0x54, 0x41, 0x00, 0x00, 0x00,
- 0x04, 0xc1, 0x05, 0x54, 0x42, 0x00, 0x00, 0x00,
- 0x04, 0x24, 0x03, 0x00, 0x0e, 0x38, 0x94, 0x00,
- 0x00, 0x00, 0x42, 0xed, 0x00, 0x00, 0x00, 0x07,
- 0x24, 0x01, 0x00, 0xe3, 0x04, 0xe6, 0x00, 0x00,
- 0x00, 0x04, 0xe8, 0x00, 0x00, 0x00, 0x04, 0xe7,
- 0x00, 0x00, 0x00, 0x04, 0xe9, 0x00, 0x00, 0x00,
- 0x04, 0xea, 0x00, 0x00, 0x00, 0x04, 0xee, 0x00,
- 0x00, 0x00, 0x04, 0xef, 0x00, 0x00, 0x00, 0x04,
- 0xf0, 0x00, 0x00, 0x00, 0x04, 0xf1, 0x00, 0x00,
- 0x00, 0x04, 0xf2, 0x00, 0x00, 0x00, 0x04, 0xf3,
- 0x00, 0x00, 0x00, 0x04, 0xf4, 0x00, 0x00, 0x00,
- 0x26, 0x0c, 0x00, 0xe4, 0x65, 0x01, 0x00, 0x65,
- 0x00, 0x00, 0x41, 0xf0, 0x00, 0x00, 0x00, 0x43,
- 0xf0, 0x00, 0x00, 0x00, 0x61, 0x01, 0x00, 0x61,
+ 0x00, 0x00, 0x00, 0x42, 0xf0, 0x00, 0x00, 0x00,
+ 0x07, 0x24, 0x01, 0x00, 0xe3, 0x04, 0xe6, 0x00,
+ 0x00, 0x00, 0x04, 0xe8, 0x00, 0x00, 0x00, 0x04,
+ 0xe7, 0x00, 0x00, 0x00, 0x04, 0xe9, 0x00, 0x00,
+ 0x00, 0x04, 0xea, 0x00, 0x00, 0x00, 0x04, 0xeb,
+ 0x00, 0x00, 0x00, 0x04, 0xec, 0x00, 0x00, 0x00,
+ 0x04, 0xed, 0x00, 0x00, 0x00, 0x04, 0xf1, 0x00,
+ 0x00, 0x00, 0x04, 0xf2, 0x00, 0x00, 0x00, 0x04,
+ 0xf3, 0x00, 0x00, 0x00, 0x04, 0xf4, 0x00, 0x00,
+ 0x00, 0x04, 0xf5, 0x00, 0x00, 0x00, 0x04, 0xf6,
+ 0x00, 0x00, 0x00, 0x04, 0xf7, 0x00, 0x00, 0x00,
+ 0x26, 0x0f, 0x00, 0xe4, 0x65, 0x01, 0x00, 0x65,
+ 0x00, 0x00, 0x41, 0xf3, 0x00, 0x00, 0x00, 0x43,
+ 0xf3, 0x00, 0x00, 0x00, 0x61, 0x01, 0x00, 0x61,
  0x00, 0x00, 0x38, 0x94, 0x00, 0x00, 0x00, 0x42,
- 0xf5, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x24,
+ 0xf8, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x24,
  0x01, 0x00, 0x7d, 0xed, 0x4c, 0x7d, 0x80, 0x00,
  0x0e, 0xca, 0x80, 0x00, 0x0e, 0xcb, 0x83, 0x65,
- 0x02, 0x00, 0x42, 0xf6, 0x00, 0x00, 0x00, 0x62,
+ 0x02, 0x00, 0x42, 0xf9, 0x00, 0x00, 0x00, 0x62,
  0x00, 0x00, 0x24, 0x01, 0x00, 0xb5, 0xad, 0xec,
- 0x30, 0x62, 0x00, 0x00, 0x42, 0xf7, 0x00, 0x00,
- 0x00, 0x04, 0xf8, 0x00, 0x00, 0x00, 0x24, 0x01,
- 0x00, 0xeb, 0x13, 0x65, 0x01, 0x00, 0x41, 0xf0,
+ 0x30, 0x62, 0x00, 0x00, 0x42, 0xfa, 0x00, 0x00,
+ 0x00, 0x04, 0xfb, 0x00, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0xeb, 0x13, 0x65, 0x01, 0x00, 0x41, 0xf3,
  0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x71, 0x62,
  0x01, 0x00, 0x49, 0xed, 0x0c, 0x65, 0x01, 0x00,
  0x62, 0x00, 0x00, 0x71, 0x62, 0x01, 0x00, 0x49,
  0x80, 0x00, 0xeb, 0xb2, 0x0e, 0x83, 0x65, 0x01,
- 0x00, 0x38, 0x94, 0x00, 0x00, 0x00, 0x42, 0xf9,
- 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x41, 0xf2,
- 0x00, 0x00, 0x00, 0x24, 0x01, 0x00, 0x43, 0xf2,
+ 0x00, 0x38, 0x94, 0x00, 0x00, 0x00, 0x42, 0xfc,
+ 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x41, 0xf5,
+ 0x00, 0x00, 0x00, 0x24, 0x01, 0x00, 0x43, 0xf5,
  0x00, 0x00, 0x00, 0x65, 0x01, 0x00, 0x38, 0x94,
- 0x00, 0x00, 0x00, 0x42, 0xf9, 0x00, 0x00, 0x00,
- 0x65, 0x00, 0x00, 0x41, 0xf3, 0x00, 0x00, 0x00,
- 0x24, 0x01, 0x00, 0x43, 0xf3, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x42, 0xfc, 0x00, 0x00, 0x00,
+ 0x65, 0x00, 0x00, 0x41, 0xf6, 0x00, 0x00, 0x00,
+ 0x24, 0x01, 0x00, 0x43, 0xf6, 0x00, 0x00, 0x00,
  0x38, 0x94, 0x00, 0x00, 0x00, 0x42, 0x64, 0x00,
  0x00, 0x00, 0x38, 0x89, 0x00, 0x00, 0x00, 0x04,
  0xe4, 0x00, 0x00, 0x00, 0x0b, 0x0a, 0x4c, 0x3f,
  0x00, 0x00, 0x00, 0x09, 0x4c, 0x3d, 0x00, 0x00,
  0x00, 0x09, 0x4c, 0x3e, 0x00, 0x00, 0x00, 0x65,
  0x01, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x00, 0x24,
- 0x03, 0x00, 0x29, 0xc0, 0x03, 0x01, 0x34, 0x04,
- 0x5d, 0x5d, 0x5d, 0x5d, 0x5e, 0x6c, 0x21, 0x2b,
- 0x2b, 0x18, 0x6c, 0x21, 0x2b, 0x2b, 0x18, 0x6c,
- 0x21, 0x2b, 0x2b, 0x18, 0x4f, 0x1c, 0x1c, 0x1c,
+ 0x03, 0x00, 0x29, 0xc0, 0x03, 0x01, 0x3a, 0x04,
+ 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5e,
+ 0x6c, 0x21, 0x2b, 0x2b, 0x18, 0x6c, 0x21, 0x2b,
+ 0x2b, 0x18, 0x6c, 0x21, 0x2b, 0x2b, 0x18, 0x4f,
  0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c,
- 0x1c, 0x12, 0x09, 0x54, 0xb2, 0x53, 0x0e, 0x5d,
- 0x53, 0x0e, 0x3a, 0x22, 0x94, 0x95, 0x6c, 0x21,
- 0x21, 0x21, 0x2b, 0x0e, 0x42, 0x07, 0x01, 0x00,
+ 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x12,
+ 0x09, 0x54, 0xb2, 0x53, 0x0e, 0x5d, 0x53, 0x0e,
+ 0x3a, 0x22, 0x94, 0x95, 0x6c, 0x21, 0x21, 0x21,
+ 0x2b, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x00,
+ 0x00, 0x01, 0x00, 0x00, 0x06, 0x00, 0x38, 0x89,
+ 0x00, 0x00, 0x00, 0x28, 0xc0, 0x03, 0x0e, 0x00,
+ 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x01, 0x00, 0x29, 0xc0, 0x03,
+ 0x0f, 0x00, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00,
+ 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x00, 0x38,
+ 0x89, 0x00, 0x00, 0x00, 0x28, 0xc0, 0x03, 0x14,
+ 0x00, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x29, 0xc0,
+ 0x03, 0x15, 0x00, 0x0e, 0x42, 0x07, 0x01, 0x00,
  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x00,
  0x38, 0x89, 0x00, 0x00, 0x00, 0x28, 0xc0, 0x03,
- 0x0b, 0x00, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00,
+ 0x1a, 0x00, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00,
  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x29,
- 0xc0, 0x03, 0x0c, 0x00, 0x0e, 0x42, 0x07, 0x01,
- 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06,
- 0x00, 0x38, 0x89, 0x00, 0x00, 0x00, 0x28, 0xc0,
- 0x03, 0x11, 0x00, 0x0e, 0x42, 0x07, 0x01, 0x00,
- 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
- 0x29, 0xc0, 0x03, 0x12, 0x00, 0x0e, 0x42, 0x07,
- 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
- 0x06, 0x00, 0x38, 0x89, 0x00, 0x00, 0x00, 0x28,
- 0xc0, 0x03, 0x17, 0x00, 0x0e, 0x42, 0x07, 0x01,
- 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
- 0x00, 0x29, 0xc0, 0x03, 0x18, 0x00,
+ 0xc0, 0x03, 0x1b, 0x00,
 };
 
 const uint32_t bootstrap2_size = 5365;
@@ -1007,9 +1022,9 @@ const uint8_t bootstrap2[5365] = {
  0x49, 0x00, 0x0e, 0xea, 0x01,
 };
 
-const uint32_t console_size = 9932;
+const uint32_t console_size = 9946;
 
-const uint8_t console[9932] = {
+const uint8_t console[9946] = {
  0x02, 0xdf, 0x01, 0x1a, 0x40, 0x69, 0x6a, 0x6a,
  0x73, 0x2f, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c,
  0x65, 0x0e, 0x43, 0x6f, 0x6e, 0x73, 0x6f, 0x6c,
@@ -1027,141 +1042,141 @@ const uint8_t console[9932] = {
  0x6e, 0x74, 0x42, 0x79, 0x74, 0x65, 0x73, 0x12,
  0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x52, 0x6f,
  0x77, 0x10, 0x63, 0x6c, 0x69, 0x54, 0x61, 0x62,
- 0x6c, 0x65, 0x16, 0x54, 0x65, 0x78, 0x74, 0x45,
- 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x03, 0x00,
- 0x25, 0x18, 0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65,
- 0x4d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x03, 0x3c,
- 0x25, 0x12, 0x72, 0x6f, 0x77, 0x4d, 0x69, 0x64,
- 0x64, 0x6c, 0x65, 0x03, 0x10, 0x25, 0x10, 0x74,
- 0x6f, 0x70, 0x52, 0x69, 0x67, 0x68, 0x74, 0x03,
- 0x0c, 0x25, 0x0e, 0x74, 0x6f, 0x70, 0x4c, 0x65,
- 0x66, 0x74, 0x03, 0x1c, 0x25, 0x14, 0x6c, 0x65,
- 0x66, 0x74, 0x4d, 0x69, 0x64, 0x64, 0x6c, 0x65,
- 0x03, 0x2c, 0x25, 0x12, 0x74, 0x6f, 0x70, 0x4d,
- 0x69, 0x64, 0x64, 0x6c, 0x65, 0x03, 0x18, 0x25,
- 0x16, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x52,
- 0x69, 0x67, 0x68, 0x74, 0x03, 0x14, 0x25, 0x14,
- 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x4c, 0x65,
- 0x66, 0x74, 0x03, 0x34, 0x25, 0x18, 0x62, 0x6f,
- 0x74, 0x74, 0x6f, 0x6d, 0x4d, 0x69, 0x64, 0x64,
- 0x6c, 0x65, 0x03, 0x24, 0x25, 0x16, 0x72, 0x69,
- 0x67, 0x68, 0x74, 0x4d, 0x69, 0x64, 0x64, 0x6c,
- 0x65, 0x05, 0x02, 0x25, 0x20, 0x00, 0x08, 0x6c,
- 0x65, 0x66, 0x74, 0x05, 0x20, 0x00, 0x02, 0x25,
- 0x0a, 0x72, 0x69, 0x67, 0x68, 0x74, 0x07, 0x20,
- 0x00, 0x02, 0x25, 0x20, 0x00, 0x0c, 0x6d, 0x69,
- 0x64, 0x64, 0x6c, 0x65, 0x06, 0x6c, 0x6f, 0x67,
- 0x08, 0x69, 0x6e, 0x66, 0x6f, 0x08, 0x77, 0x61,
- 0x72, 0x6e, 0x0a, 0x65, 0x72, 0x72, 0x6f, 0x72,
- 0x0c, 0x61, 0x73, 0x73, 0x65, 0x72, 0x74, 0x06,
- 0x64, 0x69, 0x72, 0x0c, 0x64, 0x69, 0x72, 0x78,
- 0x6d, 0x6c, 0x0a, 0x74, 0x61, 0x62, 0x6c, 0x65,
- 0x0a, 0x74, 0x72, 0x61, 0x63, 0x65, 0x18, 0x66,
- 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x52, 0x65, 0x67,
- 0x45, 0x78, 0x70, 0x0e, 0x69, 0x6e, 0x73, 0x70,
- 0x65, 0x63, 0x74, 0x1c, 0x73, 0x74, 0x79, 0x6c,
- 0x69, 0x7a, 0x65, 0x4e, 0x6f, 0x43, 0x6f, 0x6c,
- 0x6f, 0x72, 0x16, 0x61, 0x72, 0x72, 0x61, 0x79,
- 0x54, 0x6f, 0x48, 0x61, 0x73, 0x68, 0x16, 0x66,
- 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x56, 0x61, 0x6c,
- 0x75, 0x65, 0x1e, 0x66, 0x6f, 0x72, 0x6d, 0x61,
- 0x74, 0x50, 0x72, 0x69, 0x6d, 0x69, 0x74, 0x69,
- 0x76, 0x65, 0x16, 0x66, 0x6f, 0x72, 0x6d, 0x61,
- 0x74, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x16, 0x66,
- 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x41, 0x72, 0x72,
- 0x61, 0x79, 0x1c, 0x66, 0x6f, 0x72, 0x6d, 0x61,
- 0x74, 0x50, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74,
- 0x79, 0x28, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65,
- 0x54, 0x6f, 0x53, 0x69, 0x6e, 0x67, 0x6c, 0x65,
- 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x0e, 0x69,
- 0x73, 0x41, 0x72, 0x72, 0x61, 0x79, 0x10, 0x69,
- 0x73, 0x42, 0x69, 0x67, 0x49, 0x6e, 0x74, 0x14,
- 0x69, 0x73, 0x42, 0x69, 0x67, 0x46, 0x6c, 0x6f,
- 0x61, 0x74, 0x12, 0x69, 0x73, 0x42, 0x6f, 0x6f,
- 0x6c, 0x65, 0x61, 0x6e, 0x0c, 0x69, 0x73, 0x4e,
- 0x75, 0x6c, 0x6c, 0x22, 0x69, 0x73, 0x4e, 0x75,
- 0x6c, 0x6c, 0x4f, 0x72, 0x55, 0x6e, 0x64, 0x65,
- 0x66, 0x69, 0x6e, 0x65, 0x64, 0x10, 0x69, 0x73,
- 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x10, 0x69,
- 0x73, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x10,
- 0x69, 0x73, 0x53, 0x79, 0x6d, 0x62, 0x6f, 0x6c,
- 0x16, 0x69, 0x73, 0x55, 0x6e, 0x64, 0x65, 0x66,
- 0x69, 0x6e, 0x65, 0x64, 0x10, 0x69, 0x73, 0x52,
- 0x65, 0x67, 0x45, 0x78, 0x70, 0x10, 0x69, 0x73,
- 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x0c, 0x69,
- 0x73, 0x44, 0x61, 0x74, 0x65, 0x0e, 0x69, 0x73,
- 0x45, 0x72, 0x72, 0x6f, 0x72, 0x14, 0x69, 0x73,
- 0x46, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
- 0x1c, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x54,
- 0x6f, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x02,
- 0x66, 0x0e, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74,
- 0x73, 0x02, 0x69, 0x08, 0x61, 0x72, 0x67, 0x73,
- 0x06, 0x6c, 0x65, 0x6e, 0x06, 0x73, 0x74, 0x72,
- 0x02, 0x78, 0x08, 0x70, 0x75, 0x73, 0x68, 0x02,
- 0x20, 0x0e, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63,
- 0x65, 0x02, 0x5f, 0x04, 0x25, 0x25, 0x02, 0x25,
- 0x04, 0x25, 0x73, 0x04, 0x25, 0x64, 0x04, 0x25,
- 0x6a, 0x12, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
- 0x69, 0x66, 0x79, 0x14, 0x5b, 0x43, 0x69, 0x72,
- 0x63, 0x75, 0x6c, 0x61, 0x72, 0x5d, 0x06, 0x6f,
- 0x62, 0x6a, 0x08, 0x6f, 0x70, 0x74, 0x73, 0x06,
- 0x63, 0x74, 0x78, 0x08, 0x73, 0x65, 0x65, 0x6e,
- 0x0e, 0x73, 0x74, 0x79, 0x6c, 0x69, 0x7a, 0x65,
- 0x0a, 0x64, 0x65, 0x70, 0x74, 0x68, 0x12, 0x73,
- 0x74, 0x79, 0x6c, 0x65, 0x54, 0x79, 0x70, 0x65,
- 0x0a, 0x61, 0x72, 0x72, 0x61, 0x79, 0x08, 0x68,
- 0x61, 0x73, 0x68, 0x0e, 0x66, 0x6f, 0x72, 0x45,
- 0x61, 0x63, 0x68, 0x06, 0x76, 0x61, 0x6c, 0x06,
- 0x69, 0x64, 0x78, 0x18, 0x72, 0x65, 0x63, 0x75,
- 0x72, 0x73, 0x65, 0x54, 0x69, 0x6d, 0x65, 0x73,
- 0x12, 0x70, 0x72, 0x69, 0x6d, 0x69, 0x74, 0x69,
- 0x76, 0x65, 0x08, 0x6b, 0x65, 0x79, 0x73, 0x16,
- 0x76, 0x69, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x4b,
- 0x65, 0x79, 0x73, 0x08, 0x62, 0x61, 0x73, 0x65,
- 0x0c, 0x62, 0x72, 0x61, 0x63, 0x65, 0x73, 0x02,
- 0x6e, 0x0c, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74,
- 0x0e, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x4f, 0x66,
- 0x16, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
- 0x74, 0x69, 0x6f, 0x6e, 0x04, 0x3a, 0x20, 0x12,
+ 0x6c, 0x65, 0x03, 0x00, 0x25, 0x18, 0x6d, 0x69,
+ 0x64, 0x64, 0x6c, 0x65, 0x4d, 0x69, 0x64, 0x64,
+ 0x6c, 0x65, 0x03, 0x3c, 0x25, 0x12, 0x72, 0x6f,
+ 0x77, 0x4d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x03,
+ 0x10, 0x25, 0x10, 0x74, 0x6f, 0x70, 0x52, 0x69,
+ 0x67, 0x68, 0x74, 0x03, 0x0c, 0x25, 0x0e, 0x74,
+ 0x6f, 0x70, 0x4c, 0x65, 0x66, 0x74, 0x03, 0x1c,
+ 0x25, 0x14, 0x6c, 0x65, 0x66, 0x74, 0x4d, 0x69,
+ 0x64, 0x64, 0x6c, 0x65, 0x03, 0x2c, 0x25, 0x12,
+ 0x74, 0x6f, 0x70, 0x4d, 0x69, 0x64, 0x64, 0x6c,
+ 0x65, 0x03, 0x18, 0x25, 0x16, 0x62, 0x6f, 0x74,
+ 0x74, 0x6f, 0x6d, 0x52, 0x69, 0x67, 0x68, 0x74,
+ 0x03, 0x14, 0x25, 0x14, 0x62, 0x6f, 0x74, 0x74,
+ 0x6f, 0x6d, 0x4c, 0x65, 0x66, 0x74, 0x03, 0x34,
+ 0x25, 0x18, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d,
+ 0x4d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x03, 0x24,
+ 0x25, 0x16, 0x72, 0x69, 0x67, 0x68, 0x74, 0x4d,
+ 0x69, 0x64, 0x64, 0x6c, 0x65, 0x05, 0x02, 0x25,
+ 0x20, 0x00, 0x08, 0x6c, 0x65, 0x66, 0x74, 0x05,
+ 0x20, 0x00, 0x02, 0x25, 0x0a, 0x72, 0x69, 0x67,
+ 0x68, 0x74, 0x07, 0x20, 0x00, 0x02, 0x25, 0x20,
+ 0x00, 0x0c, 0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65,
+ 0x06, 0x6c, 0x6f, 0x67, 0x08, 0x69, 0x6e, 0x66,
+ 0x6f, 0x08, 0x77, 0x61, 0x72, 0x6e, 0x0a, 0x65,
+ 0x72, 0x72, 0x6f, 0x72, 0x0c, 0x61, 0x73, 0x73,
+ 0x65, 0x72, 0x74, 0x06, 0x64, 0x69, 0x72, 0x0c,
+ 0x64, 0x69, 0x72, 0x78, 0x6d, 0x6c, 0x0a, 0x74,
+ 0x61, 0x62, 0x6c, 0x65, 0x0a, 0x74, 0x72, 0x61,
+ 0x63, 0x65, 0x18, 0x66, 0x6f, 0x72, 0x6d, 0x61,
+ 0x74, 0x52, 0x65, 0x67, 0x45, 0x78, 0x70, 0x0e,
+ 0x69, 0x6e, 0x73, 0x70, 0x65, 0x63, 0x74, 0x1c,
+ 0x73, 0x74, 0x79, 0x6c, 0x69, 0x7a, 0x65, 0x4e,
+ 0x6f, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x16, 0x61,
+ 0x72, 0x72, 0x61, 0x79, 0x54, 0x6f, 0x48, 0x61,
+ 0x73, 0x68, 0x16, 0x66, 0x6f, 0x72, 0x6d, 0x61,
+ 0x74, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x1e, 0x66,
+ 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x50, 0x72, 0x69,
+ 0x6d, 0x69, 0x74, 0x69, 0x76, 0x65, 0x16, 0x66,
+ 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x45, 0x72, 0x72,
+ 0x6f, 0x72, 0x16, 0x66, 0x6f, 0x72, 0x6d, 0x61,
+ 0x74, 0x41, 0x72, 0x72, 0x61, 0x79, 0x1c, 0x66,
+ 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x50, 0x72, 0x6f,
+ 0x70, 0x65, 0x72, 0x74, 0x79, 0x28, 0x72, 0x65,
+ 0x64, 0x75, 0x63, 0x65, 0x54, 0x6f, 0x53, 0x69,
+ 0x6e, 0x67, 0x6c, 0x65, 0x53, 0x74, 0x72, 0x69,
+ 0x6e, 0x67, 0x0e, 0x69, 0x73, 0x41, 0x72, 0x72,
+ 0x61, 0x79, 0x10, 0x69, 0x73, 0x42, 0x69, 0x67,
+ 0x49, 0x6e, 0x74, 0x14, 0x69, 0x73, 0x42, 0x69,
+ 0x67, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x12, 0x69,
+ 0x73, 0x42, 0x6f, 0x6f, 0x6c, 0x65, 0x61, 0x6e,
+ 0x0c, 0x69, 0x73, 0x4e, 0x75, 0x6c, 0x6c, 0x22,
+ 0x69, 0x73, 0x4e, 0x75, 0x6c, 0x6c, 0x4f, 0x72,
+ 0x55, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
+ 0x64, 0x10, 0x69, 0x73, 0x4e, 0x75, 0x6d, 0x62,
+ 0x65, 0x72, 0x10, 0x69, 0x73, 0x53, 0x74, 0x72,
+ 0x69, 0x6e, 0x67, 0x10, 0x69, 0x73, 0x53, 0x79,
+ 0x6d, 0x62, 0x6f, 0x6c, 0x16, 0x69, 0x73, 0x55,
+ 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64,
+ 0x10, 0x69, 0x73, 0x52, 0x65, 0x67, 0x45, 0x78,
+ 0x70, 0x10, 0x69, 0x73, 0x4f, 0x62, 0x6a, 0x65,
+ 0x63, 0x74, 0x0c, 0x69, 0x73, 0x44, 0x61, 0x74,
+ 0x65, 0x0e, 0x69, 0x73, 0x45, 0x72, 0x72, 0x6f,
+ 0x72, 0x14, 0x69, 0x73, 0x46, 0x75, 0x6e, 0x63,
+ 0x74, 0x69, 0x6f, 0x6e, 0x1c, 0x6f, 0x62, 0x6a,
+ 0x65, 0x63, 0x74, 0x54, 0x6f, 0x53, 0x74, 0x72,
+ 0x69, 0x6e, 0x67, 0x02, 0x66, 0x0e, 0x6f, 0x62,
+ 0x6a, 0x65, 0x63, 0x74, 0x73, 0x02, 0x69, 0x08,
+ 0x61, 0x72, 0x67, 0x73, 0x06, 0x6c, 0x65, 0x6e,
+ 0x06, 0x73, 0x74, 0x72, 0x02, 0x78, 0x08, 0x70,
+ 0x75, 0x73, 0x68, 0x02, 0x20, 0x0e, 0x72, 0x65,
+ 0x70, 0x6c, 0x61, 0x63, 0x65, 0x02, 0x5f, 0x04,
+ 0x25, 0x25, 0x02, 0x25, 0x04, 0x25, 0x73, 0x04,
+ 0x25, 0x64, 0x04, 0x25, 0x6a, 0x12, 0x73, 0x74,
+ 0x72, 0x69, 0x6e, 0x67, 0x69, 0x66, 0x79, 0x14,
+ 0x5b, 0x43, 0x69, 0x72, 0x63, 0x75, 0x6c, 0x61,
+ 0x72, 0x5d, 0x06, 0x6f, 0x62, 0x6a, 0x08, 0x6f,
+ 0x70, 0x74, 0x73, 0x06, 0x63, 0x74, 0x78, 0x08,
+ 0x73, 0x65, 0x65, 0x6e, 0x0e, 0x73, 0x74, 0x79,
+ 0x6c, 0x69, 0x7a, 0x65, 0x0a, 0x64, 0x65, 0x70,
+ 0x74, 0x68, 0x12, 0x73, 0x74, 0x79, 0x6c, 0x65,
+ 0x54, 0x79, 0x70, 0x65, 0x0a, 0x61, 0x72, 0x72,
+ 0x61, 0x79, 0x08, 0x68, 0x61, 0x73, 0x68, 0x0e,
+ 0x66, 0x6f, 0x72, 0x45, 0x61, 0x63, 0x68, 0x06,
+ 0x76, 0x61, 0x6c, 0x06, 0x69, 0x64, 0x78, 0x18,
+ 0x72, 0x65, 0x63, 0x75, 0x72, 0x73, 0x65, 0x54,
+ 0x69, 0x6d, 0x65, 0x73, 0x12, 0x70, 0x72, 0x69,
+ 0x6d, 0x69, 0x74, 0x69, 0x76, 0x65, 0x08, 0x6b,
+ 0x65, 0x79, 0x73, 0x16, 0x76, 0x69, 0x73, 0x69,
+ 0x62, 0x6c, 0x65, 0x4b, 0x65, 0x79, 0x73, 0x08,
+ 0x62, 0x61, 0x73, 0x65, 0x0c, 0x62, 0x72, 0x61,
+ 0x63, 0x65, 0x73, 0x02, 0x6e, 0x0c, 0x6f, 0x75,
+ 0x74, 0x70, 0x75, 0x74, 0x0e, 0x69, 0x6e, 0x64,
+ 0x65, 0x78, 0x4f, 0x66, 0x16, 0x64, 0x65, 0x73,
+ 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e,
+ 0x04, 0x3a, 0x20, 0x12, 0x5b, 0x46, 0x75, 0x6e,
+ 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x02, 0x5d, 0x0e,
+ 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x08,
+ 0x63, 0x61, 0x6c, 0x6c, 0x0c, 0x72, 0x65, 0x67,
+ 0x65, 0x78, 0x70, 0x08, 0x64, 0x61, 0x74, 0x65,
+ 0x02, 0x7b, 0x02, 0x7d, 0x02, 0x5b, 0x14, 0x20,
  0x5b, 0x46, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
- 0x6e, 0x02, 0x5d, 0x0e, 0x73, 0x70, 0x65, 0x63,
- 0x69, 0x61, 0x6c, 0x08, 0x63, 0x61, 0x6c, 0x6c,
- 0x0c, 0x72, 0x65, 0x67, 0x65, 0x78, 0x70, 0x08,
- 0x64, 0x61, 0x74, 0x65, 0x02, 0x7b, 0x02, 0x7d,
- 0x02, 0x5b, 0x14, 0x20, 0x5b, 0x46, 0x75, 0x6e,
- 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x16, 0x74, 0x6f,
- 0x55, 0x54, 0x43, 0x53, 0x74, 0x72, 0x69, 0x6e,
- 0x67, 0x10, 0x5b, 0x4f, 0x62, 0x6a, 0x65, 0x63,
- 0x74, 0x5d, 0x06, 0x6d, 0x61, 0x70, 0x06, 0x70,
- 0x6f, 0x70, 0x06, 0x6b, 0x65, 0x79, 0x0c, 0x73,
- 0x69, 0x6d, 0x70, 0x6c, 0x65, 0x02, 0x27, 0x04,
- 0x5c, 0x27, 0x02, 0x22, 0x04, 0x2d, 0x30, 0x02,
- 0x6c, 0x02, 0x0a, 0x0a, 0x6d, 0x61, 0x74, 0x63,
- 0x68, 0x08, 0x64, 0x65, 0x73, 0x63, 0x1e, 0x5b,
- 0x47, 0x65, 0x74, 0x74, 0x65, 0x72, 0x2f, 0x53,
- 0x65, 0x74, 0x74, 0x65, 0x72, 0x5d, 0x10, 0x5b,
- 0x47, 0x65, 0x74, 0x74, 0x65, 0x72, 0x5d, 0x10,
- 0x5b, 0x53, 0x65, 0x74, 0x74, 0x65, 0x72, 0x5d,
- 0x0c, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x08,
- 0x6c, 0x69, 0x6e, 0x65, 0x04, 0x20, 0x20, 0x06,
- 0x20, 0x20, 0x20, 0x16, 0x6e, 0x75, 0x6d, 0x4c,
- 0x69, 0x6e, 0x65, 0x73, 0x45, 0x73, 0x74, 0x0c,
- 0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0x04, 0x0a,
- 0x20, 0x08, 0x2c, 0x0a, 0x20, 0x20, 0x04, 0x2c,
- 0x20, 0x08, 0x70, 0x72, 0x65, 0x76, 0x06, 0x63,
- 0x75, 0x72, 0x04, 0x61, 0x72, 0x06, 0x61, 0x72,
- 0x67, 0x04, 0x72, 0x65, 0x1e, 0x5b, 0x6f, 0x62,
- 0x6a, 0x65, 0x63, 0x74, 0x20, 0x52, 0x65, 0x67,
- 0x45, 0x78, 0x70, 0x5d, 0x02, 0x64, 0x1a, 0x5b,
- 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x44,
- 0x61, 0x74, 0x65, 0x5d, 0x02, 0x65, 0x1c, 0x5b,
- 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x45,
- 0x72, 0x72, 0x6f, 0x72, 0x5d, 0x02, 0x6f, 0x08,
- 0x70, 0x72, 0x6f, 0x70, 0x08, 0x69, 0x6a, 0x6a,
- 0x73, 0x02, 0x76, 0x14, 0x6e, 0x6f, 0x72, 0x6d,
- 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x64, 0x12, 0x6e,
- 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x65,
- 0x06, 0x4e, 0x46, 0x43, 0x0c, 0x65, 0x6e, 0x63,
+ 0x6e, 0x16, 0x74, 0x6f, 0x55, 0x54, 0x43, 0x53,
+ 0x74, 0x72, 0x69, 0x6e, 0x67, 0x10, 0x5b, 0x4f,
+ 0x62, 0x6a, 0x65, 0x63, 0x74, 0x5d, 0x06, 0x6d,
+ 0x61, 0x70, 0x06, 0x70, 0x6f, 0x70, 0x06, 0x6b,
+ 0x65, 0x79, 0x0c, 0x73, 0x69, 0x6d, 0x70, 0x6c,
+ 0x65, 0x02, 0x27, 0x04, 0x5c, 0x27, 0x02, 0x22,
+ 0x04, 0x2d, 0x30, 0x02, 0x6c, 0x02, 0x0a, 0x0a,
+ 0x6d, 0x61, 0x74, 0x63, 0x68, 0x08, 0x64, 0x65,
+ 0x73, 0x63, 0x1e, 0x5b, 0x47, 0x65, 0x74, 0x74,
+ 0x65, 0x72, 0x2f, 0x53, 0x65, 0x74, 0x74, 0x65,
+ 0x72, 0x5d, 0x10, 0x5b, 0x47, 0x65, 0x74, 0x74,
+ 0x65, 0x72, 0x5d, 0x10, 0x5b, 0x53, 0x65, 0x74,
+ 0x74, 0x65, 0x72, 0x5d, 0x0c, 0x73, 0x75, 0x62,
+ 0x73, 0x74, 0x72, 0x08, 0x6c, 0x69, 0x6e, 0x65,
+ 0x04, 0x20, 0x20, 0x06, 0x20, 0x20, 0x20, 0x16,
+ 0x6e, 0x75, 0x6d, 0x4c, 0x69, 0x6e, 0x65, 0x73,
+ 0x45, 0x73, 0x74, 0x0c, 0x72, 0x65, 0x64, 0x75,
+ 0x63, 0x65, 0x04, 0x0a, 0x20, 0x08, 0x2c, 0x0a,
+ 0x20, 0x20, 0x04, 0x2c, 0x20, 0x08, 0x70, 0x72,
+ 0x65, 0x76, 0x06, 0x63, 0x75, 0x72, 0x04, 0x61,
+ 0x72, 0x06, 0x61, 0x72, 0x67, 0x04, 0x72, 0x65,
+ 0x1e, 0x5b, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74,
+ 0x20, 0x52, 0x65, 0x67, 0x45, 0x78, 0x70, 0x5d,
+ 0x02, 0x64, 0x1a, 0x5b, 0x6f, 0x62, 0x6a, 0x65,
+ 0x63, 0x74, 0x20, 0x44, 0x61, 0x74, 0x65, 0x5d,
+ 0x02, 0x65, 0x1c, 0x5b, 0x6f, 0x62, 0x6a, 0x65,
+ 0x63, 0x74, 0x20, 0x45, 0x72, 0x72, 0x6f, 0x72,
+ 0x5d, 0x02, 0x6f, 0x08, 0x70, 0x72, 0x6f, 0x70,
+ 0x08, 0x69, 0x6a, 0x6a, 0x73, 0x02, 0x76, 0x14,
+ 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a,
+ 0x65, 0x64, 0x12, 0x6e, 0x6f, 0x72, 0x6d, 0x61,
+ 0x6c, 0x69, 0x7a, 0x65, 0x06, 0x4e, 0x46, 0x43,
+ 0x16, 0x54, 0x65, 0x78, 0x74, 0x45, 0x6e, 0x63,
+ 0x6f, 0x64, 0x65, 0x72, 0x0c, 0x65, 0x6e, 0x63,
  0x6f, 0x64, 0x65, 0x14, 0x62, 0x79, 0x74, 0x65,
  0x4c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x06, 0x72,
  0x6f, 0x77, 0x18, 0x63, 0x6f, 0x6c, 0x75, 0x6d,
@@ -1223,75 +1238,74 @@ const uint8_t console[9932] = {
  0x65, 0x0f, 0xc0, 0x03, 0x00, 0x01, 0x00, 0x0b,
  0xc2, 0x03, 0x00, 0x00, 0x0e, 0x00, 0x06, 0x01,
  0xa0, 0x01, 0x00, 0x02, 0x00, 0x03, 0x0c, 0x14,
- 0x9d, 0x02, 0x02, 0xc2, 0x03, 0x02, 0x00, 0x60,
+ 0x95, 0x02, 0x02, 0xc2, 0x03, 0x02, 0x00, 0x60,
  0xea, 0x01, 0x03, 0x01, 0xe0, 0xc4, 0x03, 0x00,
  0x0d, 0xc6, 0x03, 0x01, 0x01, 0xc8, 0x03, 0x02,
  0x01, 0xca, 0x03, 0x03, 0x01, 0xcc, 0x03, 0x04,
- 0x0d, 0xce, 0x03, 0x05, 0x0d, 0xd0, 0x03, 0x06,
+ 0x09, 0xce, 0x03, 0x05, 0x0d, 0xd0, 0x03, 0x06,
  0x0d, 0xd2, 0x03, 0x07, 0x01, 0xd4, 0x03, 0x08,
  0x01, 0xd6, 0x03, 0x09, 0x01, 0xd8, 0x03, 0x0a,
  0x01, 0xc2, 0x03, 0x0b, 0x09, 0xc1, 0x01, 0xe3,
  0xc1, 0x02, 0xe4, 0xc1, 0x03, 0xe5, 0xc1, 0x06,
  0x5f, 0x07, 0x00, 0xc1, 0x07, 0x5f, 0x08, 0x00,
  0xc1, 0x08, 0x5f, 0x09, 0x00, 0xc1, 0x09, 0x5f,
- 0x0a, 0x00, 0xc1, 0x00, 0xef, 0xe2, 0x38, 0xed,
- 0x00, 0x00, 0x00, 0x11, 0x21, 0x00, 0x00, 0x5f,
- 0x04, 0x00, 0x0b, 0x04, 0xee, 0x00, 0x00, 0x00,
- 0x4c, 0xef, 0x00, 0x00, 0x00, 0x04, 0xf0, 0x00,
- 0x00, 0x00, 0x4c, 0xf1, 0x00, 0x00, 0x00, 0x04,
- 0xf2, 0x00, 0x00, 0x00, 0x4c, 0xf3, 0x00, 0x00,
- 0x00, 0x04, 0xf4, 0x00, 0x00, 0x00, 0x4c, 0xf5,
- 0x00, 0x00, 0x00, 0x04, 0xf6, 0x00, 0x00, 0x00,
- 0x4c, 0xf7, 0x00, 0x00, 0x00, 0x04, 0xf8, 0x00,
- 0x00, 0x00, 0x4c, 0xf9, 0x00, 0x00, 0x00, 0x04,
- 0xfa, 0x00, 0x00, 0x00, 0x4c, 0xfb, 0x00, 0x00,
- 0x00, 0x04, 0xfc, 0x00, 0x00, 0x00, 0x4c, 0xfd,
- 0x00, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x00,
- 0x4c, 0xff, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01,
- 0x00, 0x00, 0x4c, 0x01, 0x01, 0x00, 0x00, 0x04,
- 0x02, 0x01, 0x00, 0x00, 0x4c, 0x03, 0x01, 0x00,
- 0x00, 0x04, 0x04, 0x01, 0x00, 0x00, 0x4c, 0x05,
- 0x01, 0x00, 0x00, 0x04, 0x06, 0x01, 0x00, 0x00,
- 0x4c, 0x07, 0x01, 0x00, 0x00, 0x5f, 0x05, 0x00,
+ 0x0a, 0x00, 0xc1, 0x00, 0xef, 0xe2, 0x06, 0x5f,
+ 0x04, 0x00, 0x0b, 0x04, 0xed, 0x00, 0x00, 0x00,
+ 0x4c, 0xee, 0x00, 0x00, 0x00, 0x04, 0xef, 0x00,
+ 0x00, 0x00, 0x4c, 0xf0, 0x00, 0x00, 0x00, 0x04,
+ 0xf1, 0x00, 0x00, 0x00, 0x4c, 0xf2, 0x00, 0x00,
+ 0x00, 0x04, 0xf3, 0x00, 0x00, 0x00, 0x4c, 0xf4,
+ 0x00, 0x00, 0x00, 0x04, 0xf5, 0x00, 0x00, 0x00,
+ 0x4c, 0xf6, 0x00, 0x00, 0x00, 0x04, 0xf7, 0x00,
+ 0x00, 0x00, 0x4c, 0xf8, 0x00, 0x00, 0x00, 0x04,
+ 0xf9, 0x00, 0x00, 0x00, 0x4c, 0xfa, 0x00, 0x00,
+ 0x00, 0x04, 0xfb, 0x00, 0x00, 0x00, 0x4c, 0xfc,
+ 0x00, 0x00, 0x00, 0x04, 0xfd, 0x00, 0x00, 0x00,
+ 0x4c, 0xfe, 0x00, 0x00, 0x00, 0x04, 0xff, 0x00,
+ 0x00, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x00, 0x04,
+ 0x01, 0x01, 0x00, 0x00, 0x4c, 0x02, 0x01, 0x00,
+ 0x00, 0x04, 0x03, 0x01, 0x00, 0x00, 0x4c, 0x04,
+ 0x01, 0x00, 0x00, 0x04, 0x05, 0x01, 0x00, 0x00,
+ 0x4c, 0x06, 0x01, 0x00, 0x00, 0x5f, 0x05, 0x00,
  0xc0, 0x04, 0xc0, 0x05, 0x33, 0x5f, 0x06, 0x00,
  0x61, 0x00, 0x00, 0x06, 0x61, 0x01, 0x00, 0xc0,
  0x13, 0x56, 0xe1, 0x00, 0x00, 0x00, 0x00, 0xc1,
- 0x0a, 0x54, 0x08, 0x01, 0x00, 0x00, 0x00, 0xc1,
- 0x0b, 0x54, 0x09, 0x01, 0x00, 0x00, 0x00, 0xc1,
- 0x0c, 0x54, 0x0a, 0x01, 0x00, 0x00, 0x00, 0xc1,
- 0x0d, 0x54, 0x0b, 0x01, 0x00, 0x00, 0x00, 0xc1,
- 0x0e, 0x54, 0x0c, 0x01, 0x00, 0x00, 0x00, 0xc1,
- 0x0f, 0x54, 0x0d, 0x01, 0x00, 0x00, 0x00, 0xc1,
- 0x10, 0x54, 0x0e, 0x01, 0x00, 0x00, 0x00, 0xc1,
- 0x11, 0x54, 0x0f, 0x01, 0x00, 0x00, 0x00, 0xc1,
- 0x12, 0x54, 0x10, 0x01, 0x00, 0x00, 0x00, 0x06,
+ 0x0a, 0x54, 0x07, 0x01, 0x00, 0x00, 0x00, 0xc1,
+ 0x0b, 0x54, 0x08, 0x01, 0x00, 0x00, 0x00, 0xc1,
+ 0x0c, 0x54, 0x09, 0x01, 0x00, 0x00, 0x00, 0xc1,
+ 0x0d, 0x54, 0x0a, 0x01, 0x00, 0x00, 0x00, 0xc1,
+ 0x0e, 0x54, 0x0b, 0x01, 0x00, 0x00, 0x00, 0xc1,
+ 0x0f, 0x54, 0x0c, 0x01, 0x00, 0x00, 0x00, 0xc1,
+ 0x10, 0x54, 0x0d, 0x01, 0x00, 0x00, 0x00, 0xc1,
+ 0x11, 0x54, 0x0e, 0x01, 0x00, 0x00, 0x00, 0xc1,
+ 0x12, 0x54, 0x0f, 0x01, 0x00, 0x00, 0x00, 0x06,
  0xcb, 0x0e, 0xce, 0x68, 0x01, 0x00, 0x5f, 0x0b,
  0x00, 0x29, 0xc0, 0x03, 0x01, 0x3a, 0x01, 0x00,
- 0x1d, 0xec, 0x05, 0x00, 0x04, 0x24, 0x40, 0x08,
+ 0x1d, 0xec, 0x05, 0x00, 0x04, 0x26, 0x18, 0x08,
  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
  0x35, 0x35, 0x35, 0x35, 0x35, 0x13, 0x00, 0x08,
- 0x88, 0x01, 0x00, 0x0f, 0x08, 0x00, 0x08, 0x08,
+ 0x8e, 0x01, 0x00, 0x0f, 0x08, 0x00, 0x08, 0x08,
  0x00, 0x08, 0x08, 0x00, 0x08, 0x08, 0x00, 0x08,
  0x0c, 0x00, 0x08, 0x08, 0x00, 0x08, 0x08, 0x00,
  0x08, 0xae, 0x01, 0x00, 0x08, 0x14, 0x2b, 0x37,
  0x0e, 0x43, 0x06, 0x01, 0x00, 0x00, 0x1c, 0x00,
- 0x02, 0x00, 0x1d, 0x71, 0x1c, 0xa2, 0x04, 0x00,
- 0x00, 0x80, 0xc4, 0x03, 0x00, 0x01, 0x00, 0xa4,
- 0x04, 0x00, 0x02, 0x80, 0xa6, 0x04, 0x00, 0x03,
- 0x80, 0xa8, 0x04, 0x00, 0x04, 0x80, 0xaa, 0x04,
- 0x00, 0x05, 0x80, 0xac, 0x04, 0x00, 0x06, 0x80,
- 0xae, 0x04, 0x00, 0x07, 0x80, 0xb0, 0x04, 0x00,
- 0x08, 0x80, 0xb2, 0x04, 0x00, 0x09, 0x80, 0xb4,
- 0x04, 0x00, 0x0a, 0x80, 0xb6, 0x04, 0x00, 0x0b,
- 0x80, 0xb8, 0x04, 0x00, 0x0c, 0x80, 0xba, 0x04,
- 0x00, 0x0d, 0x80, 0xbc, 0x04, 0x00, 0x0e, 0x80,
- 0xbe, 0x04, 0x00, 0x0f, 0x80, 0xc0, 0x04, 0x00,
- 0x10, 0x00, 0xc2, 0x04, 0x00, 0x11, 0x80, 0xc4,
- 0x04, 0x00, 0x12, 0x80, 0xc6, 0x04, 0x00, 0x13,
- 0x00, 0xc8, 0x04, 0x00, 0x14, 0x80, 0xca, 0x04,
- 0x00, 0x15, 0x80, 0xcc, 0x04, 0x00, 0x16, 0x80,
- 0xce, 0x04, 0x00, 0x17, 0x80, 0xd0, 0x04, 0x00,
- 0x18, 0x80, 0xd2, 0x04, 0x00, 0x19, 0x80, 0xd4,
+ 0x02, 0x00, 0x1d, 0x71, 0x1c, 0xa0, 0x04, 0x00,
+ 0x00, 0x80, 0xc4, 0x03, 0x00, 0x01, 0x00, 0xa2,
+ 0x04, 0x00, 0x02, 0x80, 0xa4, 0x04, 0x00, 0x03,
+ 0x80, 0xa6, 0x04, 0x00, 0x04, 0x80, 0xa8, 0x04,
+ 0x00, 0x05, 0x80, 0xaa, 0x04, 0x00, 0x06, 0x80,
+ 0xac, 0x04, 0x00, 0x07, 0x80, 0xae, 0x04, 0x00,
+ 0x08, 0x80, 0xb0, 0x04, 0x00, 0x09, 0x80, 0xb2,
+ 0x04, 0x00, 0x0a, 0x80, 0xb4, 0x04, 0x00, 0x0b,
+ 0x80, 0xb6, 0x04, 0x00, 0x0c, 0x80, 0xb8, 0x04,
+ 0x00, 0x0d, 0x80, 0xba, 0x04, 0x00, 0x0e, 0x80,
+ 0xbc, 0x04, 0x00, 0x0f, 0x80, 0xbe, 0x04, 0x00,
+ 0x10, 0x00, 0xc0, 0x04, 0x00, 0x11, 0x80, 0xc2,
+ 0x04, 0x00, 0x12, 0x80, 0xc4, 0x04, 0x00, 0x13,
+ 0x00, 0xc6, 0x04, 0x00, 0x14, 0x80, 0xc8, 0x04,
+ 0x00, 0x15, 0x80, 0xca, 0x04, 0x00, 0x16, 0x80,
+ 0xcc, 0x04, 0x00, 0x17, 0x80, 0xce, 0x04, 0x00,
+ 0x18, 0x80, 0xd0, 0x04, 0x00, 0x19, 0x80, 0xd2,
  0x04, 0x00, 0x1a, 0x80, 0xca, 0x03, 0x00, 0x1b,
  0x80, 0xc1, 0x02, 0xcb, 0xc1, 0x03, 0xcc, 0xc1,
  0x04, 0xcd, 0xc1, 0x05, 0xc4, 0x04, 0xc1, 0x06,
@@ -1317,31 +1331,31 @@ const uint8_t console[9932] = {
  0x64, 0x00, 0x6a, 0x00, 0x6a, 0x00, 0x73, 0x00,
  0x73, 0x00, 0x0c, 0x00, 0x0a, 0x0e, 0x43, 0x06,
  0x01, 0xc4, 0x03, 0x01, 0x07, 0x01, 0x05, 0x05,
- 0x01, 0x9b, 0x01, 0x08, 0xd6, 0x04, 0x00, 0x01,
- 0x00, 0xd8, 0x04, 0x00, 0x00, 0x00, 0xda, 0x04,
- 0x00, 0x01, 0x80, 0xdc, 0x04, 0x00, 0x02, 0x80,
- 0xde, 0x04, 0x00, 0x03, 0x80, 0xe0, 0x04, 0x00,
- 0x04, 0x00, 0xe2, 0x04, 0x00, 0x05, 0x00, 0x9a,
- 0x01, 0x00, 0x01, 0x00, 0xc4, 0x04, 0x12, 0x01,
- 0xa4, 0x04, 0x02, 0x01, 0xa2, 0x04, 0x00, 0x01,
- 0xbe, 0x04, 0x0f, 0x01, 0xcc, 0x04, 0x16, 0x01,
+ 0x01, 0x9b, 0x01, 0x08, 0xd4, 0x04, 0x00, 0x01,
+ 0x00, 0xd6, 0x04, 0x00, 0x00, 0x00, 0xd8, 0x04,
+ 0x00, 0x01, 0x80, 0xda, 0x04, 0x00, 0x02, 0x80,
+ 0xdc, 0x04, 0x00, 0x03, 0x80, 0xde, 0x04, 0x00,
+ 0x04, 0x00, 0xe0, 0x04, 0x00, 0x05, 0x00, 0x9a,
+ 0x01, 0x00, 0x01, 0x00, 0xc2, 0x04, 0x12, 0x01,
+ 0xa2, 0x04, 0x02, 0x01, 0xa0, 0x04, 0x00, 0x01,
+ 0xbc, 0x04, 0x0f, 0x01, 0xca, 0x04, 0x16, 0x01,
  0x0c, 0x00, 0xc4, 0x06, 0xde, 0xd2, 0xf0, 0x97,
  0xeb, 0x31, 0x26, 0x00, 0x00, 0xca, 0xb6, 0xcb,
  0xc7, 0xc3, 0x06, 0xea, 0xa4, 0xeb, 0x16, 0xc6,
- 0x42, 0x32, 0x01, 0x00, 0x00, 0xdf, 0xc3, 0x06,
+ 0x42, 0x31, 0x01, 0x00, 0x00, 0xdf, 0xc3, 0x06,
  0xc7, 0x47, 0x0b, 0xf1, 0x24, 0x01, 0x00, 0x0e,
  0x94, 0x01, 0xed, 0xe5, 0xc6, 0x42, 0x5a, 0x00,
- 0x00, 0x00, 0x04, 0x33, 0x01, 0x00, 0x00, 0x25,
+ 0x00, 0x00, 0x04, 0x32, 0x01, 0x00, 0x00, 0x25,
  0x01, 0x00, 0xb7, 0xcb, 0xc3, 0x06, 0xd0, 0xea,
  0xcd, 0x38, 0x98, 0x00, 0x00, 0x00, 0xd2, 0xf0,
- 0x42, 0x34, 0x01, 0x00, 0x00, 0xe0, 0xc1, 0x00,
+ 0x42, 0x33, 0x01, 0x00, 0x00, 0xe0, 0xc1, 0x00,
  0x24, 0x02, 0x00, 0xc4, 0x04, 0xc8, 0xc7, 0x47,
  0xc4, 0x05, 0xc7, 0xc9, 0xa4, 0xeb, 0x3a, 0xe1,
  0xc3, 0x05, 0xf0, 0x11, 0xec, 0x09, 0x0e, 0x5e,
  0x04, 0x00, 0xc3, 0x05, 0xf0, 0x97, 0xeb, 0x10,
- 0xc3, 0x04, 0x04, 0x33, 0x01, 0x00, 0x00, 0xc3,
+ 0xc3, 0x04, 0x04, 0x32, 0x01, 0x00, 0x00, 0xc3,
  0x05, 0x9e, 0x9e, 0xc4, 0x04, 0xed, 0x11, 0xc3,
- 0x04, 0x04, 0x33, 0x01, 0x00, 0x00, 0xdf, 0xc3,
+ 0x04, 0x04, 0x32, 0x01, 0x00, 0x00, 0xdf, 0xc3,
  0x05, 0x0b, 0xf1, 0x9e, 0x9e, 0xc4, 0x04, 0xc8,
  0xc7, 0x90, 0xcf, 0x47, 0xc4, 0x05, 0xed, 0xc3,
  0xc3, 0x04, 0x28, 0xc0, 0x03, 0x03, 0x14, 0x17,
@@ -1349,139 +1363,139 @@ const uint8_t console[9932] = {
  0x12, 0x00, 0x0d, 0x1e, 0x26, 0x35, 0x58, 0x44,
  0x0d, 0x54, 0x30, 0x0e, 0x43, 0x06, 0x01, 0x00,
  0x01, 0x01, 0x01, 0x07, 0x03, 0x00, 0x75, 0x02,
- 0xe2, 0x04, 0x00, 0x01, 0x00, 0xea, 0x04, 0x06,
- 0x00, 0x03, 0xda, 0x04, 0x01, 0x01, 0xde, 0x04,
- 0x03, 0x01, 0xdc, 0x04, 0x02, 0x01, 0xd2, 0x04,
- 0x36, 0x01, 0x00, 0x00, 0xac, 0xeb, 0x07, 0x04,
- 0x37, 0x01, 0x00, 0x00, 0x28, 0xde, 0xdf, 0xa7,
- 0xeb, 0x03, 0xd2, 0x28, 0xd2, 0x11, 0x04, 0x38,
+ 0xe0, 0x04, 0x00, 0x01, 0x00, 0xe8, 0x04, 0x06,
+ 0x00, 0x03, 0xd8, 0x04, 0x01, 0x01, 0xdc, 0x04,
+ 0x03, 0x01, 0xda, 0x04, 0x02, 0x01, 0xd2, 0x04,
+ 0x35, 0x01, 0x00, 0x00, 0xac, 0xeb, 0x07, 0x04,
+ 0x36, 0x01, 0x00, 0x00, 0x28, 0xde, 0xdf, 0xa7,
+ 0xeb, 0x03, 0xd2, 0x28, 0xd2, 0x11, 0x04, 0x37,
  0x01, 0x00, 0x00, 0xac, 0xeb, 0x0e, 0x38, 0x98,
  0x00, 0x00, 0x00, 0xe0, 0xde, 0x92, 0xe2, 0x47,
- 0x23, 0x01, 0x00, 0x11, 0x04, 0x39, 0x01, 0x00,
+ 0x23, 0x01, 0x00, 0x11, 0x04, 0x38, 0x01, 0x00,
  0x00, 0xac, 0xeb, 0x0e, 0x38, 0x97, 0x00, 0x00,
  0x00, 0xe0, 0xde, 0x92, 0xe2, 0x47, 0x23, 0x01,
- 0x00, 0x11, 0x04, 0x3a, 0x01, 0x00, 0x00, 0xac,
+ 0x00, 0x11, 0x04, 0x39, 0x01, 0x00, 0x00, 0xac,
  0xeb, 0x28, 0x6c, 0x18, 0x00, 0x00, 0x00, 0x38,
- 0x9d, 0x00, 0x00, 0x00, 0x42, 0x3b, 0x01, 0x00,
+ 0x9d, 0x00, 0x00, 0x00, 0x42, 0x3a, 0x01, 0x00,
  0x00, 0xe0, 0xde, 0x92, 0xe2, 0x47, 0x24, 0x01,
  0x00, 0x0f, 0x28, 0xca, 0x6c, 0x0b, 0x00, 0x00,
- 0x00, 0x04, 0x3c, 0x01, 0x00, 0x00, 0x0f, 0x28,
+ 0x00, 0x04, 0x3b, 0x01, 0x00, 0x00, 0x0f, 0x28,
  0x2f, 0xd2, 0x28, 0xc0, 0x03, 0x0f, 0x0d, 0x03,
  0x4e, 0x26, 0x08, 0x71, 0x71, 0x30, 0x1c, 0x62,
  0x26, 0x21, 0x08, 0x08, 0x0e, 0x43, 0x06, 0x01,
- 0xa4, 0x04, 0x02, 0x01, 0x02, 0x04, 0x02, 0x00,
- 0x1c, 0x03, 0xfa, 0x04, 0x00, 0x01, 0x00, 0xfc,
- 0x04, 0x00, 0x01, 0x00, 0xfe, 0x04, 0x00, 0x00,
- 0x00, 0xa6, 0x04, 0x03, 0x01, 0xaa, 0x04, 0x05,
- 0x01, 0x0b, 0x26, 0x00, 0x00, 0x4c, 0x40, 0x01,
- 0x00, 0x00, 0xde, 0x4c, 0x41, 0x01, 0x00, 0x00,
- 0xca, 0xdf, 0xc6, 0xd2, 0xd3, 0x41, 0x42, 0x01,
+ 0xa2, 0x04, 0x02, 0x01, 0x02, 0x04, 0x02, 0x00,
+ 0x1c, 0x03, 0xf8, 0x04, 0x00, 0x01, 0x00, 0xfa,
+ 0x04, 0x00, 0x01, 0x00, 0xfc, 0x04, 0x00, 0x00,
+ 0x00, 0xa4, 0x04, 0x03, 0x01, 0xa8, 0x04, 0x05,
+ 0x01, 0x0b, 0x26, 0x00, 0x00, 0x4c, 0x3f, 0x01,
+ 0x00, 0x00, 0xde, 0x4c, 0x40, 0x01, 0x00, 0x00,
+ 0xca, 0xdf, 0xc6, 0xd2, 0xd3, 0x41, 0x41, 0x01,
  0x00, 0x00, 0x23, 0x03, 0x00, 0xc0, 0x03, 0x29,
  0x05, 0x03, 0x08, 0x2b, 0x21, 0x08, 0x0e, 0x43,
- 0x06, 0x01, 0xa6, 0x04, 0x02, 0x00, 0x02, 0x01,
- 0x00, 0x00, 0x02, 0x02, 0xe0, 0x04, 0x00, 0x01,
- 0x00, 0x86, 0x05, 0x00, 0x01, 0x00, 0xd2, 0x28,
+ 0x06, 0x01, 0xa4, 0x04, 0x02, 0x00, 0x02, 0x01,
+ 0x00, 0x00, 0x02, 0x02, 0xde, 0x04, 0x00, 0x01,
+ 0x00, 0x84, 0x05, 0x00, 0x01, 0x00, 0xd2, 0x28,
  0xc0, 0x03, 0x31, 0x01, 0x03, 0x0e, 0x43, 0x06,
- 0x01, 0xa8, 0x04, 0x01, 0x01, 0x01, 0x03, 0x00,
- 0x01, 0x10, 0x02, 0x88, 0x05, 0x00, 0x01, 0x00,
- 0x8a, 0x05, 0x00, 0x00, 0x80, 0x0b, 0xca, 0xd2,
- 0x42, 0x46, 0x01, 0x00, 0x00, 0xc1, 0x00, 0x24,
+ 0x01, 0xa6, 0x04, 0x01, 0x01, 0x01, 0x03, 0x00,
+ 0x01, 0x10, 0x02, 0x86, 0x05, 0x00, 0x01, 0x00,
+ 0x88, 0x05, 0x00, 0x00, 0x80, 0x0b, 0xca, 0xd2,
+ 0x42, 0x45, 0x01, 0x00, 0x00, 0xc1, 0x00, 0x24,
  0x01, 0x00, 0x0e, 0xc6, 0x28, 0xc0, 0x03, 0x35,
  0x04, 0x03, 0x0e, 0x22, 0x22, 0x0e, 0x43, 0x06,
  0x01, 0x00, 0x02, 0x00, 0x02, 0x03, 0x01, 0x00,
- 0x05, 0x02, 0x8e, 0x05, 0x00, 0x01, 0x00, 0x90,
- 0x05, 0x00, 0x01, 0x00, 0x8a, 0x05, 0x00, 0x01,
+ 0x05, 0x02, 0x8c, 0x05, 0x00, 0x01, 0x00, 0x8e,
+ 0x05, 0x00, 0x01, 0x00, 0x88, 0x05, 0x00, 0x01,
  0xde, 0xd2, 0x0a, 0x49, 0x29, 0xc0, 0x03, 0x38,
- 0x02, 0x03, 0x17, 0x0e, 0x43, 0x06, 0x01, 0xaa,
+ 0x02, 0x03, 0x17, 0x0e, 0x43, 0x06, 0x01, 0xa8,
  0x04, 0x03, 0x09, 0x03, 0x06, 0x0b, 0x01, 0xe5,
- 0x04, 0x0c, 0xfe, 0x04, 0x00, 0x01, 0x80, 0x80,
- 0x01, 0x00, 0x01, 0x80, 0x92, 0x05, 0x00, 0x01,
- 0x80, 0x94, 0x05, 0x00, 0x00, 0x00, 0x96, 0x05,
- 0x00, 0x01, 0x00, 0x98, 0x05, 0x00, 0x02, 0x80,
- 0x6c, 0x00, 0x03, 0x00, 0x9a, 0x05, 0x00, 0x04,
- 0x00, 0x88, 0x05, 0x00, 0x05, 0x80, 0x9c, 0x05,
- 0x00, 0x06, 0x00, 0x9e, 0x05, 0x00, 0x07, 0x00,
- 0xa0, 0x05, 0x00, 0x08, 0x00, 0xb2, 0x04, 0x09,
- 0x01, 0xac, 0x04, 0x06, 0x01, 0xa8, 0x04, 0x04,
- 0x01, 0xd0, 0x04, 0x18, 0x01, 0xae, 0x04, 0x07,
- 0x01, 0xd2, 0x04, 0x19, 0x01, 0xca, 0x04, 0x15,
- 0x01, 0xce, 0x04, 0x17, 0x01, 0xb6, 0x04, 0x0b,
- 0x01, 0xb0, 0x04, 0x08, 0x01, 0xb4, 0x04, 0x0a,
+ 0x04, 0x0c, 0xfc, 0x04, 0x00, 0x01, 0x80, 0x80,
+ 0x01, 0x00, 0x01, 0x80, 0x90, 0x05, 0x00, 0x01,
+ 0x80, 0x92, 0x05, 0x00, 0x00, 0x00, 0x94, 0x05,
+ 0x00, 0x01, 0x00, 0x96, 0x05, 0x00, 0x02, 0x80,
+ 0x6c, 0x00, 0x03, 0x00, 0x98, 0x05, 0x00, 0x04,
+ 0x00, 0x86, 0x05, 0x00, 0x05, 0x80, 0x9a, 0x05,
+ 0x00, 0x06, 0x00, 0x9c, 0x05, 0x00, 0x07, 0x00,
+ 0x9e, 0x05, 0x00, 0x08, 0x00, 0xb0, 0x04, 0x09,
+ 0x01, 0xaa, 0x04, 0x06, 0x01, 0xa6, 0x04, 0x04,
+ 0x01, 0xce, 0x04, 0x18, 0x01, 0xac, 0x04, 0x07,
+ 0x01, 0xd0, 0x04, 0x19, 0x01, 0xc8, 0x04, 0x15,
+ 0x01, 0xcc, 0x04, 0x17, 0x01, 0xb4, 0x04, 0x0b,
+ 0x01, 0xae, 0x04, 0x08, 0x01, 0xb2, 0x04, 0x0a,
  0x01, 0xdf, 0xd2, 0xd3, 0xf1, 0xce, 0xeb, 0x03,
  0xc6, 0x28, 0x38, 0x94, 0x00, 0x00, 0x00, 0x42,
- 0x4b, 0x01, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00,
+ 0x4a, 0x01, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00,
  0xcb, 0xe0, 0xc7, 0xf0, 0xcc, 0xe1, 0xd3, 0xf0,
- 0xeb, 0x2e, 0xc7, 0x42, 0x51, 0x01, 0x00, 0x00,
+ 0xeb, 0x2e, 0xc7, 0x42, 0x50, 0x01, 0x00, 0x00,
  0x04, 0x33, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00,
  0xb6, 0xa7, 0x11, 0xec, 0x12, 0x0e, 0xc7, 0x42,
- 0x51, 0x01, 0x00, 0x00, 0x04, 0x52, 0x01, 0x00,
+ 0x50, 0x01, 0x00, 0x00, 0x04, 0x51, 0x01, 0x00,
  0x00, 0x24, 0x01, 0x00, 0xb6, 0xa7, 0xeb, 0x08,
  0x5e, 0x04, 0x00, 0xd3, 0x23, 0x01, 0x00, 0xc7,
  0xea, 0xb6, 0xac, 0x69, 0xa4, 0x00, 0x00, 0x00,
  0x5e, 0x05, 0x00, 0xd3, 0xf0, 0xeb, 0x34, 0xd3,
  0x41, 0x36, 0x00, 0x00, 0x00, 0xeb, 0x0f, 0x04,
- 0x53, 0x01, 0x00, 0x00, 0xd3, 0x41, 0x36, 0x00,
+ 0x52, 0x01, 0x00, 0x00, 0xd3, 0x41, 0x36, 0x00,
  0x00, 0x00, 0x9e, 0xed, 0x02, 0xc2, 0xcd, 0xd2,
- 0x42, 0x41, 0x01, 0x00, 0x00, 0x04, 0x54, 0x01,
- 0x00, 0x00, 0xc9, 0x9e, 0x04, 0x55, 0x01, 0x00,
- 0x00, 0x9e, 0x04, 0x56, 0x01, 0x00, 0x00, 0x25,
+ 0x42, 0x40, 0x01, 0x00, 0x00, 0x04, 0x53, 0x01,
+ 0x00, 0x00, 0xc9, 0x9e, 0x04, 0x54, 0x01, 0x00,
+ 0x00, 0x9e, 0x04, 0x55, 0x01, 0x00, 0x00, 0x25,
  0x02, 0x00, 0x5e, 0x06, 0x00, 0xd3, 0xf0, 0xeb,
- 0x27, 0xd2, 0x42, 0x41, 0x01, 0x00, 0x00, 0x38,
+ 0x27, 0xd2, 0x42, 0x40, 0x01, 0x00, 0x00, 0x38,
  0xa2, 0x00, 0x00, 0x00, 0x41, 0x3b, 0x00, 0x00,
- 0x00, 0x41, 0x37, 0x00, 0x00, 0x00, 0x42, 0x57,
+ 0x00, 0x41, 0x37, 0x00, 0x00, 0x00, 0x42, 0x56,
  0x01, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00, 0x04,
- 0x58, 0x01, 0x00, 0x00, 0x25, 0x02, 0x00, 0x5e,
+ 0x57, 0x01, 0x00, 0x00, 0x25, 0x02, 0x00, 0x5e,
  0x07, 0x00, 0xd3, 0xf0, 0xeb, 0x27, 0xd2, 0x42,
- 0x41, 0x01, 0x00, 0x00, 0x38, 0x9e, 0x00, 0x00,
+ 0x40, 0x01, 0x00, 0x00, 0x38, 0x9e, 0x00, 0x00,
  0x00, 0x41, 0x3b, 0x00, 0x00, 0x00, 0x41, 0x37,
- 0x00, 0x00, 0x00, 0x42, 0x57, 0x01, 0x00, 0x00,
- 0xd3, 0x24, 0x01, 0x00, 0x04, 0x59, 0x01, 0x00,
+ 0x00, 0x00, 0x00, 0x42, 0x56, 0x01, 0x00, 0x00,
+ 0xd3, 0x24, 0x01, 0x00, 0x04, 0x58, 0x01, 0x00,
  0x00, 0x25, 0x02, 0x00, 0xe1, 0xd3, 0xf0, 0xeb,
  0x08, 0x5e, 0x04, 0x00, 0xd3, 0x23, 0x01, 0x00,
- 0xc2, 0xc4, 0x04, 0x09, 0xc4, 0x05, 0x04, 0x5a,
- 0x01, 0x00, 0x00, 0x04, 0x5b, 0x01, 0x00, 0x00,
+ 0xc2, 0xc4, 0x04, 0x09, 0xc4, 0x05, 0x04, 0x59,
+ 0x01, 0x00, 0x00, 0x04, 0x5a, 0x01, 0x00, 0x00,
  0x26, 0x02, 0x00, 0xc4, 0x06, 0x5e, 0x08, 0x00,
  0xd3, 0xf0, 0xeb, 0x13, 0x0a, 0xc4, 0x05, 0x04,
- 0x5c, 0x01, 0x00, 0x00, 0x04, 0x55, 0x01, 0x00,
+ 0x5b, 0x01, 0x00, 0x00, 0x04, 0x54, 0x01, 0x00,
  0x00, 0x26, 0x02, 0x00, 0xc4, 0x06, 0x5e, 0x05,
  0x00, 0xd3, 0xf0, 0xeb, 0x2a, 0xd3, 0x41, 0x36,
- 0x00, 0x00, 0x00, 0xeb, 0x0f, 0x04, 0x53, 0x01,
+ 0x00, 0x00, 0x00, 0xeb, 0x0f, 0x04, 0x52, 0x01,
  0x00, 0x00, 0xd3, 0x41, 0x36, 0x00, 0x00, 0x00,
- 0x9e, 0xed, 0x02, 0xc2, 0xc4, 0x07, 0x04, 0x5d,
- 0x01, 0x00, 0x00, 0xc3, 0x07, 0x9e, 0x04, 0x55,
+ 0x9e, 0xed, 0x02, 0xc2, 0xc4, 0x07, 0x04, 0x5c,
+ 0x01, 0x00, 0x00, 0xc3, 0x07, 0x9e, 0x04, 0x54,
  0x01, 0x00, 0x00, 0x9e, 0xc4, 0x04, 0x5e, 0x06,
- 0x00, 0xd3, 0xf0, 0xeb, 0x21, 0x04, 0x33, 0x01,
+ 0x00, 0xd3, 0xf0, 0xeb, 0x21, 0x04, 0x32, 0x01,
  0x00, 0x00, 0x38, 0xa2, 0x00, 0x00, 0x00, 0x41,
  0x3b, 0x00, 0x00, 0x00, 0x41, 0x37, 0x00, 0x00,
- 0x00, 0x42, 0x57, 0x01, 0x00, 0x00, 0xd3, 0x24,
+ 0x00, 0x42, 0x56, 0x01, 0x00, 0x00, 0xd3, 0x24,
  0x01, 0x00, 0x9e, 0xc4, 0x04, 0x5e, 0x07, 0x00,
- 0xd3, 0xf0, 0xeb, 0x21, 0x04, 0x33, 0x01, 0x00,
+ 0xd3, 0xf0, 0xeb, 0x21, 0x04, 0x32, 0x01, 0x00,
  0x00, 0x38, 0x9e, 0x00, 0x00, 0x00, 0x41, 0x3b,
- 0x00, 0x00, 0x00, 0x41, 0x5e, 0x01, 0x00, 0x00,
- 0x42, 0x57, 0x01, 0x00, 0x00, 0xd3, 0x24, 0x01,
+ 0x00, 0x00, 0x00, 0x41, 0x5d, 0x01, 0x00, 0x00,
+ 0x42, 0x56, 0x01, 0x00, 0x00, 0xd3, 0x24, 0x01,
  0x00, 0x9e, 0xc4, 0x04, 0xe1, 0xd3, 0xf0, 0xeb,
- 0x0e, 0x04, 0x33, 0x01, 0x00, 0x00, 0x5e, 0x04,
+ 0x0e, 0x04, 0x32, 0x01, 0x00, 0x00, 0x5e, 0x04,
  0x00, 0xd3, 0xf0, 0x9e, 0xc4, 0x04, 0xc7, 0xea,
  0xb6, 0xac, 0xeb, 0x1b, 0xc3, 0x05, 0x97, 0x11,
  0xec, 0x06, 0x0e, 0xd3, 0xea, 0xb6, 0xaa, 0xeb,
  0x0e, 0xc3, 0x06, 0xb6, 0x47, 0xc3, 0x04, 0x9e,
  0xc3, 0x06, 0xb7, 0x47, 0x9e, 0x28, 0xd4, 0xb6,
  0xa4, 0xeb, 0x41, 0x5e, 0x06, 0x00, 0xd3, 0xf0,
- 0xeb, 0x27, 0xd2, 0x42, 0x41, 0x01, 0x00, 0x00,
+ 0xeb, 0x27, 0xd2, 0x42, 0x40, 0x01, 0x00, 0x00,
  0x38, 0xa2, 0x00, 0x00, 0x00, 0x41, 0x3b, 0x00,
  0x00, 0x00, 0x41, 0x37, 0x00, 0x00, 0x00, 0x42,
- 0x57, 0x01, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00,
- 0x04, 0x58, 0x01, 0x00, 0x00, 0x25, 0x02, 0x00,
- 0xd2, 0x42, 0x41, 0x01, 0x00, 0x00, 0x04, 0x5f,
- 0x01, 0x00, 0x00, 0x04, 0x56, 0x01, 0x00, 0x00,
- 0x25, 0x02, 0x00, 0xd2, 0x41, 0x40, 0x01, 0x00,
- 0x00, 0x42, 0x32, 0x01, 0x00, 0x00, 0xd3, 0x24,
+ 0x56, 0x01, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00,
+ 0x04, 0x57, 0x01, 0x00, 0x00, 0x25, 0x02, 0x00,
+ 0xd2, 0x42, 0x40, 0x01, 0x00, 0x00, 0x04, 0x5e,
+ 0x01, 0x00, 0x00, 0x04, 0x55, 0x01, 0x00, 0x00,
+ 0x25, 0x02, 0x00, 0xd2, 0x41, 0x3f, 0x01, 0x00,
+ 0x00, 0x42, 0x31, 0x01, 0x00, 0x00, 0xd3, 0x24,
  0x01, 0x00, 0x0e, 0xc3, 0x05, 0xeb, 0x10, 0x5e,
  0x09, 0x00, 0xd2, 0xd3, 0xd4, 0xc8, 0xc7, 0x22,
  0x05, 0x00, 0xc4, 0x08, 0xed, 0x0e, 0xc7, 0x42,
- 0x60, 0x01, 0x00, 0x00, 0xc1, 0x00, 0x24, 0x01,
- 0x00, 0xc4, 0x08, 0xd2, 0x41, 0x40, 0x01, 0x00,
- 0x00, 0x42, 0x61, 0x01, 0x00, 0x00, 0x24, 0x00,
+ 0x5f, 0x01, 0x00, 0x00, 0xc1, 0x00, 0x24, 0x01,
+ 0x00, 0xc4, 0x08, 0xd2, 0x41, 0x3f, 0x01, 0x00,
+ 0x00, 0x42, 0x60, 0x01, 0x00, 0x00, 0x24, 0x00,
  0x00, 0x0e, 0x5e, 0x0a, 0x00, 0xc3, 0x08, 0xc3,
  0x04, 0xc3, 0x06, 0x23, 0x03, 0x00, 0xc0, 0x03,
  0x3f, 0x38, 0x03, 0x17, 0x12, 0x08, 0x08, 0x4e,
@@ -1492,54 +1506,54 @@ const uint8_t console[9932] = {
  0x62, 0x3f, 0x09, 0x1c, 0x26, 0xc2, 0x00, 0x13,
  0x08, 0x55, 0x17, 0x44, 0x0d, 0x00, 0x06, 0x12,
  0x28, 0x4f, 0x0e, 0x43, 0x06, 0x01, 0x00, 0x01,
- 0x00, 0x01, 0x07, 0x06, 0x00, 0x0e, 0x01, 0xc4,
- 0x05, 0x00, 0x01, 0x00, 0xb2, 0x04, 0x00, 0x00,
- 0xfe, 0x04, 0x00, 0x03, 0x80, 0x01, 0x01, 0x03,
- 0x92, 0x05, 0x02, 0x03, 0x98, 0x05, 0x02, 0x01,
- 0x88, 0x05, 0x05, 0x01, 0xde, 0xdf, 0xe0, 0xe1,
+ 0x00, 0x01, 0x07, 0x06, 0x00, 0x0e, 0x01, 0xc2,
+ 0x05, 0x00, 0x01, 0x00, 0xb0, 0x04, 0x00, 0x00,
+ 0xfc, 0x04, 0x00, 0x03, 0x80, 0x01, 0x01, 0x03,
+ 0x90, 0x05, 0x02, 0x03, 0x96, 0x05, 0x02, 0x01,
+ 0x86, 0x05, 0x05, 0x01, 0xde, 0xdf, 0xe0, 0xe1,
  0x5e, 0x04, 0x00, 0xd2, 0x5e, 0x05, 0x00, 0x23,
  0x06, 0x00, 0xc0, 0x03, 0x88, 0x01, 0x08, 0x03,
  0x08, 0x08, 0x08, 0x08, 0x12, 0x08, 0x12, 0x0e,
- 0x43, 0x06, 0x01, 0xac, 0x04, 0x02, 0x01, 0x02,
- 0x05, 0x07, 0x07, 0x93, 0x02, 0x03, 0xfe, 0x04,
+ 0x43, 0x06, 0x01, 0xaa, 0x04, 0x02, 0x01, 0x02,
+ 0x05, 0x07, 0x07, 0x93, 0x02, 0x03, 0xfc, 0x04,
  0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00,
- 0xc6, 0x05, 0x00, 0x00, 0x00, 0xc8, 0x04, 0x14,
- 0x01, 0xc4, 0x04, 0x12, 0x01, 0xc2, 0x04, 0x11,
- 0x01, 0xbc, 0x04, 0x0e, 0x01, 0xbe, 0x04, 0x0f,
- 0x01, 0xb8, 0x04, 0x0c, 0x01, 0xba, 0x04, 0x0d,
+ 0xc4, 0x05, 0x00, 0x00, 0x00, 0xc6, 0x04, 0x14,
+ 0x01, 0xc2, 0x04, 0x12, 0x01, 0xc0, 0x04, 0x11,
+ 0x01, 0xba, 0x04, 0x0e, 0x01, 0xbc, 0x04, 0x0f,
+ 0x01, 0xb6, 0x04, 0x0c, 0x01, 0xb8, 0x04, 0x0d,
  0x01, 0xde, 0xd3, 0xf0, 0xeb, 0x14, 0xd2, 0x42,
- 0x41, 0x01, 0x00, 0x00, 0x04, 0x45, 0x00, 0x00,
+ 0x40, 0x01, 0x00, 0x00, 0x04, 0x45, 0x00, 0x00,
  0x00, 0x04, 0x45, 0x00, 0x00, 0x00, 0x25, 0x02,
- 0x00, 0xdf, 0xd3, 0xf0, 0xeb, 0x5d, 0x04, 0x64,
+ 0x00, 0xdf, 0xd3, 0xf0, 0xeb, 0x5d, 0x04, 0x63,
  0x01, 0x00, 0x00, 0x38, 0x9d, 0x00, 0x00, 0x00,
- 0x42, 0x3b, 0x01, 0x00, 0x00, 0xd3, 0x24, 0x01,
- 0x00, 0x42, 0x34, 0x01, 0x00, 0x00, 0xc0, 0x00,
+ 0x42, 0x3a, 0x01, 0x00, 0x00, 0xd3, 0x24, 0x01,
+ 0x00, 0x42, 0x33, 0x01, 0x00, 0x00, 0xc0, 0x00,
  0xc0, 0x01, 0x33, 0xc2, 0x24, 0x02, 0x00, 0x42,
- 0x34, 0x01, 0x00, 0x00, 0xc0, 0x02, 0xc0, 0x03,
- 0x33, 0x04, 0x65, 0x01, 0x00, 0x00, 0x24, 0x02,
- 0x00, 0x42, 0x34, 0x01, 0x00, 0x00, 0xc0, 0x04,
- 0xc0, 0x05, 0x33, 0x04, 0x66, 0x01, 0x00, 0x00,
- 0x24, 0x02, 0x00, 0x9e, 0x04, 0x64, 0x01, 0x00,
- 0x00, 0x9e, 0xca, 0xd2, 0x42, 0x41, 0x01, 0x00,
+ 0x33, 0x01, 0x00, 0x00, 0xc0, 0x02, 0xc0, 0x03,
+ 0x33, 0x04, 0x64, 0x01, 0x00, 0x00, 0x24, 0x02,
+ 0x00, 0x42, 0x33, 0x01, 0x00, 0x00, 0xc0, 0x04,
+ 0xc0, 0x05, 0x33, 0x04, 0x65, 0x01, 0x00, 0x00,
+ 0x24, 0x02, 0x00, 0x9e, 0x04, 0x63, 0x01, 0x00,
+ 0x00, 0x9e, 0xca, 0xd2, 0x42, 0x40, 0x01, 0x00,
  0x00, 0xc6, 0x04, 0x48, 0x00, 0x00, 0x00, 0x25,
  0x02, 0x00, 0xe0, 0xd3, 0xf0, 0xeb, 0x29, 0xd3,
  0xb6, 0xaa, 0xeb, 0x13, 0xb7, 0xd3, 0x9c, 0xb6,
- 0xa4, 0xeb, 0x09, 0x04, 0x67, 0x01, 0x00, 0x00,
+ 0xa4, 0xeb, 0x09, 0x04, 0x66, 0x01, 0x00, 0x00,
  0xd7, 0xed, 0x04, 0xc0, 0x06, 0xd7, 0xd2, 0x42,
- 0x41, 0x01, 0x00, 0x00, 0xc2, 0xd3, 0x9e, 0x04,
+ 0x40, 0x01, 0x00, 0x00, 0xc2, 0xd3, 0x9e, 0x04,
  0x46, 0x00, 0x00, 0x00, 0x25, 0x02, 0x00, 0xe1,
- 0xd3, 0xf0, 0xeb, 0x12, 0xd2, 0x42, 0x41, 0x01,
+ 0xd3, 0xf0, 0xeb, 0x12, 0xd2, 0x42, 0x40, 0x01,
  0x00, 0x00, 0xc2, 0xd3, 0x9e, 0x04, 0x47, 0x00,
  0x00, 0x00, 0x25, 0x02, 0x00, 0x5e, 0x04, 0x00,
- 0xd3, 0xf0, 0xeb, 0x14, 0xd2, 0x42, 0x41, 0x01,
+ 0xd3, 0xf0, 0xeb, 0x14, 0xd2, 0x42, 0x40, 0x01,
  0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x04,
  0x01, 0x00, 0x00, 0x00, 0x25, 0x02, 0x00, 0x5e,
  0x05, 0x00, 0xd3, 0xf0, 0xeb, 0x18, 0xd2, 0x42,
- 0x41, 0x01, 0x00, 0x00, 0xc2, 0xd3, 0x9e, 0x04,
- 0x4f, 0x01, 0x00, 0x00, 0x9e, 0x04, 0x8a, 0x00,
+ 0x40, 0x01, 0x00, 0x00, 0xc2, 0xd3, 0x9e, 0x04,
+ 0x4e, 0x01, 0x00, 0x00, 0x9e, 0x04, 0x8a, 0x00,
  0x00, 0x00, 0x25, 0x02, 0x00, 0x5e, 0x06, 0x00,
- 0xd3, 0xf0, 0xeb, 0x18, 0xd2, 0x42, 0x41, 0x01,
- 0x00, 0x00, 0xc2, 0xd3, 0x9e, 0x04, 0x68, 0x01,
+ 0xd3, 0xf0, 0xeb, 0x18, 0xd2, 0x42, 0x40, 0x01,
+ 0x00, 0x00, 0xc2, 0xd3, 0x9e, 0x04, 0x67, 0x01,
  0x00, 0x00, 0x9e, 0x04, 0x8b, 0x00, 0x00, 0x00,
  0x25, 0x02, 0x00, 0x29, 0xc0, 0x03, 0x99, 0x01,
  0x14, 0x03, 0x7b, 0x1c, 0x1d, 0x49, 0x49, 0x5d,
@@ -1560,44 +1574,44 @@ const uint8_t console[9932] = {
  0x00, 0x04, 0x07, 0xf5, 0xff, 0xff, 0xff, 0x0b,
  0x00, 0x01, 0x5c, 0x00, 0x01, 0x22, 0x00, 0x0c,
  0x00, 0x0a, 0x07, 0x02, 0x30, 0x0e, 0x43, 0x06,
- 0x01, 0xae, 0x04, 0x01, 0x00, 0x01, 0x05, 0x00,
+ 0x01, 0xac, 0x04, 0x01, 0x00, 0x01, 0x05, 0x00,
  0x00, 0x2c, 0x01, 0x80, 0x01, 0x00, 0x01, 0x00,
  0xc2, 0x42, 0x5b, 0x00, 0x00, 0x00, 0x38, 0x96,
  0x00, 0x00, 0x00, 0x41, 0x3b, 0x00, 0x00, 0x00,
- 0x41, 0x37, 0x00, 0x00, 0x00, 0x42, 0x57, 0x01,
- 0x00, 0x00, 0xd2, 0x24, 0x01, 0x00, 0x04, 0x69,
+ 0x41, 0x37, 0x00, 0x00, 0x00, 0x42, 0x56, 0x01,
+ 0x00, 0x00, 0xd2, 0x24, 0x01, 0x00, 0x04, 0x68,
  0x01, 0x00, 0x00, 0xd2, 0x41, 0x35, 0x00, 0x00,
  0x00, 0x25, 0x03, 0x00, 0xc0, 0x03, 0xb4, 0x01,
- 0x01, 0x03, 0x0e, 0x43, 0x06, 0x01, 0xb0, 0x04,
+ 0x01, 0x03, 0x0e, 0x43, 0x06, 0x01, 0xae, 0x04,
  0x05, 0x03, 0x05, 0x09, 0x02, 0x01, 0x55, 0x08,
- 0xfe, 0x04, 0x00, 0x01, 0x80, 0x80, 0x01, 0x00,
- 0x01, 0x80, 0x92, 0x05, 0x00, 0x01, 0x80, 0x98,
- 0x05, 0x00, 0x01, 0x80, 0x96, 0x05, 0x00, 0x01,
- 0x00, 0xa0, 0x05, 0x00, 0x00, 0x80, 0xda, 0x04,
- 0x00, 0x01, 0x00, 0xd0, 0x05, 0x00, 0x02, 0x00,
- 0xb2, 0x04, 0x09, 0x01, 0xca, 0x03, 0x1b, 0x01,
+ 0xfc, 0x04, 0x00, 0x01, 0x80, 0x80, 0x01, 0x00,
+ 0x01, 0x80, 0x90, 0x05, 0x00, 0x01, 0x80, 0x96,
+ 0x05, 0x00, 0x01, 0x80, 0x94, 0x05, 0x00, 0x01,
+ 0x00, 0x9e, 0x05, 0x00, 0x00, 0x80, 0xd8, 0x04,
+ 0x00, 0x01, 0x00, 0xce, 0x05, 0x00, 0x02, 0x00,
+ 0xb0, 0x04, 0x09, 0x01, 0xca, 0x03, 0x1b, 0x01,
  0x26, 0x00, 0x00, 0xca, 0xb6, 0xcb, 0xd3, 0xea,
  0xcc, 0xc7, 0xc8, 0xa4, 0xeb, 0x38, 0xdf, 0xd3,
  0x38, 0x98, 0x00, 0x00, 0x00, 0xc7, 0xf0, 0xf1,
- 0xeb, 0x1d, 0xc6, 0x42, 0x32, 0x01, 0x00, 0x00,
+ 0xeb, 0x1d, 0xc6, 0x42, 0x31, 0x01, 0x00, 0x00,
  0xde, 0xd2, 0xd3, 0xd4, 0xd5, 0x38, 0x98, 0x00,
  0x00, 0x00, 0xc7, 0xf0, 0x0a, 0x22, 0x06, 0x00,
  0x24, 0x01, 0x00, 0x0e, 0xed, 0x0c, 0xc6, 0x42,
- 0x32, 0x01, 0x00, 0x00, 0xc2, 0x24, 0x01, 0x00,
+ 0x31, 0x01, 0x00, 0x00, 0xc2, 0x24, 0x01, 0x00,
  0x0e, 0x94, 0x01, 0xed, 0xc5, 0x5b, 0x04, 0x00,
- 0x42, 0x46, 0x01, 0x00, 0x00, 0xc1, 0x00, 0x24,
+ 0x42, 0x45, 0x01, 0x00, 0x00, 0xc1, 0x00, 0x24,
  0x01, 0x00, 0x0e, 0xc6, 0x28, 0xc0, 0x03, 0xb8,
  0x01, 0x15, 0x03, 0x17, 0x35, 0x3f, 0x21, 0x08,
  0x08, 0x08, 0x08, 0x08, 0x26, 0x08, 0x12, 0x17,
  0x0d, 0x3b, 0x17, 0x00, 0x08, 0x0c, 0x21, 0x0e,
  0x43, 0x06, 0x01, 0x00, 0x01, 0x00, 0x01, 0x09,
- 0x06, 0x02, 0x2a, 0x01, 0xc4, 0x05, 0x00, 0x01,
- 0x00, 0xa0, 0x05, 0x00, 0x01, 0xb2, 0x04, 0x00,
- 0x00, 0xfe, 0x04, 0x00, 0x03, 0x80, 0x01, 0x01,
- 0x03, 0x92, 0x05, 0x02, 0x03, 0x98, 0x05, 0x03,
- 0x03, 0xd2, 0x42, 0x6a, 0x01, 0x00, 0x00, 0xc0,
+ 0x06, 0x02, 0x2a, 0x01, 0xc2, 0x05, 0x00, 0x01,
+ 0x00, 0x9e, 0x05, 0x00, 0x01, 0xb0, 0x04, 0x00,
+ 0x00, 0xfc, 0x04, 0x00, 0x03, 0x80, 0x01, 0x01,
+ 0x03, 0x90, 0x05, 0x02, 0x03, 0x96, 0x05, 0x03,
+ 0x03, 0xd2, 0x42, 0x69, 0x01, 0x00, 0x00, 0xc0,
  0x00, 0xc0, 0x01, 0x33, 0x24, 0x01, 0x00, 0x97,
- 0xeb, 0x19, 0xde, 0x42, 0x32, 0x01, 0x00, 0x00,
+ 0xeb, 0x19, 0xde, 0x42, 0x31, 0x01, 0x00, 0x00,
  0xdf, 0xe0, 0xe1, 0x5e, 0x04, 0x00, 0x5e, 0x05,
  0x00, 0xd2, 0x0a, 0x22, 0x06, 0x00, 0x24, 0x01,
  0x00, 0x0e, 0x29, 0xc0, 0x03, 0xca, 0x01, 0x05,
@@ -1609,81 +1623,81 @@ const uint8_t console[9932] = {
  0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x7f,
  0x01, 0x00, 0x00, 0x00, 0x15, 0x01, 0x00, 0x30,
  0x00, 0x39, 0x00, 0x0a, 0x06, 0x0c, 0x00, 0x0a,
- 0x0e, 0x43, 0x06, 0x01, 0xb2, 0x04, 0x06, 0x03,
- 0x06, 0x05, 0x04, 0x0c, 0x92, 0x04, 0x09, 0xfe,
+ 0x0e, 0x43, 0x06, 0x01, 0xb0, 0x04, 0x06, 0x03,
+ 0x06, 0x05, 0x04, 0x0c, 0x92, 0x04, 0x09, 0xfc,
  0x04, 0x00, 0x01, 0x00, 0x80, 0x01, 0x00, 0x01,
- 0x00, 0x92, 0x05, 0x00, 0x01, 0x00, 0x98, 0x05,
- 0x00, 0x01, 0x00, 0xc4, 0x05, 0x00, 0x01, 0x00,
- 0x88, 0x05, 0x00, 0x01, 0x00, 0x6c, 0x00, 0x00,
- 0x00, 0xe0, 0x04, 0x00, 0x01, 0x00, 0xd6, 0x05,
- 0x00, 0x02, 0x00, 0xca, 0x03, 0x1b, 0x01, 0xbe,
- 0x04, 0x0f, 0x01, 0xaa, 0x04, 0x05, 0x01, 0xc8,
+ 0x00, 0x90, 0x05, 0x00, 0x01, 0x00, 0x96, 0x05,
+ 0x00, 0x01, 0x00, 0xc2, 0x05, 0x00, 0x01, 0x00,
+ 0x86, 0x05, 0x00, 0x01, 0x00, 0x6c, 0x00, 0x00,
+ 0x00, 0xde, 0x04, 0x00, 0x01, 0x00, 0xd4, 0x05,
+ 0x00, 0x02, 0x00, 0xca, 0x03, 0x1b, 0x01, 0xbc,
+ 0x04, 0x0f, 0x01, 0xa8, 0x04, 0x05, 0x01, 0xc6,
  0x04, 0x14, 0x01, 0x38, 0x94, 0x00, 0x00, 0x00,
  0x42, 0x65, 0x00, 0x00, 0x00, 0xd3, 0x5b, 0x04,
  0x00, 0x24, 0x02, 0x00, 0x11, 0xec, 0x0d, 0x0e,
  0x0b, 0xd3, 0x5b, 0x04, 0x00, 0x47, 0x4c, 0x40,
  0x00, 0x00, 0x00, 0xd0, 0x41, 0x41, 0x00, 0x00,
  0x00, 0xeb, 0x35, 0xc8, 0x41, 0x42, 0x00, 0x00,
- 0x00, 0xeb, 0x17, 0xd2, 0x42, 0x41, 0x01, 0x00,
- 0x00, 0x04, 0x6c, 0x01, 0x00, 0x00, 0x04, 0x56,
+ 0x00, 0xeb, 0x17, 0xd2, 0x42, 0x40, 0x01, 0x00,
+ 0x00, 0x04, 0x6b, 0x01, 0x00, 0x00, 0x04, 0x55,
  0x01, 0x00, 0x00, 0x24, 0x02, 0x00, 0xcb, 0xed,
- 0x33, 0xd2, 0x42, 0x41, 0x01, 0x00, 0x00, 0x04,
- 0x6d, 0x01, 0x00, 0x00, 0x04, 0x56, 0x01, 0x00,
+ 0x33, 0xd2, 0x42, 0x40, 0x01, 0x00, 0x00, 0x04,
+ 0x6c, 0x01, 0x00, 0x00, 0x04, 0x55, 0x01, 0x00,
  0x00, 0x24, 0x02, 0x00, 0xcb, 0xed, 0x1d, 0xc8,
  0x41, 0x42, 0x00, 0x00, 0x00, 0xeb, 0x15, 0xd2,
- 0x42, 0x41, 0x01, 0x00, 0x00, 0x04, 0x6e, 0x01,
- 0x00, 0x00, 0x04, 0x56, 0x01, 0x00, 0x00, 0x24,
+ 0x42, 0x40, 0x01, 0x00, 0x00, 0x04, 0x6d, 0x01,
+ 0x00, 0x00, 0x04, 0x55, 0x01, 0x00, 0x00, 0x24,
  0x02, 0x00, 0xcb, 0xde, 0xd5, 0x5b, 0x04, 0x00,
- 0xf1, 0x97, 0xeb, 0x11, 0x04, 0x5c, 0x01, 0x00,
- 0x00, 0x5b, 0x04, 0x00, 0x9e, 0x04, 0x55, 0x01,
+ 0xf1, 0x97, 0xeb, 0x11, 0x04, 0x5b, 0x01, 0x00,
+ 0x00, 0x5b, 0x04, 0x00, 0x9e, 0x04, 0x54, 0x01,
  0x00, 0x00, 0x9e, 0xca, 0xc7, 0x97, 0x69, 0xc8,
- 0x00, 0x00, 0x00, 0xd2, 0x41, 0x40, 0x01, 0x00,
- 0x00, 0x42, 0x51, 0x01, 0x00, 0x00, 0xc8, 0x41,
+ 0x00, 0x00, 0x00, 0xd2, 0x41, 0x3f, 0x01, 0x00,
+ 0x00, 0x42, 0x50, 0x01, 0x00, 0x00, 0xc8, 0x41,
  0x40, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00, 0xb6,
  0xa4, 0x69, 0x99, 0x00, 0x00, 0x00, 0xdf, 0xd4,
  0xf0, 0xeb, 0x0e, 0xe0, 0xd2, 0xc8, 0x41, 0x40,
  0x00, 0x00, 0x00, 0x07, 0xf2, 0xcb, 0xed, 0x0e,
  0xe0, 0xd2, 0xc8, 0x41, 0x40, 0x00, 0x00, 0x00,
- 0xd4, 0xb7, 0x9f, 0xf2, 0xcb, 0xc7, 0x42, 0x51,
- 0x01, 0x00, 0x00, 0x04, 0x69, 0x01, 0x00, 0x00,
+ 0xd4, 0xb7, 0x9f, 0xf2, 0xcb, 0xc7, 0x42, 0x50,
+ 0x01, 0x00, 0x00, 0x04, 0x68, 0x01, 0x00, 0x00,
  0x24, 0x01, 0x00, 0xb5, 0xa6, 0xeb, 0x79, 0x5b,
  0x05, 0x00, 0xeb, 0x32, 0xc7, 0x42, 0x5c, 0x00,
- 0x00, 0x00, 0x04, 0x69, 0x01, 0x00, 0x00, 0x24,
- 0x01, 0x00, 0x42, 0x60, 0x01, 0x00, 0x00, 0xc1,
+ 0x00, 0x00, 0x04, 0x68, 0x01, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0x42, 0x5f, 0x01, 0x00, 0x00, 0xc1,
  0x00, 0x24, 0x01, 0x00, 0x42, 0x5a, 0x00, 0x00,
- 0x00, 0x04, 0x69, 0x01, 0x00, 0x00, 0x24, 0x01,
- 0x00, 0x42, 0x6f, 0x01, 0x00, 0x00, 0xb8, 0x24,
- 0x01, 0x00, 0xcb, 0xed, 0x43, 0x04, 0x69, 0x01,
+ 0x00, 0x04, 0x68, 0x01, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x42, 0x6e, 0x01, 0x00, 0x00, 0xb8, 0x24,
+ 0x01, 0x00, 0xcb, 0xed, 0x43, 0x04, 0x68, 0x01,
  0x00, 0x00, 0xc7, 0x42, 0x5c, 0x00, 0x00, 0x00,
- 0x04, 0x69, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00,
- 0x42, 0x60, 0x01, 0x00, 0x00, 0xc1, 0x01, 0x24,
+ 0x04, 0x68, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x42, 0x5f, 0x01, 0x00, 0x00, 0xc1, 0x01, 0x24,
  0x01, 0x00, 0x42, 0x5a, 0x00, 0x00, 0x00, 0x04,
- 0x69, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x9e,
- 0xcb, 0xed, 0x15, 0xd2, 0x42, 0x41, 0x01, 0x00,
- 0x00, 0x04, 0x3c, 0x01, 0x00, 0x00, 0x04, 0x56,
+ 0x68, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x9e,
+ 0xcb, 0xed, 0x15, 0xd2, 0x42, 0x40, 0x01, 0x00,
+ 0x00, 0x04, 0x3b, 0x01, 0x00, 0x00, 0x04, 0x55,
  0x01, 0x00, 0x00, 0x24, 0x02, 0x00, 0xcb, 0xe1,
  0xc6, 0xf0, 0x69, 0xa8, 0x00, 0x00, 0x00, 0x5b,
  0x05, 0x00, 0xeb, 0x15, 0x5b, 0x04, 0x00, 0x42,
- 0x6a, 0x01, 0x00, 0x00, 0xc0, 0x02, 0xc0, 0x03,
+ 0x69, 0x01, 0x00, 0x00, 0xc0, 0x02, 0xc0, 0x03,
  0x33, 0x24, 0x01, 0x00, 0xeb, 0x03, 0xc7, 0x28,
- 0x38, 0x9d, 0x00, 0x00, 0x00, 0x42, 0x3b, 0x01,
+ 0x38, 0x9d, 0x00, 0x00, 0x00, 0x42, 0x3a, 0x01,
  0x00, 0x00, 0xc2, 0x5b, 0x04, 0x00, 0x9e, 0x24,
- 0x01, 0x00, 0xce, 0x42, 0x6a, 0x01, 0x00, 0x00,
+ 0x01, 0x00, 0xce, 0x42, 0x69, 0x01, 0x00, 0x00,
  0xc0, 0x04, 0xc0, 0x05, 0x33, 0x24, 0x01, 0x00,
- 0xeb, 0x22, 0xc6, 0x42, 0x6f, 0x01, 0x00, 0x00,
+ 0xeb, 0x22, 0xc6, 0x42, 0x6e, 0x01, 0x00, 0x00,
  0xb7, 0xc6, 0xea, 0xb8, 0x9f, 0x24, 0x02, 0x00,
- 0xca, 0xd2, 0x42, 0x41, 0x01, 0x00, 0x00, 0xc6,
+ 0xca, 0xd2, 0x42, 0x40, 0x01, 0x00, 0x00, 0xc6,
  0x04, 0x36, 0x00, 0x00, 0x00, 0x24, 0x02, 0x00,
- 0xca, 0xed, 0x49, 0xc6, 0x42, 0x34, 0x01, 0x00,
- 0x00, 0xc0, 0x06, 0xc0, 0x07, 0x33, 0x04, 0x65,
- 0x01, 0x00, 0x00, 0x24, 0x02, 0x00, 0x42, 0x34,
+ 0xca, 0xed, 0x49, 0xc6, 0x42, 0x33, 0x01, 0x00,
+ 0x00, 0xc0, 0x06, 0xc0, 0x07, 0x33, 0x04, 0x64,
+ 0x01, 0x00, 0x00, 0x24, 0x02, 0x00, 0x42, 0x33,
  0x01, 0x00, 0x00, 0xc0, 0x08, 0xc0, 0x09, 0x33,
- 0x04, 0x66, 0x01, 0x00, 0x00, 0x24, 0x02, 0x00,
- 0x42, 0x34, 0x01, 0x00, 0x00, 0xc0, 0x0a, 0xc0,
- 0x0b, 0x33, 0x04, 0x64, 0x01, 0x00, 0x00, 0x24,
- 0x02, 0x00, 0xca, 0xd2, 0x42, 0x41, 0x01, 0x00,
+ 0x04, 0x65, 0x01, 0x00, 0x00, 0x24, 0x02, 0x00,
+ 0x42, 0x33, 0x01, 0x00, 0x00, 0xc0, 0x0a, 0xc0,
+ 0x0b, 0x33, 0x04, 0x63, 0x01, 0x00, 0x00, 0x24,
+ 0x02, 0x00, 0xca, 0xd2, 0x42, 0x40, 0x01, 0x00,
  0x00, 0xc6, 0x04, 0x48, 0x00, 0x00, 0x00, 0x24,
- 0x02, 0x00, 0xca, 0xc6, 0x04, 0x53, 0x01, 0x00,
+ 0x02, 0x00, 0xca, 0xc6, 0x04, 0x52, 0x01, 0x00,
  0x00, 0x9e, 0xc7, 0x9e, 0x28, 0xc0, 0x03, 0xd4,
  0x01, 0x33, 0x04, 0xa8, 0x26, 0x2b, 0x67, 0x0d,
  0x68, 0x0d, 0x2b, 0x69, 0x30, 0x54, 0x26, 0x8a,
@@ -1693,12 +1707,12 @@ const uint8_t console[9932] = {
  0x08, 0x62, 0x4e, 0x4e, 0x53, 0x0d, 0x08, 0x5d,
  0x5d, 0x62, 0x00, 0x10, 0x08, 0x0e, 0x43, 0x06,
  0x01, 0x00, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00,
- 0x08, 0x01, 0xe0, 0x05, 0x00, 0x01, 0x00, 0x04,
- 0x71, 0x01, 0x00, 0x00, 0xd2, 0x9e, 0x28, 0xc0,
+ 0x08, 0x01, 0xde, 0x05, 0x00, 0x01, 0x00, 0x04,
+ 0x70, 0x01, 0x00, 0x00, 0xd2, 0x9e, 0x28, 0xc0,
  0x03, 0xf0, 0x01, 0x01, 0x03, 0x0e, 0x43, 0x06,
  0x01, 0x00, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00,
- 0x08, 0x01, 0xe0, 0x05, 0x00, 0x01, 0x00, 0x04,
- 0x72, 0x01, 0x00, 0x00, 0xd2, 0x9e, 0x28, 0xc0,
+ 0x08, 0x01, 0xde, 0x05, 0x00, 0x01, 0x00, 0x04,
+ 0x71, 0x01, 0x00, 0x00, 0xd2, 0x9e, 0x28, 0xc0,
  0x03, 0xfa, 0x01, 0x01, 0x03, 0x07, 0x0a, 0x5e,
  0x5c, 0x64, 0x2b, 0x24, 0x07, 0x64, 0x00, 0x01,
  0x00, 0x2b, 0x00, 0x00, 0x00, 0x08, 0x06, 0x00,
@@ -1737,34 +1751,34 @@ const uint8_t console[9932] = {
  0x0b, 0x00, 0x0b, 0x01, 0x09, 0x09, 0x00, 0x00,
  0x00, 0x05, 0x01, 0x22, 0x00, 0x07, 0x04, 0x00,
  0x00, 0x00, 0x01, 0x22, 0x00, 0x06, 0x0c, 0x01,
- 0x0c, 0x00, 0x0a, 0x0e, 0x43, 0x06, 0x01, 0xb4,
+ 0x0c, 0x00, 0x0a, 0x0e, 0x43, 0x06, 0x01, 0xb2,
  0x04, 0x03, 0x02, 0x03, 0x04, 0x00, 0x01, 0x6c,
- 0x05, 0xa0, 0x05, 0x00, 0x01, 0x00, 0x9a, 0x05,
- 0x00, 0x01, 0x00, 0x9c, 0x05, 0x00, 0x01, 0x00,
- 0xe6, 0x05, 0x00, 0x00, 0x80, 0x60, 0x00, 0x01,
- 0x00, 0xb6, 0xca, 0xd2, 0x42, 0x74, 0x01, 0x00,
+ 0x05, 0x9e, 0x05, 0x00, 0x01, 0x00, 0x98, 0x05,
+ 0x00, 0x01, 0x00, 0x9a, 0x05, 0x00, 0x01, 0x00,
+ 0xe4, 0x05, 0x00, 0x00, 0x80, 0x60, 0x00, 0x01,
+ 0x00, 0xb6, 0xca, 0xd2, 0x42, 0x73, 0x01, 0x00,
  0x00, 0xc1, 0x00, 0xb6, 0x24, 0x02, 0x00, 0xcf,
  0xbe, 0x3c, 0xa6, 0xeb, 0x34, 0xd4, 0xb6, 0x47,
  0xd3, 0xc2, 0xac, 0xeb, 0x04, 0xc2, 0xed, 0x08,
- 0xd3, 0x04, 0x75, 0x01, 0x00, 0x00, 0x9e, 0x9e,
- 0x04, 0x33, 0x01, 0x00, 0x00, 0x9e, 0xd2, 0x42,
- 0x5a, 0x00, 0x00, 0x00, 0x04, 0x76, 0x01, 0x00,
- 0x00, 0x24, 0x01, 0x00, 0x9e, 0x04, 0x33, 0x01,
+ 0xd3, 0x04, 0x74, 0x01, 0x00, 0x00, 0x9e, 0x9e,
+ 0x04, 0x32, 0x01, 0x00, 0x00, 0x9e, 0xd2, 0x42,
+ 0x5a, 0x00, 0x00, 0x00, 0x04, 0x75, 0x01, 0x00,
+ 0x00, 0x24, 0x01, 0x00, 0x9e, 0x04, 0x32, 0x01,
  0x00, 0x00, 0x9e, 0xd4, 0xb7, 0x47, 0x9e, 0x28,
- 0xd4, 0xb6, 0x47, 0xd3, 0x9e, 0x04, 0x33, 0x01,
+ 0xd4, 0xb6, 0x47, 0xd3, 0x9e, 0x04, 0x32, 0x01,
  0x00, 0x00, 0x9e, 0xd2, 0x42, 0x5a, 0x00, 0x00,
- 0x00, 0x04, 0x77, 0x01, 0x00, 0x00, 0x24, 0x01,
- 0x00, 0x9e, 0x04, 0x33, 0x01, 0x00, 0x00, 0x9e,
+ 0x00, 0x04, 0x76, 0x01, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x9e, 0x04, 0x32, 0x01, 0x00, 0x00, 0x9e,
  0xd4, 0xb7, 0x47, 0x9e, 0x28, 0xc0, 0x03, 0x98,
  0x02, 0x0e, 0x03, 0x0d, 0x00, 0x06, 0x08, 0x22,
  0x22, 0x12, 0x6c, 0x08, 0x67, 0x08, 0x18, 0x09,
  0x0e, 0x43, 0x06, 0x01, 0x00, 0x02, 0x00, 0x02,
- 0x05, 0x01, 0x02, 0x2d, 0x02, 0xf0, 0x05, 0x00,
- 0x01, 0x00, 0xf2, 0x05, 0x00, 0x01, 0x00, 0xe6,
+ 0x05, 0x01, 0x02, 0x2d, 0x02, 0xee, 0x05, 0x00,
+ 0x01, 0x00, 0xf0, 0x05, 0x00, 0x01, 0x00, 0xe4,
  0x05, 0x00, 0x01, 0xde, 0x90, 0xe2, 0xd3, 0x42,
- 0x51, 0x01, 0x00, 0x00, 0x04, 0x69, 0x01, 0x00,
+ 0x50, 0x01, 0x00, 0x00, 0x04, 0x68, 0x01, 0x00,
  0x00, 0x24, 0x01, 0x00, 0xb6, 0xa7, 0xeb, 0x04,
- 0xde, 0x90, 0xe2, 0xd2, 0xd3, 0x42, 0x34, 0x01,
+ 0xde, 0x90, 0xe2, 0xd2, 0xd3, 0x42, 0x33, 0x01,
  0x00, 0x00, 0xc0, 0x00, 0xc0, 0x01, 0x33, 0xc2,
  0x24, 0x02, 0x00, 0xea, 0x9e, 0xb7, 0x9e, 0x28,
  0xc0, 0x03, 0x9a, 0x02, 0x03, 0x03, 0x12, 0x6c,
@@ -1778,93 +1792,93 @@ const uint8_t console[9932] = {
  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
  0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x01, 0x00,
  0x30, 0x00, 0x39, 0x00, 0x0a, 0x01, 0x6d, 0x00,
- 0x0c, 0x00, 0x0a, 0x0e, 0x43, 0x06, 0x01, 0xb6,
+ 0x0c, 0x00, 0x0a, 0x0e, 0x43, 0x06, 0x01, 0xb4,
  0x04, 0x01, 0x00, 0x01, 0x03, 0x00, 0x00, 0x0e,
- 0x01, 0xf4, 0x05, 0x00, 0x01, 0x00, 0x38, 0x95,
- 0x00, 0x00, 0x00, 0x42, 0x1b, 0x01, 0x00, 0x00,
+ 0x01, 0xf2, 0x05, 0x00, 0x01, 0x00, 0x38, 0x95,
+ 0x00, 0x00, 0x00, 0x42, 0x1a, 0x01, 0x00, 0x00,
  0xd2, 0x25, 0x01, 0x00, 0xc0, 0x03, 0xae, 0x02,
- 0x01, 0x03, 0x0e, 0x43, 0x06, 0x01, 0xb8, 0x04,
+ 0x01, 0x03, 0x0e, 0x43, 0x06, 0x01, 0xb6, 0x04,
  0x01, 0x00, 0x01, 0x02, 0x00, 0x00, 0x09, 0x01,
- 0xf6, 0x05, 0x00, 0x01, 0x00, 0xd2, 0x98, 0x04,
+ 0xf4, 0x05, 0x00, 0x01, 0x00, 0xd2, 0x98, 0x04,
  0x8a, 0x00, 0x00, 0x00, 0xac, 0x28, 0xc0, 0x03,
  0xb2, 0x02, 0x01, 0x03, 0x0e, 0x43, 0x06, 0x01,
- 0xba, 0x04, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00,
- 0x09, 0x01, 0xf6, 0x05, 0x00, 0x01, 0x00, 0xd2,
+ 0xb8, 0x04, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00,
+ 0x09, 0x01, 0xf4, 0x05, 0x00, 0x01, 0x00, 0xd2,
  0x98, 0x04, 0x8b, 0x00, 0x00, 0x00, 0xac, 0x28,
  0xc0, 0x03, 0xb6, 0x02, 0x01, 0x03, 0x0e, 0x43,
- 0x06, 0x01, 0xbc, 0x04, 0x01, 0x00, 0x01, 0x02,
- 0x00, 0x00, 0x09, 0x01, 0xf6, 0x05, 0x00, 0x01,
+ 0x06, 0x01, 0xba, 0x04, 0x01, 0x00, 0x01, 0x02,
+ 0x00, 0x00, 0x09, 0x01, 0xf4, 0x05, 0x00, 0x01,
  0x00, 0xd2, 0x98, 0x04, 0x47, 0x00, 0x00, 0x00,
  0xac, 0x28, 0xc0, 0x03, 0xba, 0x02, 0x01, 0x03,
- 0x0e, 0x43, 0x06, 0x01, 0xbe, 0x04, 0x01, 0x00,
- 0x01, 0x01, 0x00, 0x00, 0x03, 0x01, 0xf6, 0x05,
+ 0x0e, 0x43, 0x06, 0x01, 0xbc, 0x04, 0x01, 0x00,
+ 0x01, 0x01, 0x00, 0x00, 0x03, 0x01, 0xf4, 0x05,
  0x00, 0x01, 0x00, 0xd2, 0xf4, 0x28, 0xc0, 0x03,
  0xbe, 0x02, 0x01, 0x03, 0x0e, 0x43, 0x06, 0x01,
- 0xc0, 0x04, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00,
- 0x04, 0x01, 0xf6, 0x05, 0x00, 0x01, 0x00, 0xd2,
+ 0xbe, 0x04, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00,
+ 0x04, 0x01, 0xf4, 0x05, 0x00, 0x01, 0x00, 0xd2,
  0x07, 0xaa, 0x28, 0xc0, 0x03, 0xc2, 0x02, 0x01,
- 0x03, 0x0e, 0x43, 0x06, 0x01, 0xc2, 0x04, 0x01,
- 0x00, 0x01, 0x02, 0x00, 0x00, 0x09, 0x01, 0xf6,
+ 0x03, 0x0e, 0x43, 0x06, 0x01, 0xc0, 0x04, 0x01,
+ 0x00, 0x01, 0x02, 0x00, 0x00, 0x09, 0x01, 0xf4,
  0x05, 0x00, 0x01, 0x00, 0xd2, 0x98, 0x04, 0x46,
  0x00, 0x00, 0x00, 0xac, 0x28, 0xc0, 0x03, 0xc6,
- 0x02, 0x01, 0x03, 0x0e, 0x43, 0x06, 0x01, 0xc4,
+ 0x02, 0x01, 0x03, 0x0e, 0x43, 0x06, 0x01, 0xc2,
  0x04, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00, 0x09,
- 0x01, 0xf6, 0x05, 0x00, 0x01, 0x00, 0xd2, 0x98,
+ 0x01, 0xf4, 0x05, 0x00, 0x01, 0x00, 0xd2, 0x98,
  0x04, 0x48, 0x00, 0x00, 0x00, 0xac, 0x28, 0xc0,
  0x03, 0xca, 0x02, 0x01, 0x03, 0x0e, 0x43, 0x06,
- 0x01, 0xc6, 0x04, 0x01, 0x00, 0x01, 0x02, 0x00,
- 0x00, 0x09, 0x01, 0xf6, 0x05, 0x00, 0x01, 0x00,
+ 0x01, 0xc4, 0x04, 0x01, 0x00, 0x01, 0x02, 0x00,
+ 0x00, 0x09, 0x01, 0xf4, 0x05, 0x00, 0x01, 0x00,
  0xd2, 0x98, 0x04, 0x4a, 0x00, 0x00, 0x00, 0xac,
  0x28, 0xc0, 0x03, 0xce, 0x02, 0x01, 0x03, 0x0e,
- 0x43, 0x06, 0x01, 0xc8, 0x04, 0x01, 0x00, 0x01,
- 0x01, 0x00, 0x00, 0x03, 0x01, 0xf6, 0x05, 0x00,
+ 0x43, 0x06, 0x01, 0xc6, 0x04, 0x01, 0x00, 0x01,
+ 0x01, 0x00, 0x00, 0x03, 0x01, 0xf4, 0x05, 0x00,
  0x01, 0x00, 0xd2, 0xf3, 0x28, 0xc0, 0x03, 0xd2,
- 0x02, 0x01, 0x03, 0x0e, 0x43, 0x06, 0x01, 0xca,
+ 0x02, 0x01, 0x03, 0x0e, 0x43, 0x06, 0x01, 0xc8,
  0x04, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x11,
- 0x01, 0xf8, 0x05, 0x00, 0x01, 0x00, 0xcc, 0x04,
- 0x16, 0x01, 0xd4, 0x04, 0x1a, 0x01, 0xde, 0xd2,
+ 0x01, 0xf6, 0x05, 0x00, 0x01, 0x00, 0xca, 0x04,
+ 0x16, 0x01, 0xd2, 0x04, 0x1a, 0x01, 0xde, 0xd2,
  0xf0, 0x11, 0xeb, 0x0b, 0x0e, 0xdf, 0xd2, 0xf0,
- 0x04, 0x7d, 0x01, 0x00, 0x00, 0xac, 0x28, 0xc0,
+ 0x04, 0x7c, 0x01, 0x00, 0x00, 0xac, 0x28, 0xc0,
  0x03, 0xd6, 0x02, 0x01, 0x03, 0x0e, 0x43, 0x06,
- 0x01, 0xcc, 0x04, 0x01, 0x00, 0x01, 0x02, 0x00,
- 0x00, 0x10, 0x01, 0xf6, 0x05, 0x00, 0x01, 0x00,
+ 0x01, 0xca, 0x04, 0x01, 0x00, 0x01, 0x02, 0x00,
+ 0x00, 0x10, 0x01, 0xf4, 0x05, 0x00, 0x01, 0x00,
  0xd2, 0x98, 0x04, 0x49, 0x00, 0x00, 0x00, 0xac,
  0x11, 0xeb, 0x05, 0x0e, 0xd2, 0x07, 0xad, 0x28,
  0xc0, 0x03, 0xda, 0x02, 0x01, 0x03, 0x0e, 0x43,
- 0x06, 0x01, 0xce, 0x04, 0x01, 0x00, 0x01, 0x02,
- 0x02, 0x00, 0x11, 0x01, 0xfc, 0x05, 0x00, 0x01,
- 0x00, 0xcc, 0x04, 0x16, 0x01, 0xd4, 0x04, 0x1a,
+ 0x06, 0x01, 0xcc, 0x04, 0x01, 0x00, 0x01, 0x02,
+ 0x02, 0x00, 0x11, 0x01, 0xfa, 0x05, 0x00, 0x01,
+ 0x00, 0xca, 0x04, 0x16, 0x01, 0xd2, 0x04, 0x1a,
  0x01, 0xde, 0xd2, 0xf0, 0x11, 0xeb, 0x0b, 0x0e,
- 0xdf, 0xd2, 0xf0, 0x04, 0x7f, 0x01, 0x00, 0x00,
+ 0xdf, 0xd2, 0xf0, 0x04, 0x7e, 0x01, 0x00, 0x00,
  0xac, 0x28, 0xc0, 0x03, 0xde, 0x02, 0x01, 0x03,
- 0x0e, 0x43, 0x06, 0x01, 0xd0, 0x04, 0x01, 0x00,
- 0x01, 0x02, 0x02, 0x00, 0x1c, 0x01, 0x80, 0x06,
- 0x00, 0x01, 0x00, 0xcc, 0x04, 0x16, 0x01, 0xd4,
+ 0x0e, 0x43, 0x06, 0x01, 0xce, 0x04, 0x01, 0x00,
+ 0x01, 0x02, 0x02, 0x00, 0x1c, 0x01, 0xfe, 0x05,
+ 0x00, 0x01, 0x00, 0xca, 0x04, 0x16, 0x01, 0xd2,
  0x04, 0x1a, 0x01, 0xde, 0xd2, 0xf0, 0x11, 0xeb,
- 0x16, 0x0e, 0xdf, 0xd2, 0xf0, 0x04, 0x81, 0x01,
+ 0x16, 0x0e, 0xdf, 0xd2, 0xf0, 0x04, 0x80, 0x01,
  0x00, 0x00, 0xac, 0x11, 0xec, 0x09, 0x0e, 0xd2,
  0x38, 0x96, 0x00, 0x00, 0x00, 0xa8, 0x28, 0xc0,
  0x03, 0xe2, 0x02, 0x03, 0x04, 0x26, 0x67, 0x0e,
- 0x43, 0x06, 0x01, 0xd2, 0x04, 0x01, 0x00, 0x01,
- 0x01, 0x00, 0x00, 0x03, 0x01, 0xf6, 0x05, 0x00,
+ 0x43, 0x06, 0x01, 0xd0, 0x04, 0x01, 0x00, 0x01,
+ 0x01, 0x00, 0x00, 0x03, 0x01, 0xf4, 0x05, 0x00,
  0x01, 0x00, 0xd2, 0xf6, 0x28, 0xc0, 0x03, 0xe9,
- 0x02, 0x01, 0x03, 0x0e, 0x43, 0x06, 0x01, 0xd4,
+ 0x02, 0x01, 0x03, 0x0e, 0x43, 0x06, 0x01, 0xd2,
  0x04, 0x01, 0x00, 0x01, 0x03, 0x00, 0x00, 0x18,
- 0x01, 0x84, 0x06, 0x00, 0x01, 0x00, 0x38, 0x94,
+ 0x01, 0x82, 0x06, 0x00, 0x01, 0x00, 0x38, 0x94,
  0x00, 0x00, 0x00, 0x41, 0x3b, 0x00, 0x00, 0x00,
- 0x41, 0x37, 0x00, 0x00, 0x00, 0x42, 0x57, 0x01,
+ 0x41, 0x37, 0x00, 0x00, 0x00, 0x42, 0x56, 0x01,
  0x00, 0x00, 0xd2, 0x25, 0x01, 0x00, 0xc0, 0x03,
  0xed, 0x02, 0x01, 0x03, 0x0e, 0x43, 0x06, 0x01,
  0xca, 0x03, 0x02, 0x00, 0x02, 0x04, 0x00, 0x00,
- 0x19, 0x02, 0xfa, 0x04, 0x00, 0x01, 0x00, 0x86,
+ 0x19, 0x02, 0xf8, 0x04, 0x00, 0x01, 0x00, 0x84,
  0x06, 0x00, 0x01, 0x00, 0x38, 0x94, 0x00, 0x00,
  0x00, 0x41, 0x3b, 0x00, 0x00, 0x00, 0x41, 0xe5,
- 0x00, 0x00, 0x00, 0x42, 0x57, 0x01, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x42, 0x56, 0x01, 0x00, 0x00,
  0xd2, 0xd3, 0x25, 0x02, 0x00, 0xc0, 0x03, 0xf1,
  0x02, 0x01, 0x03, 0x0e, 0x43, 0x06, 0x01, 0xc6,
  0x03, 0x00, 0x01, 0x00, 0x06, 0x01, 0x00, 0x1e,
  0x01, 0x9a, 0x01, 0x00, 0x01, 0x00, 0xc4, 0x03,
- 0x00, 0x0c, 0x0c, 0x00, 0xca, 0x38, 0x84, 0x01,
+ 0x00, 0x0c, 0x0c, 0x00, 0xca, 0x38, 0x83, 0x01,
  0x00, 0x00, 0x42, 0xe3, 0x00, 0x00, 0x00, 0x65,
  0x00, 0x00, 0x42, 0x59, 0x00, 0x00, 0x00, 0x07,
  0xc6, 0x24, 0x02, 0x00, 0x24, 0x01, 0x00, 0x29,
@@ -1872,17 +1886,17 @@ const uint8_t console[9932] = {
  0x43, 0x06, 0x01, 0xc8, 0x03, 0x00, 0x01, 0x00,
  0x06, 0x01, 0x00, 0x1e, 0x01, 0x9a, 0x01, 0x00,
  0x01, 0x00, 0xc4, 0x03, 0x00, 0x0c, 0x0c, 0x00,
- 0xca, 0x38, 0x84, 0x01, 0x00, 0x00, 0x42, 0xe4,
+ 0xca, 0x38, 0x83, 0x01, 0x00, 0x00, 0x42, 0xe4,
  0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x42, 0x59,
  0x00, 0x00, 0x00, 0x07, 0xc6, 0x24, 0x02, 0x00,
  0x24, 0x01, 0x00, 0x29, 0xc0, 0x03, 0xfd, 0x02,
  0x02, 0x12, 0x85, 0x0e, 0x43, 0x06, 0x01, 0xca,
  0x03, 0x02, 0x00, 0x02, 0x04, 0x00, 0x00, 0x20,
- 0x02, 0xfa, 0x04, 0x00, 0x01, 0x00, 0x8a, 0x06,
+ 0x02, 0xf8, 0x04, 0x00, 0x01, 0x00, 0x88, 0x06,
  0x00, 0x01, 0x00, 0xd2, 0x07, 0xaa, 0xeb, 0x03,
  0x09, 0x28, 0x38, 0x94, 0x00, 0x00, 0x00, 0x41,
  0x3b, 0x00, 0x00, 0x00, 0x41, 0xe5, 0x00, 0x00,
- 0x00, 0x42, 0x57, 0x01, 0x00, 0x00, 0xd2, 0xd3,
+ 0x00, 0x42, 0x56, 0x01, 0x00, 0x00, 0xd2, 0xd3,
  0x25, 0x02, 0x00, 0xc0, 0x03, 0x81, 0x03, 0x04,
  0x03, 0x1c, 0x08, 0x08, 0x07, 0x1c, 0x5c, 0x75,
  0x30, 0x30, 0x31, 0x62, 0x5c, 0x5b, 0x5c, 0x64,
@@ -1896,362 +1910,365 @@ const uint8_t console[9932] = {
  0x00, 0x15, 0x01, 0x00, 0x30, 0x00, 0x39, 0x00,
  0x0a, 0x01, 0x6d, 0x00, 0x0c, 0x00, 0x0a, 0x0e,
  0x43, 0x06, 0x01, 0xd2, 0x03, 0x01, 0x00, 0x01,
- 0x04, 0x01, 0x00, 0x0d, 0x01, 0xe0, 0x04, 0x00,
+ 0x04, 0x01, 0x00, 0x0d, 0x01, 0xde, 0x04, 0x00,
  0x01, 0x00, 0xd0, 0x03, 0x06, 0x0c, 0xd2, 0x42,
- 0x34, 0x01, 0x00, 0x00, 0x65, 0x00, 0x00, 0xc2,
- 0x25, 0x02, 0x00, 0xc0, 0x03, 0x9c, 0x03, 0x01,
+ 0x33, 0x01, 0x00, 0x00, 0x65, 0x00, 0x00, 0xc2,
+ 0x25, 0x02, 0x00, 0xc0, 0x03, 0x9d, 0x03, 0x01,
  0x03, 0x0e, 0x43, 0x06, 0x01, 0xd4, 0x03, 0x01,
- 0x01, 0x01, 0x03, 0x02, 0x00, 0x2e, 0x02, 0xe0,
- 0x04, 0x00, 0x01, 0x00, 0x8c, 0x06, 0x01, 0x00,
+ 0x01, 0x01, 0x03, 0x02, 0x00, 0x42, 0x02, 0xde,
+ 0x04, 0x00, 0x01, 0x00, 0x8a, 0x06, 0x01, 0x00,
  0x60, 0xd2, 0x03, 0x07, 0x00, 0xcc, 0x03, 0x04,
- 0x0c, 0x61, 0x00, 0x00, 0xde, 0x38, 0x98, 0x00,
- 0x00, 0x00, 0xd2, 0xf0, 0xf0, 0x42, 0x87, 0x01,
- 0x00, 0x00, 0x04, 0x88, 0x01, 0x00, 0x00, 0x24,
- 0x01, 0x00, 0xca, 0x65, 0x01, 0x00, 0x42, 0x89,
- 0x01, 0x00, 0x00, 0x62, 0x00, 0x00, 0x24, 0x01,
- 0x00, 0x41, 0x8a, 0x01, 0x00, 0x00, 0x28, 0xc0,
- 0x03, 0xa0, 0x03, 0x02, 0x12, 0x77, 0x0e, 0x43,
- 0x06, 0x01, 0xd6, 0x03, 0x02, 0x05, 0x02, 0x0a,
- 0x02, 0x00, 0xbb, 0x01, 0x07, 0x96, 0x06, 0x00,
- 0x01, 0x00, 0x98, 0x06, 0x00, 0x01, 0x00, 0x9a,
- 0x06, 0x01, 0x00, 0x40, 0xda, 0x04, 0x02, 0x01,
- 0x40, 0x9c, 0x06, 0x03, 0x02, 0x60, 0xde, 0x04,
- 0x03, 0x03, 0x60, 0x9e, 0x06, 0x03, 0x04, 0x60,
- 0xce, 0x03, 0x05, 0x0c, 0xd4, 0x03, 0x08, 0x00,
- 0x61, 0x00, 0x00, 0x65, 0x00, 0x00, 0x41, 0x03,
- 0x01, 0x00, 0x00, 0xca, 0x61, 0x01, 0x00, 0xb6,
- 0xcb, 0x62, 0x01, 0x00, 0xd2, 0xea, 0xa4, 0x69,
- 0x8e, 0x00, 0x00, 0x00, 0x61, 0x04, 0x00, 0x61,
- 0x03, 0x00, 0x61, 0x02, 0x00, 0xd2, 0x62, 0x01,
- 0x00, 0x47, 0xcc, 0xdf, 0x62, 0x02, 0x00, 0xf0,
- 0xcd, 0xd3, 0x62, 0x01, 0x00, 0x47, 0x62, 0x03,
- 0x00, 0x9f, 0xb8, 0x9c, 0xc4, 0x04, 0x62, 0x00,
- 0x00, 0xc2, 0x42, 0x5b, 0x00, 0x00, 0x00, 0x04,
- 0x33, 0x01, 0x00, 0x00, 0x42, 0x90, 0x01, 0x00,
- 0x00, 0x62, 0x04, 0x00, 0x24, 0x01, 0x00, 0x62,
- 0x02, 0x00, 0x04, 0x33, 0x01, 0x00, 0x00, 0x42,
- 0x90, 0x01, 0x00, 0x00, 0x38, 0x9c, 0x00, 0x00,
- 0x00, 0x42, 0x91, 0x01, 0x00, 0x00, 0x62, 0x04,
- 0x00, 0x24, 0x01, 0x00, 0x24, 0x01, 0x00, 0x24,
- 0x03, 0x00, 0x9e, 0x11, 0x63, 0x00, 0x00, 0x0e,
- 0x62, 0x01, 0x00, 0xd2, 0xea, 0xb7, 0x9f, 0xad,
- 0xeb, 0x12, 0x62, 0x00, 0x00, 0x65, 0x00, 0x00,
- 0x41, 0x07, 0x01, 0x00, 0x00, 0x9e, 0x11, 0x63,
- 0x00, 0x00, 0x0e, 0x62, 0x01, 0x00, 0x92, 0x63,
- 0x01, 0x00, 0x0e, 0xee, 0x6d, 0xff, 0x62, 0x00,
- 0x00, 0x65, 0x00, 0x00, 0x41, 0x05, 0x01, 0x00,
- 0x00, 0x9e, 0x11, 0x63, 0x00, 0x00, 0x0e, 0x62,
- 0x00, 0x00, 0x28, 0xc0, 0x03, 0xa6, 0x03, 0x0d,
- 0x12, 0x30, 0x80, 0x21, 0x21, 0x44, 0x00, 0x42,
- 0x02, 0x35, 0x59, 0x3a, 0x58, 0x0e, 0x43, 0x06,
- 0x01, 0xd8, 0x03, 0x02, 0x0c, 0x02, 0x09, 0x04,
- 0x03, 0xe1, 0x03, 0x0e, 0xa4, 0x06, 0x00, 0x01,
- 0x00, 0xa6, 0x06, 0x00, 0x01, 0x00, 0xa8, 0x06,
- 0x01, 0x00, 0x60, 0x98, 0x06, 0x01, 0x01, 0x60,
- 0xaa, 0x06, 0x01, 0x02, 0x60, 0xda, 0x04, 0x02,
- 0x0b, 0x40, 0xac, 0x06, 0x03, 0x04, 0x60, 0xae,
- 0x06, 0x04, 0x05, 0x40, 0x80, 0x01, 0x05, 0x06,
- 0x60, 0xb0, 0x06, 0x05, 0x07, 0x60, 0xb2, 0x06,
- 0x05, 0x08, 0x60, 0xb4, 0x06, 0x01, 0x03, 0x60,
- 0xb6, 0x06, 0x01, 0x0a, 0x40, 0x96, 0x06, 0x08,
- 0x0b, 0x60, 0xd4, 0x03, 0x08, 0x00, 0xce, 0x03,
- 0x05, 0x0c, 0xca, 0x03, 0x03, 0x00, 0xd6, 0x03,
- 0x09, 0x00, 0x61, 0x0a, 0x00, 0x61, 0x09, 0x00,
- 0x61, 0x02, 0x00, 0x61, 0x01, 0x00, 0x61, 0x00,
- 0x00, 0x26, 0x00, 0x00, 0xca, 0xd2, 0x42, 0x60,
- 0x01, 0x00, 0x00, 0xc1, 0x00, 0x24, 0x01, 0x00,
- 0xcb, 0xd3, 0x42, 0x74, 0x01, 0x00, 0x00, 0xc1,
- 0x01, 0xb6, 0x24, 0x02, 0x00, 0xcc, 0x61, 0x03,
- 0x00, 0xb6, 0xcd, 0x62, 0x03, 0x00, 0xd2, 0xea,
- 0xa4, 0x69, 0xac, 0x00, 0x00, 0x00, 0x61, 0x04,
- 0x00, 0xd3, 0x62, 0x03, 0x00, 0x47, 0xc4, 0x04,
- 0x61, 0x05, 0x00, 0xb6, 0xc4, 0x05, 0x62, 0x05,
- 0x00, 0x62, 0x02, 0x00, 0xa4, 0x69, 0x85, 0x00,
- 0x00, 0x00, 0x61, 0x08, 0x00, 0x61, 0x07, 0x00,
- 0x61, 0x06, 0x00, 0x62, 0x00, 0x00, 0x62, 0x05,
- 0x00, 0x47, 0x38, 0x45, 0x00, 0x00, 0x00, 0xac,
- 0xeb, 0x0c, 0x62, 0x00, 0x00, 0x62, 0x05, 0x00,
- 0x71, 0x26, 0x00, 0x00, 0x49, 0x62, 0x00, 0x00,
- 0x62, 0x05, 0x00, 0x47, 0x62, 0x03, 0x00, 0x71,
- 0xe0, 0x62, 0x04, 0x00, 0x62, 0x05, 0x00, 0xf1,
- 0xeb, 0x0a, 0x62, 0x04, 0x00, 0x62, 0x05, 0x00,
- 0x47, 0xed, 0x02, 0xc2, 0x16, 0x49, 0xc4, 0x06,
- 0x62, 0x01, 0x00, 0x62, 0x03, 0x00, 0x47, 0x11,
- 0xec, 0x03, 0x0e, 0xb6, 0xc4, 0x07, 0xde, 0x62,
- 0x06, 0x00, 0xf0, 0xc4, 0x08, 0x62, 0x01, 0x00,
- 0x62, 0x03, 0x00, 0x71, 0x38, 0x9c, 0x00, 0x00,
- 0x00, 0x42, 0x9c, 0x01, 0x00, 0x00, 0x62, 0x07,
- 0x00, 0x62, 0x08, 0x00, 0x24, 0x02, 0x00, 0x49,
- 0x62, 0x05, 0x00, 0x92, 0x63, 0x05, 0x00, 0x0e,
- 0xee, 0x75, 0xff, 0x62, 0x03, 0x00, 0x92, 0x63,
- 0x03, 0x00, 0x0e, 0xee, 0x4f, 0xff, 0x62, 0x01,
- 0x00, 0x42, 0x60, 0x01, 0x00, 0x00, 0xc1, 0x02,
- 0x24, 0x01, 0x00, 0xc4, 0x09, 0xc2, 0x42, 0x5b,
- 0x00, 0x00, 0x00, 0x65, 0x01, 0x00, 0x41, 0xf5,
- 0x00, 0x00, 0x00, 0x62, 0x09, 0x00, 0x42, 0x5a,
- 0x00, 0x00, 0x00, 0x65, 0x01, 0x00, 0x41, 0xf9,
- 0x00, 0x00, 0x00, 0x24, 0x01, 0x00, 0x24, 0x02,
- 0x00, 0xc2, 0x42, 0x5b, 0x00, 0x00, 0x00, 0x65,
- 0x01, 0x00, 0x41, 0xf3, 0x00, 0x00, 0x00, 0x04,
- 0x69, 0x01, 0x00, 0x00, 0xe1, 0xd2, 0x62, 0x01,
- 0x00, 0xf1, 0x04, 0x69, 0x01, 0x00, 0x00, 0x24,
- 0x04, 0x00, 0x9e, 0xc2, 0x42, 0x5b, 0x00, 0x00,
- 0x00, 0x65, 0x01, 0x00, 0x41, 0xf7, 0x00, 0x00,
+ 0x08, 0x61, 0x00, 0x00, 0xde, 0x38, 0x98, 0x00,
+ 0x00, 0x00, 0xd2, 0xf0, 0xf0, 0x42, 0x86, 0x01,
+ 0x00, 0x00, 0x04, 0x87, 0x01, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0xca, 0x65, 0x01, 0x00, 0x97, 0xeb,
+ 0x0f, 0x38, 0x88, 0x01, 0x00, 0x00, 0x11, 0x21,
+ 0x00, 0x00, 0x11, 0x66, 0x01, 0x00, 0x0e, 0x65,
+ 0x01, 0x00, 0x42, 0x89, 0x01, 0x00, 0x00, 0x62,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0x41, 0x8a, 0x01,
+ 0x00, 0x00, 0x28, 0xc0, 0x03, 0xa1, 0x03, 0x04,
+ 0x12, 0x77, 0x21, 0x4a, 0x0e, 0x43, 0x06, 0x01,
+ 0xd6, 0x03, 0x02, 0x05, 0x02, 0x0a, 0x02, 0x00,
+ 0xbb, 0x01, 0x07, 0x96, 0x06, 0x00, 0x01, 0x00,
+ 0x98, 0x06, 0x00, 0x01, 0x00, 0x9a, 0x06, 0x01,
+ 0x00, 0x40, 0xd8, 0x04, 0x02, 0x01, 0x40, 0x9c,
+ 0x06, 0x03, 0x02, 0x60, 0xdc, 0x04, 0x03, 0x03,
+ 0x60, 0x9e, 0x06, 0x03, 0x04, 0x60, 0xce, 0x03,
+ 0x05, 0x0c, 0xd4, 0x03, 0x08, 0x00, 0x61, 0x00,
+ 0x00, 0x65, 0x00, 0x00, 0x41, 0x02, 0x01, 0x00,
+ 0x00, 0xca, 0x61, 0x01, 0x00, 0xb6, 0xcb, 0x62,
+ 0x01, 0x00, 0xd2, 0xea, 0xa4, 0x69, 0x8e, 0x00,
+ 0x00, 0x00, 0x61, 0x04, 0x00, 0x61, 0x03, 0x00,
+ 0x61, 0x02, 0x00, 0xd2, 0x62, 0x01, 0x00, 0x47,
+ 0xcc, 0xdf, 0x62, 0x02, 0x00, 0xf0, 0xcd, 0xd3,
+ 0x62, 0x01, 0x00, 0x47, 0x62, 0x03, 0x00, 0x9f,
+ 0xb8, 0x9c, 0xc4, 0x04, 0x62, 0x00, 0x00, 0xc2,
+ 0x42, 0x5b, 0x00, 0x00, 0x00, 0x04, 0x32, 0x01,
+ 0x00, 0x00, 0x42, 0x90, 0x01, 0x00, 0x00, 0x62,
+ 0x04, 0x00, 0x24, 0x01, 0x00, 0x62, 0x02, 0x00,
+ 0x04, 0x32, 0x01, 0x00, 0x00, 0x42, 0x90, 0x01,
+ 0x00, 0x00, 0x38, 0x9c, 0x00, 0x00, 0x00, 0x42,
+ 0x91, 0x01, 0x00, 0x00, 0x62, 0x04, 0x00, 0x24,
+ 0x01, 0x00, 0x24, 0x01, 0x00, 0x24, 0x03, 0x00,
+ 0x9e, 0x11, 0x63, 0x00, 0x00, 0x0e, 0x62, 0x01,
+ 0x00, 0xd2, 0xea, 0xb7, 0x9f, 0xad, 0xeb, 0x12,
+ 0x62, 0x00, 0x00, 0x65, 0x00, 0x00, 0x41, 0x06,
+ 0x01, 0x00, 0x00, 0x9e, 0x11, 0x63, 0x00, 0x00,
+ 0x0e, 0x62, 0x01, 0x00, 0x92, 0x63, 0x01, 0x00,
+ 0x0e, 0xee, 0x6d, 0xff, 0x62, 0x00, 0x00, 0x65,
+ 0x00, 0x00, 0x41, 0x04, 0x01, 0x00, 0x00, 0x9e,
+ 0x11, 0x63, 0x00, 0x00, 0x0e, 0x62, 0x00, 0x00,
+ 0x28, 0xc0, 0x03, 0xaa, 0x03, 0x0d, 0x12, 0x30,
+ 0x80, 0x21, 0x21, 0x44, 0x00, 0x42, 0x02, 0x35,
+ 0x59, 0x3a, 0x58, 0x0e, 0x43, 0x06, 0x01, 0xd8,
+ 0x03, 0x02, 0x0c, 0x02, 0x09, 0x04, 0x03, 0xe1,
+ 0x03, 0x0e, 0xa4, 0x06, 0x00, 0x01, 0x00, 0xa6,
+ 0x06, 0x00, 0x01, 0x00, 0xa8, 0x06, 0x01, 0x00,
+ 0x60, 0x98, 0x06, 0x01, 0x01, 0x60, 0xaa, 0x06,
+ 0x01, 0x02, 0x60, 0xd8, 0x04, 0x02, 0x0b, 0x40,
+ 0xac, 0x06, 0x03, 0x04, 0x60, 0xae, 0x06, 0x04,
+ 0x05, 0x40, 0x80, 0x01, 0x05, 0x06, 0x60, 0xb0,
+ 0x06, 0x05, 0x07, 0x60, 0xb2, 0x06, 0x05, 0x08,
+ 0x60, 0xb4, 0x06, 0x01, 0x03, 0x60, 0xb6, 0x06,
+ 0x01, 0x0a, 0x40, 0x96, 0x06, 0x08, 0x0b, 0x60,
+ 0xd4, 0x03, 0x08, 0x00, 0xce, 0x03, 0x05, 0x0c,
+ 0xca, 0x03, 0x03, 0x00, 0xd6, 0x03, 0x09, 0x00,
+ 0x61, 0x0a, 0x00, 0x61, 0x09, 0x00, 0x61, 0x02,
+ 0x00, 0x61, 0x01, 0x00, 0x61, 0x00, 0x00, 0x26,
+ 0x00, 0x00, 0xca, 0xd2, 0x42, 0x5f, 0x01, 0x00,
+ 0x00, 0xc1, 0x00, 0x24, 0x01, 0x00, 0xcb, 0xd3,
+ 0x42, 0x73, 0x01, 0x00, 0x00, 0xc1, 0x01, 0xb6,
+ 0x24, 0x02, 0x00, 0xcc, 0x61, 0x03, 0x00, 0xb6,
+ 0xcd, 0x62, 0x03, 0x00, 0xd2, 0xea, 0xa4, 0x69,
+ 0xac, 0x00, 0x00, 0x00, 0x61, 0x04, 0x00, 0xd3,
+ 0x62, 0x03, 0x00, 0x47, 0xc4, 0x04, 0x61, 0x05,
+ 0x00, 0xb6, 0xc4, 0x05, 0x62, 0x05, 0x00, 0x62,
+ 0x02, 0x00, 0xa4, 0x69, 0x85, 0x00, 0x00, 0x00,
+ 0x61, 0x08, 0x00, 0x61, 0x07, 0x00, 0x61, 0x06,
+ 0x00, 0x62, 0x00, 0x00, 0x62, 0x05, 0x00, 0x47,
+ 0x38, 0x45, 0x00, 0x00, 0x00, 0xac, 0xeb, 0x0c,
+ 0x62, 0x00, 0x00, 0x62, 0x05, 0x00, 0x71, 0x26,
+ 0x00, 0x00, 0x49, 0x62, 0x00, 0x00, 0x62, 0x05,
+ 0x00, 0x47, 0x62, 0x03, 0x00, 0x71, 0xe0, 0x62,
+ 0x04, 0x00, 0x62, 0x05, 0x00, 0xf1, 0xeb, 0x0a,
+ 0x62, 0x04, 0x00, 0x62, 0x05, 0x00, 0x47, 0xed,
+ 0x02, 0xc2, 0x16, 0x49, 0xc4, 0x06, 0x62, 0x01,
+ 0x00, 0x62, 0x03, 0x00, 0x47, 0x11, 0xec, 0x03,
+ 0x0e, 0xb6, 0xc4, 0x07, 0xde, 0x62, 0x06, 0x00,
+ 0xf0, 0xc4, 0x08, 0x62, 0x01, 0x00, 0x62, 0x03,
+ 0x00, 0x71, 0x38, 0x9c, 0x00, 0x00, 0x00, 0x42,
+ 0x9c, 0x01, 0x00, 0x00, 0x62, 0x07, 0x00, 0x62,
+ 0x08, 0x00, 0x24, 0x02, 0x00, 0x49, 0x62, 0x05,
+ 0x00, 0x92, 0x63, 0x05, 0x00, 0x0e, 0xee, 0x75,
+ 0xff, 0x62, 0x03, 0x00, 0x92, 0x63, 0x03, 0x00,
+ 0x0e, 0xee, 0x4f, 0xff, 0x62, 0x01, 0x00, 0x42,
+ 0x5f, 0x01, 0x00, 0x00, 0xc1, 0x02, 0x24, 0x01,
+ 0x00, 0xc4, 0x09, 0xc2, 0x42, 0x5b, 0x00, 0x00,
+ 0x00, 0x65, 0x01, 0x00, 0x41, 0xf4, 0x00, 0x00,
  0x00, 0x62, 0x09, 0x00, 0x42, 0x5a, 0x00, 0x00,
- 0x00, 0x65, 0x01, 0x00, 0x41, 0xf1, 0x00, 0x00,
- 0x00, 0x24, 0x01, 0x00, 0x24, 0x02, 0x00, 0x9e,
- 0xc2, 0x42, 0x5b, 0x00, 0x00, 0x00, 0x65, 0x01,
- 0x00, 0x41, 0x01, 0x01, 0x00, 0x00, 0x04, 0x69,
- 0x01, 0x00, 0x00, 0x24, 0x02, 0x00, 0x9e, 0xc4,
- 0x0a, 0x61, 0x0b, 0x00, 0x62, 0x00, 0x00, 0x7d,
- 0xed, 0x22, 0xc4, 0x0b, 0x62, 0x0a, 0x00, 0xc2,
- 0x42, 0x5b, 0x00, 0x00, 0x00, 0xe1, 0x62, 0x0b,
- 0x00, 0x62, 0x01, 0x00, 0xf1, 0x04, 0x69, 0x01,
- 0x00, 0x00, 0x24, 0x02, 0x00, 0x9e, 0x11, 0x63,
- 0x0a, 0x00, 0x0e, 0x80, 0x00, 0xeb, 0xdc, 0x0e,
- 0x83, 0x62, 0x0a, 0x00, 0xc2, 0x42, 0x5b, 0x00,
- 0x00, 0x00, 0x65, 0x01, 0x00, 0x41, 0xfd, 0x00,
- 0x00, 0x00, 0x62, 0x09, 0x00, 0x42, 0x5a, 0x00,
- 0x00, 0x00, 0x65, 0x01, 0x00, 0x41, 0xff, 0x00,
- 0x00, 0x00, 0x24, 0x01, 0x00, 0x24, 0x02, 0x00,
- 0x65, 0x01, 0x00, 0x41, 0xfb, 0x00, 0x00, 0x00,
- 0x9e, 0x9e, 0x11, 0x63, 0x0a, 0x00, 0x0e, 0x62,
- 0x0a, 0x00, 0x28, 0xc0, 0x03, 0xb5, 0x03, 0x1d,
- 0x4e, 0x17, 0x3f, 0x21, 0x13, 0x18, 0x62, 0x26,
- 0x8a, 0x4e, 0x3b, 0xb2, 0x49, 0x26, 0x8a, 0x3a,
- 0x3b, 0x4f, 0x21, 0xb7, 0xad, 0xbc, 0x63, 0x3a,
- 0x9e, 0x22, 0x30, 0x99, 0x4f, 0x0e, 0x42, 0x06,
- 0x01, 0x00, 0x01, 0x00, 0x01, 0x02, 0x01, 0x00,
- 0x05, 0x01, 0xba, 0x06, 0x00, 0x01, 0x00, 0xd4,
- 0x03, 0x00, 0x00, 0xde, 0xd2, 0x23, 0x01, 0x00,
- 0xc0, 0x03, 0xb7, 0x03, 0x00, 0x0e, 0x42, 0x06,
- 0x01, 0x00, 0x02, 0x00, 0x02, 0x04, 0x00, 0x00,
- 0x10, 0x02, 0x9e, 0x05, 0x00, 0x01, 0x00, 0xbc,
- 0x06, 0x00, 0x01, 0x00, 0x38, 0x9c, 0x00, 0x00,
- 0x00, 0x42, 0x9c, 0x01, 0x00, 0x00, 0xd2, 0xd3,
- 0xea, 0x25, 0x02, 0x00, 0xc0, 0x03, 0xb9, 0x03,
- 0x00, 0x0e, 0x42, 0x06, 0x01, 0x00, 0x01, 0x00,
- 0x01, 0x04, 0x01, 0x00, 0x13, 0x01, 0xda, 0x04,
- 0x00, 0x01, 0x00, 0xce, 0x03, 0x01, 0x0c, 0x65,
- 0x00, 0x00, 0x41, 0xef, 0x00, 0x00, 0x00, 0x42,
- 0x90, 0x01, 0x00, 0x00, 0xd2, 0xb8, 0x9e, 0x25,
- 0x01, 0x00, 0xc0, 0x03, 0xca, 0x03, 0x00, 0x0e,
- 0x40, 0x07, 0x01, 0x00, 0x01, 0x00, 0x00, 0x04,
- 0x01, 0x00, 0x12, 0x01, 0xdc, 0x04, 0x00, 0x01,
- 0x00, 0xc6, 0x03, 0x01, 0x00, 0x0d, 0x00, 0x00,
- 0xd6, 0xde, 0x26, 0x00, 0x00, 0xb6, 0xd2, 0x52,
- 0x0e, 0x06, 0x1b, 0x27, 0x00, 0x00, 0x29, 0xc0,
- 0x03, 0xe0, 0x03, 0x02, 0x17, 0x44, 0x0e, 0x40,
- 0x07, 0x01, 0x00, 0x01, 0x00, 0x00, 0x04, 0x01,
- 0x00, 0x12, 0x01, 0xdc, 0x04, 0x00, 0x01, 0x00,
- 0xc6, 0x03, 0x01, 0x00, 0x0d, 0x00, 0x00, 0xd6,
- 0xde, 0x26, 0x00, 0x00, 0xb6, 0xd2, 0x52, 0x0e,
- 0x06, 0x1b, 0x27, 0x00, 0x00, 0x29, 0xc0, 0x03,
- 0xe4, 0x03, 0x02, 0x17, 0x44, 0x0e, 0x40, 0x07,
+ 0x00, 0x65, 0x01, 0x00, 0x41, 0xf8, 0x00, 0x00,
+ 0x00, 0x24, 0x01, 0x00, 0x24, 0x02, 0x00, 0xc2,
+ 0x42, 0x5b, 0x00, 0x00, 0x00, 0x65, 0x01, 0x00,
+ 0x41, 0xf2, 0x00, 0x00, 0x00, 0x04, 0x68, 0x01,
+ 0x00, 0x00, 0xe1, 0xd2, 0x62, 0x01, 0x00, 0xf1,
+ 0x04, 0x68, 0x01, 0x00, 0x00, 0x24, 0x04, 0x00,
+ 0x9e, 0xc2, 0x42, 0x5b, 0x00, 0x00, 0x00, 0x65,
+ 0x01, 0x00, 0x41, 0xf6, 0x00, 0x00, 0x00, 0x62,
+ 0x09, 0x00, 0x42, 0x5a, 0x00, 0x00, 0x00, 0x65,
+ 0x01, 0x00, 0x41, 0xf0, 0x00, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0x24, 0x02, 0x00, 0x9e, 0xc2, 0x42,
+ 0x5b, 0x00, 0x00, 0x00, 0x65, 0x01, 0x00, 0x41,
+ 0x00, 0x01, 0x00, 0x00, 0x04, 0x68, 0x01, 0x00,
+ 0x00, 0x24, 0x02, 0x00, 0x9e, 0xc4, 0x0a, 0x61,
+ 0x0b, 0x00, 0x62, 0x00, 0x00, 0x7d, 0xed, 0x22,
+ 0xc4, 0x0b, 0x62, 0x0a, 0x00, 0xc2, 0x42, 0x5b,
+ 0x00, 0x00, 0x00, 0xe1, 0x62, 0x0b, 0x00, 0x62,
+ 0x01, 0x00, 0xf1, 0x04, 0x68, 0x01, 0x00, 0x00,
+ 0x24, 0x02, 0x00, 0x9e, 0x11, 0x63, 0x0a, 0x00,
+ 0x0e, 0x80, 0x00, 0xeb, 0xdc, 0x0e, 0x83, 0x62,
+ 0x0a, 0x00, 0xc2, 0x42, 0x5b, 0x00, 0x00, 0x00,
+ 0x65, 0x01, 0x00, 0x41, 0xfc, 0x00, 0x00, 0x00,
+ 0x62, 0x09, 0x00, 0x42, 0x5a, 0x00, 0x00, 0x00,
+ 0x65, 0x01, 0x00, 0x41, 0xfe, 0x00, 0x00, 0x00,
+ 0x24, 0x01, 0x00, 0x24, 0x02, 0x00, 0x65, 0x01,
+ 0x00, 0x41, 0xfa, 0x00, 0x00, 0x00, 0x9e, 0x9e,
+ 0x11, 0x63, 0x0a, 0x00, 0x0e, 0x62, 0x0a, 0x00,
+ 0x28, 0xc0, 0x03, 0xb9, 0x03, 0x1d, 0x4e, 0x17,
+ 0x3f, 0x21, 0x13, 0x18, 0x62, 0x26, 0x8a, 0x4e,
+ 0x3b, 0xb2, 0x49, 0x26, 0x8a, 0x3a, 0x3b, 0x4f,
+ 0x21, 0xb7, 0xad, 0xbc, 0x63, 0x3a, 0x9e, 0x22,
+ 0x30, 0x99, 0x4f, 0x0e, 0x42, 0x06, 0x01, 0x00,
+ 0x01, 0x00, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01,
+ 0xba, 0x06, 0x00, 0x01, 0x00, 0xd4, 0x03, 0x00,
+ 0x00, 0xde, 0xd2, 0x23, 0x01, 0x00, 0xc0, 0x03,
+ 0xbb, 0x03, 0x00, 0x0e, 0x42, 0x06, 0x01, 0x00,
+ 0x02, 0x00, 0x02, 0x04, 0x00, 0x00, 0x10, 0x02,
+ 0x9c, 0x05, 0x00, 0x01, 0x00, 0xbc, 0x06, 0x00,
+ 0x01, 0x00, 0x38, 0x9c, 0x00, 0x00, 0x00, 0x42,
+ 0x9c, 0x01, 0x00, 0x00, 0xd2, 0xd3, 0xea, 0x25,
+ 0x02, 0x00, 0xc0, 0x03, 0xbd, 0x03, 0x00, 0x0e,
+ 0x42, 0x06, 0x01, 0x00, 0x01, 0x00, 0x01, 0x04,
+ 0x01, 0x00, 0x13, 0x01, 0xd8, 0x04, 0x00, 0x01,
+ 0x00, 0xce, 0x03, 0x01, 0x0c, 0x65, 0x00, 0x00,
+ 0x41, 0xee, 0x00, 0x00, 0x00, 0x42, 0x90, 0x01,
+ 0x00, 0x00, 0xd2, 0xb8, 0x9e, 0x25, 0x01, 0x00,
+ 0xc0, 0x03, 0xce, 0x03, 0x00, 0x0e, 0x40, 0x07,
  0x01, 0x00, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00,
- 0x12, 0x01, 0xdc, 0x04, 0x00, 0x01, 0x00, 0xc8,
- 0x03, 0x02, 0x00, 0x0d, 0x00, 0x00, 0xd6, 0xde,
+ 0x12, 0x01, 0xda, 0x04, 0x00, 0x01, 0x00, 0xc6,
+ 0x03, 0x01, 0x00, 0x0d, 0x00, 0x00, 0xd6, 0xde,
  0x26, 0x00, 0x00, 0xb6, 0xd2, 0x52, 0x0e, 0x06,
- 0x1b, 0x27, 0x00, 0x00, 0x29, 0xc0, 0x03, 0xe8,
+ 0x1b, 0x27, 0x00, 0x00, 0x29, 0xc0, 0x03, 0xe4,
  0x03, 0x02, 0x17, 0x44, 0x0e, 0x40, 0x07, 0x01,
  0x00, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x12,
- 0x01, 0xdc, 0x04, 0x00, 0x01, 0x00, 0xc8, 0x03,
- 0x02, 0x00, 0x0d, 0x00, 0x00, 0xd6, 0xde, 0x26,
+ 0x01, 0xda, 0x04, 0x00, 0x01, 0x00, 0xc6, 0x03,
+ 0x01, 0x00, 0x0d, 0x00, 0x00, 0xd6, 0xde, 0x26,
  0x00, 0x00, 0xb6, 0xd2, 0x52, 0x0e, 0x06, 0x1b,
- 0x27, 0x00, 0x00, 0x29, 0xc0, 0x03, 0xec, 0x03,
+ 0x27, 0x00, 0x00, 0x29, 0xc0, 0x03, 0xe8, 0x03,
  0x02, 0x17, 0x44, 0x0e, 0x40, 0x07, 0x01, 0x00,
- 0x02, 0x01, 0x01, 0x05, 0x00, 0x00, 0x1d, 0x03,
- 0xbe, 0x06, 0x00, 0x01, 0x00, 0xdc, 0x04, 0x00,
- 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x08, 0xca,
- 0x0d, 0x01, 0x00, 0xd7, 0xd2, 0x97, 0xeb, 0x13,
- 0xc6, 0x42, 0x0b, 0x01, 0x00, 0x00, 0x26, 0x00,
- 0x00, 0xb6, 0xd3, 0x52, 0x0e, 0x18, 0x27, 0x00,
- 0x00, 0x0e, 0x29, 0xc0, 0x03, 0xf0, 0x03, 0x03,
- 0x21, 0x17, 0x5e, 0x0e, 0x42, 0x07, 0x01, 0x00,
+ 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x12, 0x01,
+ 0xda, 0x04, 0x00, 0x01, 0x00, 0xc8, 0x03, 0x02,
+ 0x00, 0x0d, 0x00, 0x00, 0xd6, 0xde, 0x26, 0x00,
+ 0x00, 0xb6, 0xd2, 0x52, 0x0e, 0x06, 0x1b, 0x27,
+ 0x00, 0x00, 0x29, 0xc0, 0x03, 0xec, 0x03, 0x02,
+ 0x17, 0x44, 0x0e, 0x40, 0x07, 0x01, 0x00, 0x01,
+ 0x00, 0x00, 0x04, 0x01, 0x00, 0x12, 0x01, 0xda,
+ 0x04, 0x00, 0x01, 0x00, 0xc8, 0x03, 0x02, 0x00,
+ 0x0d, 0x00, 0x00, 0xd6, 0xde, 0x26, 0x00, 0x00,
+ 0xb6, 0xd2, 0x52, 0x0e, 0x06, 0x1b, 0x27, 0x00,
+ 0x00, 0x29, 0xc0, 0x03, 0xf0, 0x03, 0x02, 0x17,
+ 0x44, 0x0e, 0x40, 0x07, 0x01, 0x00, 0x02, 0x01,
+ 0x01, 0x05, 0x00, 0x00, 0x1d, 0x03, 0xbe, 0x06,
+ 0x00, 0x01, 0x00, 0xda, 0x04, 0x00, 0x01, 0x00,
+ 0x10, 0x00, 0x01, 0x00, 0x08, 0xca, 0x0d, 0x01,
+ 0x00, 0xd7, 0xd2, 0x97, 0xeb, 0x13, 0xc6, 0x42,
+ 0x0a, 0x01, 0x00, 0x00, 0x26, 0x00, 0x00, 0xb6,
+ 0xd3, 0x52, 0x0e, 0x18, 0x27, 0x00, 0x00, 0x0e,
+ 0x29, 0xc0, 0x03, 0xf4, 0x03, 0x03, 0x21, 0x17,
+ 0x5e, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x01, 0x01,
+ 0x01, 0x03, 0x00, 0x00, 0x0d, 0x02, 0x82, 0x06,
+ 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x08,
+ 0xca, 0xc6, 0x42, 0x07, 0x01, 0x00, 0x00, 0xd2,
+ 0x24, 0x01, 0x00, 0x29, 0xc0, 0x03, 0xfa, 0x03,
+ 0x02, 0x0d, 0x35, 0x0e, 0x42, 0x07, 0x01, 0x00,
  0x01, 0x01, 0x01, 0x03, 0x00, 0x00, 0x0d, 0x02,
- 0x84, 0x06, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
- 0x00, 0x08, 0xca, 0xc6, 0x42, 0x08, 0x01, 0x00,
+ 0x82, 0x06, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
+ 0x00, 0x08, 0xca, 0xc6, 0x42, 0x0c, 0x01, 0x00,
  0x00, 0xd2, 0x24, 0x01, 0x00, 0x29, 0xc0, 0x03,
- 0xf6, 0x03, 0x02, 0x0d, 0x35, 0x0e, 0x42, 0x07,
- 0x01, 0x00, 0x01, 0x01, 0x01, 0x03, 0x00, 0x00,
- 0x0d, 0x02, 0x84, 0x06, 0x00, 0x01, 0x00, 0x10,
- 0x00, 0x01, 0x00, 0x08, 0xca, 0xc6, 0x42, 0x0d,
- 0x01, 0x00, 0x00, 0xd2, 0x24, 0x01, 0x00, 0x29,
- 0xc0, 0x03, 0xfa, 0x03, 0x02, 0x0d, 0x35, 0x0e,
- 0x42, 0x07, 0x01, 0x00, 0x02, 0x11, 0x02, 0x06,
- 0x02, 0x05, 0xb1, 0x03, 0x13, 0xc0, 0x06, 0x00,
- 0x01, 0x00, 0xc2, 0x06, 0x00, 0x01, 0x80, 0xc4,
- 0x06, 0x01, 0x00, 0xe0, 0xc6, 0x06, 0x01, 0x01,
- 0xe0, 0xd4, 0x01, 0x01, 0x02, 0xe0, 0xc8, 0x06,
- 0x01, 0x03, 0xe0, 0xca, 0x06, 0x01, 0x04, 0x60,
- 0xcc, 0x06, 0x01, 0x05, 0xe0, 0xce, 0x06, 0x01,
- 0x06, 0xc0, 0xd0, 0x06, 0x01, 0x07, 0x60, 0xd2,
- 0x06, 0x01, 0x08, 0x60, 0xd4, 0x06, 0x01, 0x09,
- 0x60, 0xd6, 0x06, 0x01, 0x0a, 0x60, 0x90, 0x05,
- 0x09, 0x10, 0xc0, 0xd8, 0x06, 0x01, 0x0b, 0x60,
- 0xda, 0x06, 0x01, 0x0d, 0x60, 0xdc, 0x06, 0x01,
- 0x0e, 0x60, 0xde, 0x06, 0x01, 0x0f, 0x60, 0x10,
- 0x00, 0x01, 0x80, 0xc4, 0x03, 0x00, 0x0c, 0xd8,
- 0x03, 0x0a, 0x00, 0x08, 0xc4, 0x10, 0x61, 0x0f,
- 0x00, 0x61, 0x0e, 0x00, 0x61, 0x0d, 0x00, 0x61,
- 0x0c, 0x00, 0x61, 0x0a, 0x00, 0x61, 0x09, 0x00,
- 0x61, 0x08, 0x00, 0x61, 0x07, 0x00, 0x61, 0x06,
- 0x00, 0x61, 0x05, 0x00, 0x61, 0x04, 0x00, 0x61,
- 0x03, 0x00, 0x61, 0x02, 0x00, 0x61, 0x01, 0x00,
- 0x61, 0x00, 0x00, 0xd3, 0x38, 0x45, 0x00, 0x00,
- 0x00, 0xad, 0xeb, 0x27, 0x38, 0x95, 0x00, 0x00,
- 0x00, 0x42, 0x1b, 0x01, 0x00, 0x00, 0xd3, 0x24,
- 0x01, 0x00, 0x97, 0xeb, 0x16, 0x38, 0x96, 0x00,
- 0x00, 0x00, 0x11, 0x04, 0xb0, 0x01, 0x00, 0x00,
- 0x04, 0xb1, 0x01, 0x00, 0x00, 0x9e, 0x21, 0x01,
- 0x00, 0x2f, 0xd2, 0xf4, 0x11, 0xec, 0x0a, 0x0e,
- 0xd2, 0x98, 0x04, 0x49, 0x00, 0x00, 0x00, 0xad,
- 0xeb, 0x0c, 0xc3, 0x10, 0x42, 0x08, 0x01, 0x00,
- 0x00, 0xd2, 0x25, 0x01, 0x00, 0x0b, 0xca, 0x26,
- 0x00, 0x00, 0xcb, 0x26, 0x00, 0x00, 0xcc, 0xc1,
- 0x00, 0x4d, 0xa4, 0x01, 0x00, 0x00, 0xcd, 0xc1,
- 0x01, 0x4d, 0xa5, 0x01, 0x00, 0x00, 0xc4, 0x04,
- 0xc1, 0x02, 0x4d, 0xa6, 0x01, 0x00, 0x00, 0xc4,
- 0x05, 0x06, 0xc4, 0x06, 0xd2, 0x38, 0xb8, 0x00,
- 0x00, 0x00, 0xa8, 0xc4, 0x07, 0xd2, 0x38, 0xb7,
- 0x00, 0x00, 0x00, 0xa8, 0xc4, 0x08, 0x04, 0xb2,
- 0x01, 0x00, 0x00, 0xc4, 0x09, 0x62, 0x07, 0x00,
- 0x11, 0xec, 0x05, 0x0e, 0x62, 0x08, 0x00, 0xeb,
- 0x08, 0x04, 0xb3, 0x01, 0x00, 0x00, 0xed, 0x06,
- 0x04, 0xb4, 0x01, 0x00, 0x00, 0xc4, 0x0a, 0xd2,
- 0x38, 0xb8, 0x00, 0x00, 0x00, 0xa8, 0xeb, 0x0f,
- 0x26, 0x00, 0x00, 0xb6, 0xd2, 0x52, 0x0e, 0x11,
- 0x63, 0x06, 0x00, 0x0e, 0xed, 0x2d, 0xd2, 0x38,
- 0xb7, 0x00, 0x00, 0x00, 0xa8, 0xeb, 0x1e, 0x61,
- 0x0b, 0x00, 0xb6, 0xc4, 0x0b, 0x0b, 0x11, 0x63,
- 0x06, 0x00, 0x0e, 0xd2, 0x42, 0x46, 0x01, 0x00,
- 0x00, 0xc1, 0x03, 0x24, 0x01, 0x00, 0x0e, 0x68,
- 0x0b, 0x00, 0xed, 0x07, 0xd2, 0x11, 0x63, 0x06,
- 0x00, 0x0e, 0x38, 0x94, 0x00, 0x00, 0x00, 0x42,
- 0x4b, 0x01, 0x00, 0x00, 0x62, 0x06, 0x00, 0x24,
- 0x01, 0x00, 0x42, 0x46, 0x01, 0x00, 0x00, 0xc1,
- 0x04, 0x24, 0x01, 0x00, 0x0e, 0x38, 0x94, 0x00,
- 0x00, 0x00, 0x42, 0x4b, 0x01, 0x00, 0x00, 0x62,
- 0x00, 0x00, 0x24, 0x01, 0x00, 0xc4, 0x0c, 0x38,
- 0x94, 0x00, 0x00, 0x00, 0x42, 0x6a, 0x00, 0x00,
- 0x00, 0x62, 0x00, 0x00, 0x24, 0x01, 0x00, 0xc4,
- 0x0d, 0x62, 0x0a, 0x00, 0x26, 0x01, 0x00, 0xb7,
- 0xd3, 0x11, 0xec, 0x22, 0x0e, 0x26, 0x00, 0x00,
- 0xb6, 0x62, 0x0c, 0x00, 0x52, 0x62, 0x08, 0x00,
- 0x97, 0x11, 0xeb, 0x0f, 0x0e, 0x62, 0x02, 0x00,
- 0xea, 0xb6, 0xa6, 0x11, 0xeb, 0x05, 0x0e, 0x62,
- 0x09, 0x00, 0x51, 0x90, 0x0e, 0x52, 0x0e, 0x42,
- 0xb5, 0x01, 0x00, 0x00, 0x38, 0x99, 0x00, 0x00,
- 0x00, 0x24, 0x01, 0x00, 0xc4, 0x0e, 0x62, 0x01,
- 0x00, 0x26, 0x01, 0x00, 0xb7, 0x62, 0x0d, 0x00,
- 0x52, 0x62, 0x02, 0x00, 0x51, 0x90, 0x0e, 0xc4,
- 0x0f, 0x62, 0x04, 0x00, 0x62, 0x0e, 0x00, 0x62,
- 0x0f, 0x00, 0xf1, 0x29, 0xc0, 0x03, 0xfe, 0x03,
- 0x31, 0xf3, 0x85, 0x3a, 0x1c, 0x08, 0x12, 0x09,
- 0x53, 0x3c, 0x0d, 0x17, 0x18, 0x2b, 0x00, 0x09,
- 0x08, 0x31, 0x12, 0x30, 0x30, 0x26, 0x86, 0x30,
- 0x3f, 0x49, 0x12, 0x22, 0x00, 0x06, 0x08, 0x0d,
- 0x26, 0x0d, 0x23, 0x00, 0x15, 0x32, 0x0d, 0x18,
- 0x5d, 0x5e, 0x26, 0x30, 0x17, 0x7b, 0x0d, 0x4e,
- 0x63, 0x35, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x01,
- 0x00, 0x01, 0x02, 0x01, 0x00, 0x07, 0x01, 0x80,
- 0x01, 0x00, 0x01, 0x00, 0xc4, 0x03, 0x00, 0x0c,
- 0x65, 0x00, 0x00, 0xd2, 0x23, 0x01, 0x00, 0xc0,
- 0x03, 0x8e, 0x04, 0x00, 0x0e, 0x42, 0x07, 0x01,
- 0x00, 0x02, 0x00, 0x02, 0x05, 0x02, 0x00, 0x0d,
- 0x02, 0xdc, 0x06, 0x00, 0x01, 0x00, 0xde, 0x06,
- 0x00, 0x01, 0x00, 0x10, 0x10, 0x01, 0xd8, 0x03,
- 0x01, 0x00, 0xde, 0x42, 0x08, 0x01, 0x00, 0x00,
- 0xdf, 0xd2, 0xd3, 0xf1, 0x25, 0x01, 0x00, 0xc0,
- 0x03, 0x8f, 0x04, 0x00, 0x0e, 0x42, 0x07, 0x01,
- 0x00, 0x02, 0x00, 0x02, 0x07, 0x01, 0x01, 0x30,
- 0x02, 0x80, 0x01, 0x00, 0x01, 0x00, 0xec, 0x06,
- 0x00, 0x01, 0x00, 0xc8, 0x06, 0x03, 0x0d, 0x26,
- 0x00, 0x00, 0xb6, 0xd3, 0xeb, 0x1d, 0x26, 0x00,
- 0x00, 0xb6, 0x38, 0x95, 0x00, 0x00, 0x00, 0x11,
- 0xd3, 0x21, 0x01, 0x00, 0x52, 0x0e, 0x42, 0x60,
- 0x01, 0x00, 0x00, 0xc1, 0x00, 0x24, 0x01, 0x00,
- 0xed, 0x04, 0x26, 0x00, 0x00, 0x52, 0x65, 0x00,
- 0x00, 0xd2, 0xf0, 0x51, 0x90, 0x0e, 0x28, 0xc0,
- 0x03, 0x90, 0x04, 0x03, 0x17, 0xb2, 0x2b, 0x0e,
- 0x42, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01,
- 0x00, 0x00, 0x02, 0x00, 0xc2, 0x28, 0xc0, 0x03,
- 0x91, 0x04, 0x00, 0x0e, 0x42, 0x07, 0x01, 0x00,
- 0x02, 0x00, 0x02, 0x04, 0x02, 0x00, 0x1d, 0x02,
- 0x8a, 0x06, 0x00, 0x01, 0x00, 0xee, 0x06, 0x00,
- 0x01, 0x00, 0xce, 0x06, 0x06, 0x09, 0x90, 0x05,
- 0x0b, 0x09, 0x65, 0x00, 0x00, 0x65, 0x01, 0x00,
- 0x71, 0x0b, 0xd3, 0x4c, 0xb8, 0x01, 0x00, 0x00,
- 0xd2, 0x4c, 0xb2, 0x01, 0x00, 0x00, 0x49, 0x65,
- 0x01, 0x00, 0x92, 0x66, 0x01, 0x00, 0x29, 0xc0,
- 0x03, 0xa2, 0x04, 0x03, 0x03, 0x6c, 0x26, 0x0e,
- 0x42, 0x07, 0x01, 0x00, 0x02, 0x01, 0x02, 0x04,
- 0x07, 0x01, 0x65, 0x03, 0xee, 0x06, 0x00, 0x01,
- 0x00, 0x90, 0x05, 0x00, 0x01, 0x80, 0x80, 0x01,
- 0x01, 0x00, 0x60, 0xc2, 0x06, 0x01, 0x03, 0xc4,
- 0x06, 0x00, 0x0d, 0xc8, 0x06, 0x03, 0x0d, 0xcc,
- 0x06, 0x05, 0x0d, 0xce, 0x06, 0x06, 0x09, 0xd4,
- 0x01, 0x02, 0x0d, 0xc6, 0x06, 0x01, 0x0d, 0x61,
- 0x00, 0x00, 0x65, 0x04, 0x00, 0xd2, 0x47, 0xca,
- 0x62, 0x00, 0x00, 0xf4, 0xec, 0x37, 0x62, 0x00,
- 0x00, 0x98, 0x04, 0x49, 0x00, 0x00, 0x00, 0xac,
- 0xeb, 0x2b, 0x38, 0x94, 0x00, 0x00, 0x00, 0x42,
- 0xb9, 0x01, 0x00, 0x00, 0x62, 0x00, 0x00, 0x24,
- 0x01, 0x00, 0x42, 0x46, 0x01, 0x00, 0x00, 0xc1,
- 0x00, 0x24, 0x01, 0x00, 0x0e, 0x65, 0x05, 0x00,
- 0x42, 0x32, 0x01, 0x00, 0x00, 0xc2, 0x24, 0x01,
- 0x00, 0x0e, 0xed, 0x14, 0x65, 0x05, 0x00, 0x42,
- 0x32, 0x01, 0x00, 0x00, 0x65, 0x02, 0x00, 0x62,
- 0x00, 0x00, 0xf0, 0x24, 0x01, 0x00, 0x0e, 0x65,
- 0x06, 0x00, 0x42, 0x32, 0x01, 0x00, 0x00, 0xd2,
- 0x24, 0x01, 0x00, 0x29, 0xc0, 0x03, 0xac, 0x04,
- 0x0c, 0x12, 0x22, 0x5d, 0x00, 0x15, 0x16, 0x0d,
- 0x18, 0x44, 0x0d, 0x64, 0x3f, 0x0e, 0x40, 0x07,
- 0x01, 0x00, 0x01, 0x02, 0x00, 0x05, 0x05, 0x00,
- 0x46, 0x03, 0x00, 0x00, 0x01, 0x00, 0xee, 0x06,
- 0x00, 0x00, 0x00, 0x8a, 0x06, 0x00, 0x01, 0x00,
- 0xc2, 0x06, 0x00, 0x02, 0xc4, 0x06, 0x01, 0x0c,
- 0xc8, 0x06, 0x02, 0x0c, 0xcc, 0x06, 0x03, 0x0c,
- 0x90, 0x05, 0x01, 0x03, 0xd2, 0x7d, 0x80, 0x00,
- 0x0e, 0xca, 0x80, 0x00, 0x0e, 0xcb, 0x83, 0xde,
- 0xeb, 0x0f, 0xde, 0x42, 0xba, 0x01, 0x00, 0x00,
- 0xc6, 0x24, 0x01, 0x00, 0x97, 0xeb, 0x02, 0x29,
- 0x65, 0x01, 0x00, 0xc6, 0x47, 0xeb, 0x15, 0x65,
- 0x01, 0x00, 0xc6, 0x47, 0x42, 0x32, 0x01, 0x00,
- 0x00, 0x65, 0x02, 0x00, 0xc7, 0xf0, 0x24, 0x01,
- 0x00, 0x0e, 0x29, 0x65, 0x01, 0x00, 0xc6, 0x71,
- 0x65, 0x03, 0x00, 0xc7, 0x5e, 0x04, 0x00, 0xf1,
- 0x49, 0x29, 0xc0, 0x03, 0xb1, 0x04, 0x07, 0x3a,
- 0x54, 0x09, 0x26, 0x62, 0x08, 0x4a, 0x0e, 0x40,
- 0x07, 0x01, 0x00, 0x01, 0x03, 0x00, 0x04, 0x00,
- 0x00, 0x8f, 0x01, 0x04, 0xdc, 0x04, 0x00, 0x01,
- 0x00, 0xf6, 0x06, 0x01, 0x00, 0x60, 0xf8, 0x06,
- 0x01, 0x01, 0x60, 0x10, 0x00, 0x01, 0x00, 0x08,
- 0xcc, 0x0d, 0x00, 0x00, 0xd6, 0x61, 0x01, 0x00,
- 0x61, 0x00, 0x00, 0x38, 0x96, 0x00, 0x00, 0x00,
- 0x11, 0x21, 0x00, 0x00, 0xca, 0x62, 0x00, 0x00,
- 0x04, 0xbd, 0x01, 0x00, 0x00, 0x43, 0x36, 0x00,
- 0x00, 0x00, 0x62, 0x00, 0x00, 0xd2, 0x42, 0x60,
- 0x01, 0x00, 0x00, 0x38, 0x98, 0x00, 0x00, 0x00,
- 0x24, 0x01, 0x00, 0x42, 0x5a, 0x00, 0x00, 0x00,
- 0x04, 0x33, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00,
- 0x43, 0x33, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00,
- 0x41, 0x35, 0x00, 0x00, 0x00, 0x42, 0x5c, 0x00,
- 0x00, 0x00, 0x04, 0x69, 0x01, 0x00, 0x00, 0x24,
- 0x01, 0x00, 0xcb, 0x62, 0x01, 0x00, 0x42, 0xbe,
- 0x01, 0x00, 0x00, 0xb6, 0xb7, 0x24, 0x02, 0x00,
- 0x0e, 0x62, 0x00, 0x00, 0x62, 0x01, 0x00, 0x42,
- 0x5a, 0x00, 0x00, 0x00, 0x04, 0x69, 0x01, 0x00,
- 0x00, 0x24, 0x01, 0x00, 0x43, 0x35, 0x00, 0x00,
- 0x00, 0xc8, 0x42, 0x0b, 0x01, 0x00, 0x00, 0x62,
- 0x00, 0x00, 0x24, 0x01, 0x00, 0x29, 0xc0, 0x03,
- 0xd5, 0x04, 0x08, 0x3f, 0x35, 0x44, 0xb2, 0x71,
- 0x49, 0x7b, 0x3f, 0x0e, 0x42, 0x07, 0x01, 0x00,
- 0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x0f, 0x01,
- 0x10, 0x00, 0x01, 0x00, 0xea, 0x01, 0x01, 0x0d,
- 0x08, 0xca, 0x2b, 0x65, 0x00, 0x00, 0x11, 0xeb,
- 0x06, 0xc6, 0x1b, 0x24, 0x00, 0x00, 0x29, 0xc0,
- 0x03, 0xde, 0x04, 0x00,
+ 0xfe, 0x03, 0x02, 0x0d, 0x35, 0x0e, 0x42, 0x07,
+ 0x01, 0x00, 0x02, 0x11, 0x02, 0x06, 0x02, 0x05,
+ 0xb1, 0x03, 0x13, 0xc0, 0x06, 0x00, 0x01, 0x00,
+ 0xc2, 0x06, 0x00, 0x01, 0x80, 0xc4, 0x06, 0x01,
+ 0x00, 0xe0, 0xc6, 0x06, 0x01, 0x01, 0xe0, 0xd4,
+ 0x01, 0x01, 0x02, 0xe0, 0xc8, 0x06, 0x01, 0x03,
+ 0xe0, 0xca, 0x06, 0x01, 0x04, 0x60, 0xcc, 0x06,
+ 0x01, 0x05, 0xe0, 0xce, 0x06, 0x01, 0x06, 0xc0,
+ 0xd0, 0x06, 0x01, 0x07, 0x60, 0xd2, 0x06, 0x01,
+ 0x08, 0x60, 0xd4, 0x06, 0x01, 0x09, 0x60, 0xd6,
+ 0x06, 0x01, 0x0a, 0x60, 0x8e, 0x05, 0x09, 0x10,
+ 0xc0, 0xd8, 0x06, 0x01, 0x0b, 0x60, 0xda, 0x06,
+ 0x01, 0x0d, 0x60, 0xdc, 0x06, 0x01, 0x0e, 0x60,
+ 0xde, 0x06, 0x01, 0x0f, 0x60, 0x10, 0x00, 0x01,
+ 0x80, 0xc4, 0x03, 0x00, 0x0c, 0xd8, 0x03, 0x0a,
+ 0x00, 0x08, 0xc4, 0x10, 0x61, 0x0f, 0x00, 0x61,
+ 0x0e, 0x00, 0x61, 0x0d, 0x00, 0x61, 0x0c, 0x00,
+ 0x61, 0x0a, 0x00, 0x61, 0x09, 0x00, 0x61, 0x08,
+ 0x00, 0x61, 0x07, 0x00, 0x61, 0x06, 0x00, 0x61,
+ 0x05, 0x00, 0x61, 0x04, 0x00, 0x61, 0x03, 0x00,
+ 0x61, 0x02, 0x00, 0x61, 0x01, 0x00, 0x61, 0x00,
+ 0x00, 0xd3, 0x38, 0x45, 0x00, 0x00, 0x00, 0xad,
+ 0xeb, 0x27, 0x38, 0x95, 0x00, 0x00, 0x00, 0x42,
+ 0x1a, 0x01, 0x00, 0x00, 0xd3, 0x24, 0x01, 0x00,
+ 0x97, 0xeb, 0x16, 0x38, 0x96, 0x00, 0x00, 0x00,
+ 0x11, 0x04, 0xb0, 0x01, 0x00, 0x00, 0x04, 0xb1,
+ 0x01, 0x00, 0x00, 0x9e, 0x21, 0x01, 0x00, 0x2f,
+ 0xd2, 0xf4, 0x11, 0xec, 0x0a, 0x0e, 0xd2, 0x98,
+ 0x04, 0x49, 0x00, 0x00, 0x00, 0xad, 0xeb, 0x0c,
+ 0xc3, 0x10, 0x42, 0x07, 0x01, 0x00, 0x00, 0xd2,
+ 0x25, 0x01, 0x00, 0x0b, 0xca, 0x26, 0x00, 0x00,
+ 0xcb, 0x26, 0x00, 0x00, 0xcc, 0xc1, 0x00, 0x4d,
+ 0xa4, 0x01, 0x00, 0x00, 0xcd, 0xc1, 0x01, 0x4d,
+ 0xa5, 0x01, 0x00, 0x00, 0xc4, 0x04, 0xc1, 0x02,
+ 0x4d, 0xa6, 0x01, 0x00, 0x00, 0xc4, 0x05, 0x06,
+ 0xc4, 0x06, 0xd2, 0x38, 0xb8, 0x00, 0x00, 0x00,
+ 0xa8, 0xc4, 0x07, 0xd2, 0x38, 0xb7, 0x00, 0x00,
+ 0x00, 0xa8, 0xc4, 0x08, 0x04, 0xb2, 0x01, 0x00,
+ 0x00, 0xc4, 0x09, 0x62, 0x07, 0x00, 0x11, 0xec,
+ 0x05, 0x0e, 0x62, 0x08, 0x00, 0xeb, 0x08, 0x04,
+ 0xb3, 0x01, 0x00, 0x00, 0xed, 0x06, 0x04, 0xb4,
+ 0x01, 0x00, 0x00, 0xc4, 0x0a, 0xd2, 0x38, 0xb8,
+ 0x00, 0x00, 0x00, 0xa8, 0xeb, 0x0f, 0x26, 0x00,
+ 0x00, 0xb6, 0xd2, 0x52, 0x0e, 0x11, 0x63, 0x06,
+ 0x00, 0x0e, 0xed, 0x2d, 0xd2, 0x38, 0xb7, 0x00,
+ 0x00, 0x00, 0xa8, 0xeb, 0x1e, 0x61, 0x0b, 0x00,
+ 0xb6, 0xc4, 0x0b, 0x0b, 0x11, 0x63, 0x06, 0x00,
+ 0x0e, 0xd2, 0x42, 0x45, 0x01, 0x00, 0x00, 0xc1,
+ 0x03, 0x24, 0x01, 0x00, 0x0e, 0x68, 0x0b, 0x00,
+ 0xed, 0x07, 0xd2, 0x11, 0x63, 0x06, 0x00, 0x0e,
+ 0x38, 0x94, 0x00, 0x00, 0x00, 0x42, 0x4a, 0x01,
+ 0x00, 0x00, 0x62, 0x06, 0x00, 0x24, 0x01, 0x00,
+ 0x42, 0x45, 0x01, 0x00, 0x00, 0xc1, 0x04, 0x24,
+ 0x01, 0x00, 0x0e, 0x38, 0x94, 0x00, 0x00, 0x00,
+ 0x42, 0x4a, 0x01, 0x00, 0x00, 0x62, 0x00, 0x00,
+ 0x24, 0x01, 0x00, 0xc4, 0x0c, 0x38, 0x94, 0x00,
+ 0x00, 0x00, 0x42, 0x6a, 0x00, 0x00, 0x00, 0x62,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0xc4, 0x0d, 0x62,
+ 0x0a, 0x00, 0x26, 0x01, 0x00, 0xb7, 0xd3, 0x11,
+ 0xec, 0x22, 0x0e, 0x26, 0x00, 0x00, 0xb6, 0x62,
+ 0x0c, 0x00, 0x52, 0x62, 0x08, 0x00, 0x97, 0x11,
+ 0xeb, 0x0f, 0x0e, 0x62, 0x02, 0x00, 0xea, 0xb6,
+ 0xa6, 0x11, 0xeb, 0x05, 0x0e, 0x62, 0x09, 0x00,
+ 0x51, 0x90, 0x0e, 0x52, 0x0e, 0x42, 0xb5, 0x01,
+ 0x00, 0x00, 0x38, 0x99, 0x00, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0xc4, 0x0e, 0x62, 0x01, 0x00, 0x26,
+ 0x01, 0x00, 0xb7, 0x62, 0x0d, 0x00, 0x52, 0x62,
+ 0x02, 0x00, 0x51, 0x90, 0x0e, 0xc4, 0x0f, 0x62,
+ 0x04, 0x00, 0x62, 0x0e, 0x00, 0x62, 0x0f, 0x00,
+ 0xf1, 0x29, 0xc0, 0x03, 0x82, 0x04, 0x31, 0xf3,
+ 0x85, 0x3a, 0x1c, 0x08, 0x12, 0x09, 0x53, 0x3c,
+ 0x0d, 0x17, 0x18, 0x2b, 0x00, 0x09, 0x08, 0x31,
+ 0x12, 0x30, 0x30, 0x26, 0x86, 0x30, 0x3f, 0x49,
+ 0x12, 0x22, 0x00, 0x06, 0x08, 0x0d, 0x26, 0x0d,
+ 0x23, 0x00, 0x15, 0x32, 0x0d, 0x18, 0x5d, 0x5e,
+ 0x26, 0x30, 0x17, 0x7b, 0x0d, 0x4e, 0x63, 0x35,
+ 0x0e, 0x42, 0x07, 0x01, 0x00, 0x01, 0x00, 0x01,
+ 0x02, 0x01, 0x00, 0x07, 0x01, 0x80, 0x01, 0x00,
+ 0x01, 0x00, 0xc4, 0x03, 0x00, 0x0c, 0x65, 0x00,
+ 0x00, 0xd2, 0x23, 0x01, 0x00, 0xc0, 0x03, 0x92,
+ 0x04, 0x00, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x02,
+ 0x00, 0x02, 0x05, 0x02, 0x00, 0x0d, 0x02, 0xdc,
+ 0x06, 0x00, 0x01, 0x00, 0xde, 0x06, 0x00, 0x01,
+ 0x00, 0x10, 0x10, 0x01, 0xd8, 0x03, 0x01, 0x00,
+ 0xde, 0x42, 0x07, 0x01, 0x00, 0x00, 0xdf, 0xd2,
+ 0xd3, 0xf1, 0x25, 0x01, 0x00, 0xc0, 0x03, 0x93,
+ 0x04, 0x00, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x02,
+ 0x00, 0x02, 0x07, 0x01, 0x01, 0x30, 0x02, 0x80,
+ 0x01, 0x00, 0x01, 0x00, 0xec, 0x06, 0x00, 0x01,
+ 0x00, 0xc8, 0x06, 0x03, 0x0d, 0x26, 0x00, 0x00,
+ 0xb6, 0xd3, 0xeb, 0x1d, 0x26, 0x00, 0x00, 0xb6,
+ 0x38, 0x95, 0x00, 0x00, 0x00, 0x11, 0xd3, 0x21,
+ 0x01, 0x00, 0x52, 0x0e, 0x42, 0x5f, 0x01, 0x00,
+ 0x00, 0xc1, 0x00, 0x24, 0x01, 0x00, 0xed, 0x04,
+ 0x26, 0x00, 0x00, 0x52, 0x65, 0x00, 0x00, 0xd2,
+ 0xf0, 0x51, 0x90, 0x0e, 0x28, 0xc0, 0x03, 0x94,
+ 0x04, 0x03, 0x17, 0xb2, 0x2b, 0x0e, 0x42, 0x07,
+ 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+ 0x02, 0x00, 0xc2, 0x28, 0xc0, 0x03, 0x95, 0x04,
+ 0x00, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x02, 0x00,
+ 0x02, 0x04, 0x02, 0x00, 0x1d, 0x02, 0x88, 0x06,
+ 0x00, 0x01, 0x00, 0xee, 0x06, 0x00, 0x01, 0x00,
+ 0xce, 0x06, 0x06, 0x09, 0x8e, 0x05, 0x0b, 0x09,
+ 0x65, 0x00, 0x00, 0x65, 0x01, 0x00, 0x71, 0x0b,
+ 0xd3, 0x4c, 0xb8, 0x01, 0x00, 0x00, 0xd2, 0x4c,
+ 0xb2, 0x01, 0x00, 0x00, 0x49, 0x65, 0x01, 0x00,
+ 0x92, 0x66, 0x01, 0x00, 0x29, 0xc0, 0x03, 0xa6,
+ 0x04, 0x03, 0x03, 0x6c, 0x26, 0x0e, 0x42, 0x07,
+ 0x01, 0x00, 0x02, 0x01, 0x02, 0x04, 0x07, 0x01,
+ 0x65, 0x03, 0xee, 0x06, 0x00, 0x01, 0x00, 0x8e,
+ 0x05, 0x00, 0x01, 0x80, 0x80, 0x01, 0x01, 0x00,
+ 0x60, 0xc2, 0x06, 0x01, 0x03, 0xc4, 0x06, 0x00,
+ 0x0d, 0xc8, 0x06, 0x03, 0x0d, 0xcc, 0x06, 0x05,
+ 0x0d, 0xce, 0x06, 0x06, 0x09, 0xd4, 0x01, 0x02,
+ 0x0d, 0xc6, 0x06, 0x01, 0x0d, 0x61, 0x00, 0x00,
+ 0x65, 0x04, 0x00, 0xd2, 0x47, 0xca, 0x62, 0x00,
+ 0x00, 0xf4, 0xec, 0x37, 0x62, 0x00, 0x00, 0x98,
+ 0x04, 0x49, 0x00, 0x00, 0x00, 0xac, 0xeb, 0x2b,
+ 0x38, 0x94, 0x00, 0x00, 0x00, 0x42, 0xb9, 0x01,
+ 0x00, 0x00, 0x62, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x42, 0x45, 0x01, 0x00, 0x00, 0xc1, 0x00, 0x24,
+ 0x01, 0x00, 0x0e, 0x65, 0x05, 0x00, 0x42, 0x31,
+ 0x01, 0x00, 0x00, 0xc2, 0x24, 0x01, 0x00, 0x0e,
+ 0xed, 0x14, 0x65, 0x05, 0x00, 0x42, 0x31, 0x01,
+ 0x00, 0x00, 0x65, 0x02, 0x00, 0x62, 0x00, 0x00,
+ 0xf0, 0x24, 0x01, 0x00, 0x0e, 0x65, 0x06, 0x00,
+ 0x42, 0x31, 0x01, 0x00, 0x00, 0xd2, 0x24, 0x01,
+ 0x00, 0x29, 0xc0, 0x03, 0xb0, 0x04, 0x0c, 0x12,
+ 0x22, 0x5d, 0x00, 0x15, 0x16, 0x0d, 0x18, 0x44,
+ 0x0d, 0x64, 0x3f, 0x0e, 0x40, 0x07, 0x01, 0x00,
+ 0x01, 0x02, 0x00, 0x05, 0x05, 0x00, 0x46, 0x03,
+ 0x00, 0x00, 0x01, 0x00, 0xee, 0x06, 0x00, 0x00,
+ 0x00, 0x88, 0x06, 0x00, 0x01, 0x00, 0xc2, 0x06,
+ 0x00, 0x02, 0xc4, 0x06, 0x01, 0x0c, 0xc8, 0x06,
+ 0x02, 0x0c, 0xcc, 0x06, 0x03, 0x0c, 0x8e, 0x05,
+ 0x01, 0x03, 0xd2, 0x7d, 0x80, 0x00, 0x0e, 0xca,
+ 0x80, 0x00, 0x0e, 0xcb, 0x83, 0xde, 0xeb, 0x0f,
+ 0xde, 0x42, 0xba, 0x01, 0x00, 0x00, 0xc6, 0x24,
+ 0x01, 0x00, 0x97, 0xeb, 0x02, 0x29, 0x65, 0x01,
+ 0x00, 0xc6, 0x47, 0xeb, 0x15, 0x65, 0x01, 0x00,
+ 0xc6, 0x47, 0x42, 0x31, 0x01, 0x00, 0x00, 0x65,
+ 0x02, 0x00, 0xc7, 0xf0, 0x24, 0x01, 0x00, 0x0e,
+ 0x29, 0x65, 0x01, 0x00, 0xc6, 0x71, 0x65, 0x03,
+ 0x00, 0xc7, 0x5e, 0x04, 0x00, 0xf1, 0x49, 0x29,
+ 0xc0, 0x03, 0xb5, 0x04, 0x07, 0x3a, 0x54, 0x09,
+ 0x26, 0x62, 0x08, 0x4a, 0x0e, 0x40, 0x07, 0x01,
+ 0x00, 0x01, 0x03, 0x00, 0x04, 0x00, 0x00, 0x8f,
+ 0x01, 0x04, 0xda, 0x04, 0x00, 0x01, 0x00, 0xf6,
+ 0x06, 0x01, 0x00, 0x60, 0xf8, 0x06, 0x01, 0x01,
+ 0x60, 0x10, 0x00, 0x01, 0x00, 0x08, 0xcc, 0x0d,
+ 0x00, 0x00, 0xd6, 0x61, 0x01, 0x00, 0x61, 0x00,
+ 0x00, 0x38, 0x96, 0x00, 0x00, 0x00, 0x11, 0x21,
+ 0x00, 0x00, 0xca, 0x62, 0x00, 0x00, 0x04, 0xbd,
+ 0x01, 0x00, 0x00, 0x43, 0x36, 0x00, 0x00, 0x00,
+ 0x62, 0x00, 0x00, 0xd2, 0x42, 0x5f, 0x01, 0x00,
+ 0x00, 0x38, 0x98, 0x00, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x42, 0x5a, 0x00, 0x00, 0x00, 0x04, 0x32,
+ 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x43, 0x33,
+ 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x41, 0x35,
+ 0x00, 0x00, 0x00, 0x42, 0x5c, 0x00, 0x00, 0x00,
+ 0x04, 0x68, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0xcb, 0x62, 0x01, 0x00, 0x42, 0xbe, 0x01, 0x00,
+ 0x00, 0xb6, 0xb7, 0x24, 0x02, 0x00, 0x0e, 0x62,
+ 0x00, 0x00, 0x62, 0x01, 0x00, 0x42, 0x5a, 0x00,
+ 0x00, 0x00, 0x04, 0x68, 0x01, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0x43, 0x35, 0x00, 0x00, 0x00, 0xc8,
+ 0x42, 0x0a, 0x01, 0x00, 0x00, 0x62, 0x00, 0x00,
+ 0x24, 0x01, 0x00, 0x29, 0xc0, 0x03, 0xd9, 0x04,
+ 0x08, 0x3f, 0x35, 0x44, 0xb2, 0x71, 0x49, 0x7b,
+ 0x3f, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x01,
+ 0x00, 0x02, 0x01, 0x00, 0x0f, 0x01, 0x10, 0x00,
+ 0x01, 0x00, 0xea, 0x01, 0x01, 0x0d, 0x08, 0xca,
+ 0x2b, 0x65, 0x00, 0x00, 0x11, 0xeb, 0x06, 0xc6,
+ 0x1b, 0x24, 0x00, 0x00, 0x29, 0xc0, 0x03, 0xe2,
+ 0x04, 0x00,
 };
 
 const uint32_t crypto_size = 726;
@@ -14659,227 +14676,364 @@ const uint8_t path[11659] = {
  0x71, 0x12, 0x3b,
 };
 
-const uint32_t performance_size = 1741;
+const uint32_t performance_size = 2835;
 
-const uint8_t performance[1741] = {
- 0x02, 0x21, 0x22, 0x40, 0x69, 0x6a, 0x6a, 0x73,
+const uint8_t performance[2835] = {
+ 0x02, 0x39, 0x22, 0x40, 0x69, 0x6a, 0x6a, 0x73,
  0x2f, 0x70, 0x65, 0x72, 0x66, 0x6f, 0x72, 0x6d,
  0x61, 0x6e, 0x63, 0x65, 0x16, 0x50, 0x65, 0x72,
  0x66, 0x6f, 0x72, 0x6d, 0x61, 0x6e, 0x63, 0x65,
- 0x10, 0x68, 0x72, 0x74, 0x69, 0x6d, 0x65, 0x4d,
- 0x73, 0x14, 0x74, 0x69, 0x6d, 0x65, 0x4f, 0x72,
- 0x69, 0x67, 0x69, 0x6e, 0x06, 0x6e, 0x6f, 0x77,
+ 0x1a, 0x6b, 0x4d, 0x61, 0x78, 0x47, 0x43, 0x45,
+ 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x10, 0x68,
+ 0x72, 0x74, 0x69, 0x6d, 0x65, 0x4d, 0x73, 0x14,
+ 0x74, 0x69, 0x6d, 0x65, 0x4f, 0x72, 0x69, 0x67,
+ 0x69, 0x6e, 0x28, 0x65, 0x76, 0x65, 0x6e, 0x74,
+ 0x4c, 0x6f, 0x6f, 0x70, 0x55, 0x74, 0x69, 0x6c,
+ 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x18,
+ 0x65, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x6f, 0x6f,
+ 0x70, 0x4c, 0x61, 0x67, 0x06, 0x6e, 0x6f, 0x77,
  0x08, 0x6d, 0x61, 0x72, 0x6b, 0x0e, 0x6d, 0x65,
  0x61, 0x73, 0x75, 0x72, 0x65, 0x20, 0x67, 0x65,
  0x74, 0x45, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73,
  0x42, 0x79, 0x54, 0x79, 0x70, 0x65, 0x20, 0x67,
  0x65, 0x74, 0x45, 0x6e, 0x74, 0x72, 0x69, 0x65,
- 0x73, 0x42, 0x79, 0x4e, 0x61, 0x6d, 0x65, 0x14,
- 0x63, 0x6c, 0x65, 0x61, 0x72, 0x4d, 0x61, 0x72,
- 0x6b, 0x73, 0x1a, 0x63, 0x6c, 0x65, 0x61, 0x72,
- 0x4d, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x73,
- 0x14, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74, 0x54,
- 0x69, 0x6d, 0x65, 0x10, 0x5f, 0x65, 0x6e, 0x74,
- 0x72, 0x69, 0x65, 0x73, 0x0c, 0x63, 0x72, 0x65,
- 0x61, 0x74, 0x65, 0x16, 0x5f, 0x6d, 0x61, 0x72,
- 0x6b, 0x73, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x12,
- 0x65, 0x6e, 0x74, 0x72, 0x79, 0x54, 0x79, 0x70,
- 0x65, 0x12, 0x73, 0x74, 0x61, 0x72, 0x74, 0x54,
- 0x69, 0x6d, 0x65, 0x10, 0x64, 0x75, 0x72, 0x61,
- 0x74, 0x69, 0x6f, 0x6e, 0x08, 0x70, 0x75, 0x73,
- 0x68, 0x12, 0x73, 0x74, 0x61, 0x72, 0x74, 0x4d,
- 0x61, 0x72, 0x6b, 0x0e, 0x65, 0x6e, 0x64, 0x4d,
- 0x61, 0x72, 0x6b, 0x0e, 0x65, 0x6e, 0x64, 0x54,
- 0x69, 0x6d, 0x65, 0x70, 0x46, 0x61, 0x69, 0x6c,
- 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x65, 0x78,
- 0x65, 0x63, 0x75, 0x74, 0x65, 0x20, 0x27, 0x6d,
- 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x27, 0x20,
- 0x6f, 0x6e, 0x20, 0x27, 0x50, 0x65, 0x72, 0x66,
- 0x6f, 0x72, 0x6d, 0x61, 0x6e, 0x63, 0x65, 0x27,
- 0x3a, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6d, 0x61,
- 0x72, 0x6b, 0x20, 0x27, 0x22, 0x27, 0x20, 0x64,
- 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20,
- 0x65, 0x78, 0x69, 0x73, 0x74, 0x2e, 0x08, 0x74,
- 0x79, 0x70, 0x65, 0x0c, 0x66, 0x69, 0x6c, 0x74,
- 0x65, 0x72, 0x0a, 0x65, 0x6e, 0x74, 0x72, 0x79,
- 0x08, 0x66, 0x69, 0x6e, 0x64, 0x0c, 0x73, 0x70,
- 0x6c, 0x69, 0x63, 0x65, 0x0e, 0x69, 0x6e, 0x64,
- 0x65, 0x78, 0x4f, 0x66, 0x02, 0x65, 0x08, 0x69,
- 0x6a, 0x6a, 0x73, 0x0c, 0x68, 0x72, 0x74, 0x69,
+ 0x73, 0x42, 0x79, 0x4e, 0x61, 0x6d, 0x65, 0x0e,
+ 0x63, 0x6c, 0x65, 0x61, 0x72, 0x47, 0x43, 0x1c,
+ 0x5f, 0x74, 0x61, 0x6b, 0x65, 0x47, 0x43, 0x45,
+ 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x14, 0x63,
+ 0x6c, 0x65, 0x61, 0x72, 0x4d, 0x61, 0x72, 0x6b,
+ 0x73, 0x1a, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x4d,
+ 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x73, 0x14,
+ 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74, 0x54, 0x69,
+ 0x6d, 0x65, 0x10, 0x5f, 0x65, 0x6e, 0x74, 0x72,
+ 0x69, 0x65, 0x73, 0x0c, 0x63, 0x72, 0x65, 0x61,
+ 0x74, 0x65, 0x16, 0x5f, 0x6d, 0x61, 0x72, 0x6b,
+ 0x73, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x10, 0x5f,
+ 0x67, 0x63, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x0a,
+ 0x75, 0x74, 0x69, 0x6c, 0x31, 0x0a, 0x75, 0x74,
+ 0x69, 0x6c, 0x32, 0x08, 0x69, 0x64, 0x6c, 0x65,
+ 0x0c, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x0a,
+ 0x74, 0x69, 0x63, 0x6b, 0x73, 0x08, 0x6a, 0x6f,
+ 0x62, 0x73, 0x08, 0x62, 0x61, 0x73, 0x65, 0x08,
+ 0x69, 0x6a, 0x6a, 0x73, 0x16, 0x6c, 0x6f, 0x6f,
+ 0x70, 0x4d, 0x65, 0x74, 0x72, 0x69, 0x63, 0x73,
+ 0x16, 0x75, 0x74, 0x69, 0x6c, 0x69, 0x7a, 0x61,
+ 0x74, 0x69, 0x6f, 0x6e, 0x16, 0x6a, 0x6f, 0x62,
+ 0x73, 0x50, 0x65, 0x72, 0x54, 0x69, 0x63, 0x6b,
+ 0x0a, 0x72, 0x65, 0x73, 0x65, 0x74, 0x06, 0x6c,
+ 0x61, 0x67, 0x12, 0x65, 0x6e, 0x74, 0x72, 0x79,
+ 0x54, 0x79, 0x70, 0x65, 0x12, 0x73, 0x74, 0x61,
+ 0x72, 0x74, 0x54, 0x69, 0x6d, 0x65, 0x10, 0x64,
+ 0x75, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x08,
+ 0x70, 0x75, 0x73, 0x68, 0x12, 0x73, 0x74, 0x61,
+ 0x72, 0x74, 0x4d, 0x61, 0x72, 0x6b, 0x0e, 0x65,
+ 0x6e, 0x64, 0x4d, 0x61, 0x72, 0x6b, 0x0e, 0x65,
+ 0x6e, 0x64, 0x54, 0x69, 0x6d, 0x65, 0x70, 0x46,
+ 0x61, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x6f,
+ 0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65,
+ 0x20, 0x27, 0x6d, 0x65, 0x61, 0x73, 0x75, 0x72,
+ 0x65, 0x27, 0x20, 0x6f, 0x6e, 0x20, 0x27, 0x50,
+ 0x65, 0x72, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x6e,
+ 0x63, 0x65, 0x27, 0x3a, 0x20, 0x54, 0x68, 0x65,
+ 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x20, 0x27, 0x22,
+ 0x27, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e,
+ 0x6f, 0x74, 0x20, 0x65, 0x78, 0x69, 0x73, 0x74,
+ 0x2e, 0x08, 0x74, 0x79, 0x70, 0x65, 0x0c, 0x66,
+ 0x69, 0x6c, 0x74, 0x65, 0x72, 0x0a, 0x65, 0x6e,
+ 0x74, 0x72, 0x79, 0x04, 0x67, 0x63, 0x0a, 0x66,
+ 0x72, 0x65, 0x65, 0x64, 0x10, 0x68, 0x65, 0x61,
+ 0x70, 0x53, 0x69, 0x7a, 0x65, 0x0c, 0x65, 0x78,
+ 0x63, 0x65, 0x73, 0x73, 0x12, 0x67, 0x63, 0x45,
+ 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x0c, 0x64,
+ 0x65, 0x74, 0x61, 0x69, 0x6c, 0x08, 0x66, 0x69,
+ 0x6e, 0x64, 0x0c, 0x73, 0x70, 0x6c, 0x69, 0x63,
+ 0x65, 0x0e, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x4f,
+ 0x66, 0x02, 0x65, 0x0c, 0x68, 0x72, 0x74, 0x69,
  0x6d, 0x65, 0x0f, 0xc0, 0x03, 0x00, 0x01, 0x00,
- 0x00, 0xc2, 0x03, 0x00, 0x00, 0x0e, 0x00, 0x06,
- 0x01, 0xa0, 0x01, 0x00, 0x02, 0x00, 0x03, 0x02,
- 0x0a, 0x5b, 0x02, 0xc2, 0x03, 0x02, 0x00, 0x60,
- 0xea, 0x01, 0x03, 0x01, 0xe0, 0xc2, 0x03, 0x00,
- 0x09, 0xc4, 0x03, 0x01, 0x01, 0xc1, 0x09, 0xe3,
+ 0x01, 0xc2, 0x03, 0x00, 0x00, 0x0e, 0x00, 0x06,
+ 0x01, 0xa0, 0x01, 0x00, 0x02, 0x00, 0x03, 0x03,
+ 0x0e, 0x7f, 0x02, 0xc2, 0x03, 0x02, 0x00, 0x60,
+ 0xea, 0x01, 0x03, 0x01, 0xe0, 0xc4, 0x03, 0x00,
+ 0x0d, 0xc2, 0x03, 0x01, 0x09, 0xc6, 0x03, 0x02,
+ 0x01, 0xc1, 0x0d, 0xe4, 0xbf, 0x00, 0x01, 0xe2,
  0x61, 0x00, 0x00, 0x06, 0x61, 0x01, 0x00, 0xc0,
  0x00, 0x56, 0xe1, 0x00, 0x00, 0x00, 0x00, 0xc1,
- 0x01, 0x54, 0xe3, 0x00, 0x00, 0x00, 0x01, 0xc1,
- 0x02, 0x54, 0xe4, 0x00, 0x00, 0x00, 0x00, 0xc1,
- 0x03, 0x54, 0xe5, 0x00, 0x00, 0x00, 0x00, 0xc1,
- 0x04, 0x54, 0xe6, 0x00, 0x00, 0x00, 0x00, 0xc1,
- 0x05, 0x54, 0xe7, 0x00, 0x00, 0x00, 0x00, 0xc1,
- 0x06, 0x54, 0xe8, 0x00, 0x00, 0x00, 0x00, 0xc1,
- 0x07, 0x54, 0xe9, 0x00, 0x00, 0x00, 0x00, 0xc1,
- 0x08, 0x54, 0xea, 0x00, 0x00, 0x00, 0x00, 0x06,
- 0xcb, 0x0e, 0xce, 0x68, 0x01, 0x00, 0xe2, 0x29,
- 0xc0, 0x03, 0x01, 0x1e, 0x01, 0x14, 0x00, 0x0f,
- 0x12, 0x00, 0x08, 0x08, 0x00, 0x08, 0x16, 0x00,
- 0x08, 0x42, 0x00, 0x08, 0x08, 0x00, 0x08, 0x08,
- 0x00, 0x08, 0x14, 0x00, 0x08, 0x12, 0x2b, 0x00,
- 0x08, 0x0e, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00,
- 0x01, 0x00, 0x04, 0x02, 0x00, 0x35, 0x01, 0x10,
- 0x00, 0x01, 0x00, 0xea, 0x01, 0x01, 0x0d, 0xc4,
- 0x03, 0x01, 0x00, 0x08, 0xca, 0x2b, 0x65, 0x00,
- 0x00, 0x11, 0xeb, 0x06, 0xc6, 0x1b, 0x24, 0x00,
- 0x00, 0x0e, 0xc6, 0xdf, 0xef, 0x43, 0xeb, 0x00,
- 0x00, 0x00, 0xc6, 0x26, 0x00, 0x00, 0x43, 0xec,
- 0x00, 0x00, 0x00, 0xc6, 0x38, 0x94, 0x00, 0x00,
- 0x00, 0x42, 0xed, 0x00, 0x00, 0x00, 0x07, 0x24,
- 0x01, 0x00, 0x43, 0xee, 0x00, 0x00, 0x00, 0x29,
- 0xc0, 0x03, 0x04, 0x04, 0x4e, 0x2b, 0x30, 0x67,
- 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x01, 0x00,
- 0x01, 0x00, 0x00, 0x09, 0x01, 0x10, 0x00, 0x01,
- 0x00, 0x08, 0xca, 0xc6, 0x41, 0xeb, 0x00, 0x00,
- 0x00, 0x28, 0xc0, 0x03, 0x0a, 0x01, 0x0d, 0x0e,
- 0x42, 0x07, 0x01, 0x00, 0x00, 0x01, 0x00, 0x02,
- 0x01, 0x00, 0x0c, 0x01, 0x10, 0x00, 0x01, 0x00,
- 0xc4, 0x03, 0x01, 0x00, 0x08, 0xca, 0xde, 0xef,
- 0xc6, 0x41, 0xeb, 0x00, 0x00, 0x00, 0x9f, 0x28,
- 0xc0, 0x03, 0x0e, 0x01, 0x0d, 0x0e, 0x42, 0x07,
- 0x01, 0x00, 0x01, 0x02, 0x01, 0x03, 0x00, 0x00,
- 0x4a, 0x03, 0x6c, 0x00, 0x01, 0x00, 0xca, 0x03,
- 0x01, 0x00, 0x60, 0x10, 0x00, 0x01, 0x00, 0x08,
- 0xcb, 0x61, 0x00, 0x00, 0x0b, 0xd2, 0x4c, 0x36,
- 0x00, 0x00, 0x00, 0x04, 0xe5, 0x00, 0x00, 0x00,
- 0x4c, 0xef, 0x00, 0x00, 0x00, 0xc7, 0x42, 0xe4,
- 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x4c, 0xf0,
- 0x00, 0x00, 0x00, 0xb6, 0x4c, 0xf1, 0x00, 0x00,
- 0x00, 0xca, 0xc7, 0x41, 0xec, 0x00, 0x00, 0x00,
- 0x42, 0xf2, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00,
- 0x24, 0x01, 0x00, 0x0e, 0xc7, 0x41, 0xee, 0x00,
- 0x00, 0x00, 0xd2, 0x71, 0x62, 0x00, 0x00, 0x49,
- 0x29, 0xc0, 0x03, 0x12, 0x09, 0x1c, 0x08, 0x21,
- 0x35, 0x49, 0x21, 0x08, 0x5d, 0x3f, 0x0e, 0x42,
- 0x07, 0x01, 0x00, 0x03, 0x04, 0x03, 0x04, 0x00,
- 0x00, 0xf7, 0x01, 0x07, 0x6c, 0x00, 0x01, 0x00,
- 0xe6, 0x03, 0x00, 0x01, 0x00, 0xe8, 0x03, 0x00,
- 0x01, 0x00, 0xe0, 0x03, 0x01, 0x00, 0x40, 0xea,
- 0x03, 0x01, 0x01, 0x40, 0xca, 0x03, 0x01, 0x02,
- 0x60, 0x10, 0x00, 0x01, 0x00, 0x08, 0xcd, 0x61,
- 0x02, 0x00, 0x61, 0x01, 0x00, 0x61, 0x00, 0x00,
- 0x06, 0xca, 0x06, 0xcb, 0xd4, 0x38, 0x45, 0x00,
- 0x00, 0x00, 0xad, 0xeb, 0x28, 0xc9, 0x41, 0xee,
- 0x00, 0x00, 0x00, 0xd4, 0x47, 0x38, 0x45, 0x00,
- 0x00, 0x00, 0xac, 0xeb, 0x18, 0x38, 0xcd, 0x00,
- 0x00, 0x00, 0x11, 0x04, 0xf6, 0x00, 0x00, 0x00,
- 0xd4, 0x9e, 0x04, 0xf7, 0x00, 0x00, 0x00, 0x9e,
- 0x21, 0x01, 0x00, 0x2f, 0xd3, 0x38, 0x45, 0x00,
- 0x00, 0x00, 0xad, 0xeb, 0x28, 0xc9, 0x41, 0xee,
- 0x00, 0x00, 0x00, 0xd3, 0x47, 0x38, 0x45, 0x00,
- 0x00, 0x00, 0xac, 0xeb, 0x18, 0x38, 0xcd, 0x00,
- 0x00, 0x00, 0x11, 0x04, 0xf6, 0x00, 0x00, 0x00,
- 0xd3, 0x9e, 0x04, 0xf7, 0x00, 0x00, 0x00, 0x9e,
- 0x21, 0x01, 0x00, 0x2f, 0xc9, 0x41, 0xee, 0x00,
- 0x00, 0x00, 0xd3, 0x47, 0xeb, 0x15, 0xc9, 0x41,
- 0xee, 0x00, 0x00, 0x00, 0xd3, 0x47, 0x41, 0xf0,
- 0x00, 0x00, 0x00, 0x11, 0x63, 0x00, 0x00, 0x0e,
- 0xed, 0x07, 0xb6, 0x11, 0x63, 0x00, 0x00, 0x0e,
- 0xc9, 0x41, 0xee, 0x00, 0x00, 0x00, 0xd4, 0x47,
- 0xeb, 0x15, 0xc9, 0x41, 0xee, 0x00, 0x00, 0x00,
- 0xd4, 0x47, 0x41, 0xf0, 0x00, 0x00, 0x00, 0x11,
- 0x63, 0x01, 0x00, 0x0e, 0xed, 0x0f, 0xc9, 0x42,
- 0xe4, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x11,
- 0x63, 0x01, 0x00, 0x0e, 0x0b, 0xd2, 0x4c, 0x36,
- 0x00, 0x00, 0x00, 0x04, 0xe6, 0x00, 0x00, 0x00,
- 0x4c, 0xef, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00,
- 0x4c, 0xf0, 0x00, 0x00, 0x00, 0x62, 0x01, 0x00,
- 0x62, 0x00, 0x00, 0x9f, 0x4c, 0xf1, 0x00, 0x00,
- 0x00, 0xcc, 0xc9, 0x41, 0xec, 0x00, 0x00, 0x00,
- 0x42, 0xf2, 0x00, 0x00, 0x00, 0x62, 0x02, 0x00,
- 0x24, 0x01, 0x00, 0x29, 0xc0, 0x03, 0x1d, 0x18,
- 0x3a, 0x0d, 0x0e, 0x80, 0x71, 0x09, 0x80, 0x71,
- 0x09, 0x35, 0x5d, 0x0d, 0x23, 0x35, 0x5d, 0x0d,
- 0x4b, 0x08, 0x21, 0x35, 0x2b, 0x3f, 0x08, 0x58,
- 0x0e, 0x42, 0x07, 0x01, 0x00, 0x01, 0x01, 0x01,
- 0x03, 0x00, 0x01, 0x12, 0x02, 0xf0, 0x03, 0x00,
- 0x01, 0x80, 0x10, 0x00, 0x01, 0x00, 0x08, 0xca,
- 0xc6, 0x41, 0xec, 0x00, 0x00, 0x00, 0x42, 0xf9,
- 0x00, 0x00, 0x00, 0xc1, 0x00, 0x25, 0x01, 0x00,
- 0xc0, 0x03, 0x3e, 0x01, 0x0d, 0x0e, 0x42, 0x07,
- 0x01, 0x00, 0x01, 0x00, 0x01, 0x02, 0x01, 0x00,
- 0x09, 0x01, 0xf4, 0x03, 0x00, 0x01, 0x00, 0xf0,
- 0x03, 0x00, 0x03, 0xd2, 0x41, 0xef, 0x00, 0x00,
- 0x00, 0xde, 0xac, 0x28, 0xc0, 0x03, 0x3f, 0x00,
- 0x0e, 0x42, 0x07, 0x01, 0x00, 0x01, 0x01, 0x01,
- 0x03, 0x00, 0x01, 0x12, 0x02, 0x6c, 0x00, 0x01,
- 0x80, 0x10, 0x00, 0x01, 0x00, 0x08, 0xca, 0xc6,
- 0x41, 0xec, 0x00, 0x00, 0x00, 0x42, 0xf9, 0x00,
+ 0x01, 0x54, 0xe4, 0x00, 0x00, 0x00, 0x01, 0xc1,
+ 0x02, 0x54, 0xe5, 0x00, 0x00, 0x00, 0x00, 0xc1,
+ 0x03, 0x54, 0xe6, 0x00, 0x00, 0x00, 0x00, 0xc1,
+ 0x04, 0x54, 0xe7, 0x00, 0x00, 0x00, 0x00, 0xc1,
+ 0x05, 0x54, 0xe8, 0x00, 0x00, 0x00, 0x00, 0xc1,
+ 0x06, 0x54, 0xe9, 0x00, 0x00, 0x00, 0x00, 0xc1,
+ 0x07, 0x54, 0xea, 0x00, 0x00, 0x00, 0x00, 0xc1,
+ 0x08, 0x54, 0xeb, 0x00, 0x00, 0x00, 0x00, 0xc1,
+ 0x09, 0x54, 0xec, 0x00, 0x00, 0x00, 0x00, 0xc1,
+ 0x0a, 0x54, 0xed, 0x00, 0x00, 0x00, 0x00, 0xc1,
+ 0x0b, 0x54, 0xee, 0x00, 0x00, 0x00, 0x00, 0xc1,
+ 0x0c, 0x54, 0xef, 0x00, 0x00, 0x00, 0x00, 0x06,
+ 0xcb, 0x0e, 0xce, 0x68, 0x01, 0x00, 0xe3, 0x29,
+ 0xc0, 0x03, 0x01, 0x2d, 0x01, 0x00, 0x03, 0x0a,
+ 0x18, 0x00, 0x0f, 0x14, 0x00, 0x08, 0x26, 0x00,
+ 0x08, 0x08, 0x00, 0x08, 0x08, 0x00, 0x08, 0x16,
+ 0x00, 0x08, 0x42, 0x00, 0x08, 0x0a, 0x00, 0x08,
+ 0x0a, 0x00, 0x08, 0x0c, 0x00, 0x08, 0x28, 0x00,
+ 0x08, 0x14, 0x00, 0x08, 0x12, 0x2b, 0x00, 0x08,
+ 0x0e, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00, 0x01,
+ 0x00, 0x04, 0x02, 0x00, 0x3c, 0x01, 0x10, 0x00,
+ 0x01, 0x00, 0xea, 0x01, 0x01, 0x0d, 0xc6, 0x03,
+ 0x02, 0x00, 0x08, 0xca, 0x2b, 0x65, 0x00, 0x00,
+ 0x11, 0xeb, 0x06, 0xc6, 0x1b, 0x24, 0x00, 0x00,
+ 0x0e, 0xc6, 0xdf, 0xef, 0x43, 0xf0, 0x00, 0x00,
+ 0x00, 0xc6, 0x26, 0x00, 0x00, 0x43, 0xf1, 0x00,
+ 0x00, 0x00, 0xc6, 0x38, 0x94, 0x00, 0x00, 0x00,
+ 0x42, 0xf2, 0x00, 0x00, 0x00, 0x07, 0x24, 0x01,
+ 0x00, 0x43, 0xf3, 0x00, 0x00, 0x00, 0xc6, 0xb6,
+ 0x43, 0xf4, 0x00, 0x00, 0x00, 0x29, 0xc0, 0x03,
+ 0x08, 0x05, 0x4e, 0x2b, 0x30, 0x67, 0x26, 0x0e,
+ 0x42, 0x07, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01,
+ 0x00, 0x00, 0x09, 0x01, 0x10, 0x00, 0x01, 0x00,
+ 0x08, 0xca, 0xc6, 0x41, 0xf0, 0x00, 0x00, 0x00,
+ 0x28, 0xc0, 0x03, 0x0f, 0x01, 0x0d, 0x0e, 0x42,
+ 0x07, 0x01, 0x00, 0x02, 0x05, 0x02, 0x04, 0x00,
+ 0x00, 0xed, 0x01, 0x07, 0xea, 0x03, 0x00, 0x01,
+ 0x00, 0xec, 0x03, 0x00, 0x01, 0x00, 0xee, 0x03,
+ 0x01, 0x00, 0x40, 0xf0, 0x03, 0x01, 0x01, 0x40,
+ 0xf2, 0x03, 0x01, 0x02, 0x40, 0xf4, 0x03, 0x01,
+ 0x03, 0x40, 0xf6, 0x03, 0x01, 0x04, 0x60, 0x61,
+ 0x04, 0x00, 0x61, 0x03, 0x00, 0x61, 0x02, 0x00,
+ 0x61, 0x01, 0x00, 0x61, 0x00, 0x00, 0x06, 0x11,
+ 0xf3, 0xec, 0x1d, 0x6f, 0x42, 0xf7, 0x00, 0x00,
+ 0x00, 0xca, 0x42, 0xf8, 0x00, 0x00, 0x00, 0xcb,
+ 0x42, 0xf9, 0x00, 0x00, 0x00, 0xcc, 0x42, 0xfa,
+ 0x00, 0x00, 0x00, 0xcd, 0x0e, 0xed, 0x17, 0x0e,
+ 0xd3, 0xeb, 0x04, 0xd2, 0xed, 0xde, 0x38, 0xfc,
+ 0x00, 0x00, 0x00, 0x42, 0xfd, 0x00, 0x00, 0x00,
+ 0x24, 0x00, 0x00, 0xed, 0xcf, 0xd3, 0x11, 0xec,
+ 0x03, 0x0e, 0xd2, 0xc4, 0x04, 0x62, 0x04, 0x00,
+ 0xeb, 0x45, 0x62, 0x00, 0x00, 0x62, 0x04, 0x00,
+ 0x41, 0xf7, 0x00, 0x00, 0x00, 0x9f, 0x11, 0x63,
+ 0x00, 0x00, 0x0e, 0x62, 0x01, 0x00, 0x62, 0x04,
+ 0x00, 0x41, 0xf8, 0x00, 0x00, 0x00, 0x9f, 0x11,
+ 0x63, 0x01, 0x00, 0x0e, 0x62, 0x02, 0x00, 0x62,
+ 0x04, 0x00, 0x41, 0xf9, 0x00, 0x00, 0x00, 0x9f,
+ 0x11, 0x63, 0x02, 0x00, 0x0e, 0x62, 0x03, 0x00,
+ 0x62, 0x04, 0x00, 0x41, 0xfa, 0x00, 0x00, 0x00,
+ 0x9f, 0x11, 0x63, 0x03, 0x00, 0x0e, 0x0b, 0x62,
+ 0x00, 0x00, 0x4c, 0xf7, 0x00, 0x00, 0x00, 0x62,
+ 0x01, 0x00, 0x4c, 0xf8, 0x00, 0x00, 0x00, 0x62,
+ 0x00, 0x00, 0x62, 0x01, 0x00, 0x9e, 0xb6, 0xa6,
+ 0xeb, 0x0e, 0x62, 0x01, 0x00, 0x62, 0x00, 0x00,
+ 0x62, 0x01, 0x00, 0x9e, 0x9c, 0xed, 0x02, 0xb6,
+ 0x4c, 0xfe, 0x00, 0x00, 0x00, 0x62, 0x02, 0x00,
+ 0x4c, 0xf9, 0x00, 0x00, 0x00, 0x62, 0x03, 0x00,
+ 0x4c, 0xfa, 0x00, 0x00, 0x00, 0x62, 0x02, 0x00,
+ 0xb6, 0xa6, 0xeb, 0x0a, 0x62, 0x03, 0x00, 0x62,
+ 0x02, 0x00, 0x9c, 0xed, 0x02, 0xb6, 0x4c, 0xff,
+ 0x00, 0x00, 0x00, 0x28, 0xc0, 0x03, 0x13, 0x11,
+ 0x4e, 0x00, 0x37, 0x02, 0x2b, 0x1c, 0x58, 0x58,
+ 0x58, 0x59, 0x08, 0x2b, 0x2b, 0x99, 0x2b, 0x2b,
+ 0x71, 0x0e, 0x40, 0x07, 0x01, 0x00, 0x01, 0x00,
+ 0x00, 0x03, 0x00, 0x00, 0x1a, 0x01, 0x80, 0x04,
+ 0x00, 0x01, 0x00, 0xd2, 0xf3, 0xeb, 0x03, 0x09,
+ 0xd6, 0x38, 0xfc, 0x00, 0x00, 0x00, 0x42, 0xfd,
+ 0x00, 0x00, 0x00, 0xd2, 0x24, 0x01, 0x00, 0x41,
+ 0x01, 0x01, 0x00, 0x00, 0x28, 0xc0, 0x03, 0x26,
+ 0x01, 0x21, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x00,
+ 0x01, 0x00, 0x02, 0x01, 0x00, 0x0c, 0x01, 0x10,
+ 0x00, 0x01, 0x00, 0xc6, 0x03, 0x02, 0x00, 0x08,
+ 0xca, 0xde, 0xef, 0xc6, 0x41, 0xf0, 0x00, 0x00,
+ 0x00, 0x9f, 0x28, 0xc0, 0x03, 0x2a, 0x01, 0x0d,
+ 0x0e, 0x42, 0x07, 0x01, 0x00, 0x01, 0x02, 0x01,
+ 0x03, 0x00, 0x00, 0x4a, 0x03, 0x6c, 0x00, 0x01,
+ 0x00, 0xd0, 0x03, 0x01, 0x00, 0x60, 0x10, 0x00,
+ 0x01, 0x00, 0x08, 0xcb, 0x61, 0x00, 0x00, 0x0b,
+ 0xd2, 0x4c, 0x36, 0x00, 0x00, 0x00, 0x04, 0xe8,
+ 0x00, 0x00, 0x00, 0x4c, 0x02, 0x01, 0x00, 0x00,
+ 0xc7, 0x42, 0xe7, 0x00, 0x00, 0x00, 0x24, 0x00,
+ 0x00, 0x4c, 0x03, 0x01, 0x00, 0x00, 0xb6, 0x4c,
+ 0x04, 0x01, 0x00, 0x00, 0xca, 0xc7, 0x41, 0xf1,
+ 0x00, 0x00, 0x00, 0x42, 0x05, 0x01, 0x00, 0x00,
+ 0x62, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xc7,
+ 0x41, 0xf3, 0x00, 0x00, 0x00, 0xd2, 0x71, 0x62,
+ 0x00, 0x00, 0x49, 0x29, 0xc0, 0x03, 0x2e, 0x09,
+ 0x1c, 0x08, 0x21, 0x35, 0x49, 0x21, 0x08, 0x5d,
+ 0x3f, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x03, 0x04,
+ 0x03, 0x04, 0x00, 0x00, 0xf7, 0x01, 0x07, 0x6c,
+ 0x00, 0x01, 0x00, 0x8c, 0x04, 0x00, 0x01, 0x00,
+ 0x8e, 0x04, 0x00, 0x01, 0x00, 0x86, 0x04, 0x01,
+ 0x00, 0x40, 0x90, 0x04, 0x01, 0x01, 0x40, 0xd0,
+ 0x03, 0x01, 0x02, 0x60, 0x10, 0x00, 0x01, 0x00,
+ 0x08, 0xcd, 0x61, 0x02, 0x00, 0x61, 0x01, 0x00,
+ 0x61, 0x00, 0x00, 0x06, 0xca, 0x06, 0xcb, 0xd4,
+ 0x38, 0x45, 0x00, 0x00, 0x00, 0xad, 0xeb, 0x28,
+ 0xc9, 0x41, 0xf3, 0x00, 0x00, 0x00, 0xd4, 0x47,
+ 0x38, 0x45, 0x00, 0x00, 0x00, 0xac, 0xeb, 0x18,
+ 0x38, 0xcd, 0x00, 0x00, 0x00, 0x11, 0x04, 0x09,
+ 0x01, 0x00, 0x00, 0xd4, 0x9e, 0x04, 0x0a, 0x01,
+ 0x00, 0x00, 0x9e, 0x21, 0x01, 0x00, 0x2f, 0xd3,
+ 0x38, 0x45, 0x00, 0x00, 0x00, 0xad, 0xeb, 0x28,
+ 0xc9, 0x41, 0xf3, 0x00, 0x00, 0x00, 0xd3, 0x47,
+ 0x38, 0x45, 0x00, 0x00, 0x00, 0xac, 0xeb, 0x18,
+ 0x38, 0xcd, 0x00, 0x00, 0x00, 0x11, 0x04, 0x09,
+ 0x01, 0x00, 0x00, 0xd3, 0x9e, 0x04, 0x0a, 0x01,
+ 0x00, 0x00, 0x9e, 0x21, 0x01, 0x00, 0x2f, 0xc9,
+ 0x41, 0xf3, 0x00, 0x00, 0x00, 0xd3, 0x47, 0xeb,
+ 0x15, 0xc9, 0x41, 0xf3, 0x00, 0x00, 0x00, 0xd3,
+ 0x47, 0x41, 0x03, 0x01, 0x00, 0x00, 0x11, 0x63,
+ 0x00, 0x00, 0x0e, 0xed, 0x07, 0xb6, 0x11, 0x63,
+ 0x00, 0x00, 0x0e, 0xc9, 0x41, 0xf3, 0x00, 0x00,
+ 0x00, 0xd4, 0x47, 0xeb, 0x15, 0xc9, 0x41, 0xf3,
+ 0x00, 0x00, 0x00, 0xd4, 0x47, 0x41, 0x03, 0x01,
+ 0x00, 0x00, 0x11, 0x63, 0x01, 0x00, 0x0e, 0xed,
+ 0x0f, 0xc9, 0x42, 0xe7, 0x00, 0x00, 0x00, 0x24,
+ 0x00, 0x00, 0x11, 0x63, 0x01, 0x00, 0x0e, 0x0b,
+ 0xd2, 0x4c, 0x36, 0x00, 0x00, 0x00, 0x04, 0xe9,
+ 0x00, 0x00, 0x00, 0x4c, 0x02, 0x01, 0x00, 0x00,
+ 0x62, 0x00, 0x00, 0x4c, 0x03, 0x01, 0x00, 0x00,
+ 0x62, 0x01, 0x00, 0x62, 0x00, 0x00, 0x9f, 0x4c,
+ 0x04, 0x01, 0x00, 0x00, 0xcc, 0xc9, 0x41, 0xf1,
+ 0x00, 0x00, 0x00, 0x42, 0x05, 0x01, 0x00, 0x00,
+ 0x62, 0x02, 0x00, 0x24, 0x01, 0x00, 0x29, 0xc0,
+ 0x03, 0x39, 0x18, 0x3a, 0x0d, 0x0e, 0x80, 0x71,
+ 0x09, 0x80, 0x71, 0x09, 0x35, 0x5d, 0x0d, 0x23,
+ 0x35, 0x5d, 0x0d, 0x4b, 0x08, 0x21, 0x35, 0x2b,
+ 0x3f, 0x08, 0x58, 0x0e, 0x42, 0x07, 0x01, 0x00,
+ 0x01, 0x01, 0x01, 0x03, 0x00, 0x01, 0x1c, 0x02,
+ 0x96, 0x04, 0x00, 0x01, 0x80, 0x10, 0x00, 0x01,
+ 0x00, 0x08, 0xca, 0xc6, 0x42, 0xed, 0x00, 0x00,
+ 0x00, 0x24, 0x00, 0x00, 0x0e, 0xc6, 0x41, 0xf1,
+ 0x00, 0x00, 0x00, 0x42, 0x0c, 0x01, 0x00, 0x00,
+ 0xc1, 0x00, 0x25, 0x01, 0x00, 0xc0, 0x03, 0x5a,
+ 0x02, 0x0d, 0x35, 0x0e, 0x42, 0x07, 0x01, 0x00,
+ 0x01, 0x00, 0x01, 0x02, 0x01, 0x00, 0x09, 0x01,
+ 0x9a, 0x04, 0x00, 0x01, 0x00, 0x96, 0x04, 0x00,
+ 0x03, 0xd2, 0x41, 0x02, 0x01, 0x00, 0x00, 0xde,
+ 0xac, 0x28, 0xc0, 0x03, 0x5c, 0x00, 0x0e, 0x42,
+ 0x07, 0x01, 0x00, 0x01, 0x01, 0x01, 0x03, 0x00,
+ 0x01, 0x1c, 0x02, 0x6c, 0x00, 0x01, 0x80, 0x10,
+ 0x00, 0x01, 0x00, 0x08, 0xca, 0xc6, 0x42, 0xed,
+ 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x0e, 0xc6,
+ 0x41, 0xf1, 0x00, 0x00, 0x00, 0x42, 0x0c, 0x01,
  0x00, 0x00, 0xc1, 0x00, 0x25, 0x01, 0x00, 0xc0,
- 0x03, 0x42, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x01,
- 0x00, 0x01, 0x00, 0x01, 0x02, 0x01, 0x00, 0x09,
- 0x01, 0xf4, 0x03, 0x00, 0x01, 0x00, 0x6c, 0x00,
- 0x03, 0xd2, 0x41, 0x36, 0x00, 0x00, 0x00, 0xde,
- 0xac, 0x28, 0xc0, 0x03, 0x43, 0x00, 0x0e, 0x42,
+ 0x03, 0x5f, 0x02, 0x0d, 0x35, 0x0e, 0x42, 0x07,
+ 0x01, 0x00, 0x01, 0x00, 0x01, 0x02, 0x01, 0x00,
+ 0x09, 0x01, 0x9a, 0x04, 0x00, 0x01, 0x00, 0x6c,
+ 0x00, 0x03, 0xd2, 0x41, 0x36, 0x00, 0x00, 0x00,
+ 0xde, 0xac, 0x28, 0xc0, 0x03, 0x61, 0x00, 0x0e,
+ 0x42, 0x07, 0x01, 0x00, 0x00, 0x01, 0x00, 0x04,
+ 0x00, 0x01, 0x2a, 0x01, 0x10, 0x00, 0x01, 0x00,
+ 0x08, 0xca, 0xc6, 0x42, 0xed, 0x00, 0x00, 0x00,
+ 0x24, 0x00, 0x00, 0x0e, 0xc6, 0xc6, 0x41, 0xf1,
+ 0x00, 0x00, 0x00, 0x42, 0x0c, 0x01, 0x00, 0x00,
+ 0xc1, 0x00, 0x24, 0x01, 0x00, 0x43, 0xf1, 0x00,
+ 0x00, 0x00, 0xc6, 0xb6, 0x43, 0xf4, 0x00, 0x00,
+ 0x00, 0x29, 0xc0, 0x03, 0x64, 0x04, 0x0d, 0x35,
+ 0x71, 0x26, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x01,
+ 0x00, 0x01, 0x02, 0x00, 0x00, 0x0d, 0x01, 0x9a,
+ 0x04, 0x00, 0x01, 0x00, 0xd2, 0x41, 0x02, 0x01,
+ 0x00, 0x00, 0x04, 0x0e, 0x01, 0x00, 0x00, 0xad,
+ 0x28, 0xc0, 0x03, 0x66, 0x00, 0x0e, 0x42, 0x07,
+ 0x01, 0x00, 0x00, 0x06, 0x00, 0x08, 0x01, 0x01,
+ 0xd9, 0x01, 0x06, 0x86, 0x04, 0x02, 0x05, 0x60,
+ 0x88, 0x04, 0x02, 0x01, 0x60, 0x9e, 0x04, 0x02,
+ 0x02, 0x60, 0xa0, 0x04, 0x02, 0x03, 0x60, 0xa2,
+ 0x04, 0x01, 0x00, 0xc0, 0x10, 0x00, 0x01, 0x00,
+ 0xc4, 0x03, 0x00, 0x0c, 0x08, 0xc4, 0x05, 0x61,
+ 0x04, 0x00, 0x61, 0x03, 0x00, 0x61, 0x02, 0x00,
+ 0x61, 0x01, 0x00, 0x61, 0x00, 0x00, 0x38, 0xfc,
+ 0x00, 0x00, 0x00, 0x42, 0x12, 0x01, 0x00, 0x00,
+ 0x24, 0x00, 0x00, 0x7d, 0xed, 0x7b, 0x6f, 0x42,
+ 0x03, 0x01, 0x00, 0x00, 0xca, 0x42, 0x04, 0x01,
+ 0x00, 0x00, 0xcb, 0x42, 0x0f, 0x01, 0x00, 0x00,
+ 0xcc, 0x42, 0x10, 0x01, 0x00, 0x00, 0xcd, 0x0e,
+ 0xc3, 0x05, 0x41, 0xf1, 0x00, 0x00, 0x00, 0x42,
+ 0x05, 0x01, 0x00, 0x00, 0x0b, 0x04, 0x0e, 0x01,
+ 0x00, 0x00, 0x4c, 0x36, 0x00, 0x00, 0x00, 0x04,
+ 0x0e, 0x01, 0x00, 0x00, 0x4c, 0x02, 0x01, 0x00,
+ 0x00, 0x62, 0x00, 0x00, 0xc3, 0x05, 0x41, 0xf0,
+ 0x00, 0x00, 0x00, 0x9f, 0x4c, 0x03, 0x01, 0x00,
+ 0x00, 0x62, 0x01, 0x00, 0x4c, 0x04, 0x01, 0x00,
+ 0x00, 0x0b, 0x62, 0x02, 0x00, 0x4c, 0x0f, 0x01,
+ 0x00, 0x00, 0x62, 0x03, 0x00, 0x4c, 0x10, 0x01,
+ 0x00, 0x00, 0x4c, 0x13, 0x01, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0x0e, 0xc3, 0x05, 0x42, 0xf4, 0x00,
+ 0x00, 0x00, 0x90, 0x43, 0xf4, 0x00, 0x00, 0x00,
+ 0x80, 0x00, 0xeb, 0x83, 0x0e, 0x83, 0xc3, 0x05,
+ 0x41, 0xf4, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00,
+ 0x9f, 0xc4, 0x04, 0x62, 0x04, 0x00, 0xb6, 0xa6,
+ 0xeb, 0x23, 0xc3, 0x05, 0xc3, 0x05, 0x41, 0xf1,
+ 0x00, 0x00, 0x00, 0x42, 0x0c, 0x01, 0x00, 0x00,
+ 0xc1, 0x00, 0x24, 0x01, 0x00, 0x43, 0xf1, 0x00,
+ 0x00, 0x00, 0xc3, 0x05, 0x65, 0x00, 0x00, 0x43,
+ 0xf4, 0x00, 0x00, 0x00, 0x29, 0xc0, 0x03, 0x6c,
+ 0x11, 0x21, 0x00, 0x36, 0x02, 0x44, 0x35, 0x35,
+ 0x53, 0x2b, 0x71, 0x17, 0x44, 0x21, 0x44, 0x26,
+ 0x7b, 0x36, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x01,
+ 0x00, 0x01, 0x02, 0x01, 0x00, 0x1a, 0x01, 0x9a,
+ 0x04, 0x00, 0x01, 0x00, 0xa2, 0x04, 0x04, 0x09,
+ 0xd2, 0x41, 0x02, 0x01, 0x00, 0x00, 0x04, 0x0e,
+ 0x01, 0x00, 0x00, 0xad, 0x11, 0xec, 0x0b, 0x0e,
+ 0x65, 0x00, 0x00, 0x91, 0x66, 0x00, 0x00, 0xb6,
+ 0xa5, 0x28, 0xc0, 0x03, 0x79, 0x00, 0x0e, 0x42,
  0x07, 0x01, 0x00, 0x01, 0x02, 0x01, 0x05, 0x00,
- 0x02, 0x5c, 0x03, 0x6c, 0x00, 0x01, 0x80, 0xf4,
- 0x03, 0x04, 0x00, 0x60, 0x10, 0x00, 0x01, 0x00,
+ 0x02, 0x5c, 0x03, 0x6c, 0x00, 0x01, 0x80, 0x9a,
+ 0x04, 0x04, 0x00, 0x60, 0x10, 0x00, 0x01, 0x00,
  0x08, 0xcb, 0xd2, 0xf5, 0xeb, 0x18, 0xc7, 0xc7,
- 0x41, 0xec, 0x00, 0x00, 0x00, 0x42, 0xf9, 0x00,
+ 0x41, 0xf1, 0x00, 0x00, 0x00, 0x42, 0x0c, 0x01,
  0x00, 0x00, 0xc1, 0x00, 0x24, 0x01, 0x00, 0x43,
- 0xec, 0x00, 0x00, 0x00, 0x29, 0x61, 0x00, 0x00,
- 0xc7, 0x41, 0xec, 0x00, 0x00, 0x00, 0x42, 0xfb,
- 0x00, 0x00, 0x00, 0xc1, 0x01, 0x24, 0x01, 0x00,
- 0xca, 0xc7, 0x41, 0xec, 0x00, 0x00, 0x00, 0x42,
- 0xfc, 0x00, 0x00, 0x00, 0xc7, 0x41, 0xec, 0x00,
- 0x00, 0x00, 0x42, 0xfd, 0x00, 0x00, 0x00, 0x62,
+ 0xf1, 0x00, 0x00, 0x00, 0x29, 0x61, 0x00, 0x00,
+ 0xc7, 0x41, 0xf1, 0x00, 0x00, 0x00, 0x42, 0x14,
+ 0x01, 0x00, 0x00, 0xc1, 0x01, 0x24, 0x01, 0x00,
+ 0xca, 0xc7, 0x41, 0xf1, 0x00, 0x00, 0x00, 0x42,
+ 0x15, 0x01, 0x00, 0x00, 0xc7, 0x41, 0xf1, 0x00,
+ 0x00, 0x00, 0x42, 0x16, 0x01, 0x00, 0x00, 0x62,
  0x00, 0x00, 0x24, 0x01, 0x00, 0xb7, 0x24, 0x02,
- 0x00, 0x0e, 0xc7, 0x41, 0xee, 0x00, 0x00, 0x00,
- 0xd2, 0x99, 0x0e, 0x29, 0xc0, 0x03, 0x46, 0x07,
+ 0x00, 0x0e, 0xc7, 0x41, 0xf3, 0x00, 0x00, 0x00,
+ 0xd2, 0x99, 0x0e, 0x29, 0xc0, 0x03, 0x7e, 0x07,
  0x0d, 0x17, 0x71, 0x17, 0x58, 0xa8, 0x31, 0x0e,
  0x42, 0x07, 0x01, 0x00, 0x01, 0x00, 0x01, 0x02,
- 0x00, 0x00, 0x0d, 0x01, 0xf4, 0x03, 0x00, 0x01,
- 0x00, 0xd2, 0x41, 0xef, 0x00, 0x00, 0x00, 0x04,
- 0xe5, 0x00, 0x00, 0x00, 0xad, 0x28, 0xc0, 0x03,
- 0x48, 0x00, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x01,
- 0x00, 0x01, 0x02, 0x01, 0x00, 0x19, 0x01, 0xfc,
- 0x03, 0x00, 0x01, 0x00, 0x6c, 0x00, 0x03, 0xd2,
- 0x41, 0xef, 0x00, 0x00, 0x00, 0x04, 0xe5, 0x00,
+ 0x00, 0x00, 0x0d, 0x01, 0x9a, 0x04, 0x00, 0x01,
+ 0x00, 0xd2, 0x41, 0x02, 0x01, 0x00, 0x00, 0x04,
+ 0xe8, 0x00, 0x00, 0x00, 0xad, 0x28, 0xc0, 0x03,
+ 0x80, 0x01, 0x00, 0x0e, 0x42, 0x07, 0x01, 0x00,
+ 0x01, 0x00, 0x01, 0x02, 0x01, 0x00, 0x19, 0x01,
+ 0xae, 0x04, 0x00, 0x01, 0x00, 0x6c, 0x00, 0x03,
+ 0xd2, 0x41, 0x02, 0x01, 0x00, 0x00, 0x04, 0xe8,
+ 0x00, 0x00, 0x00, 0xac, 0x11, 0xeb, 0x0a, 0x0e,
+ 0xd2, 0x41, 0x36, 0x00, 0x00, 0x00, 0xde, 0xac,
+ 0x28, 0xc0, 0x03, 0x82, 0x01, 0x00, 0x0e, 0x42,
+ 0x07, 0x01, 0x00, 0x01, 0x02, 0x01, 0x05, 0x00,
+ 0x02, 0x53, 0x03, 0x6c, 0x00, 0x01, 0x80, 0x9a,
+ 0x04, 0x04, 0x00, 0x60, 0x10, 0x00, 0x01, 0x00,
+ 0x08, 0xcb, 0xd2, 0xf5, 0xeb, 0x18, 0xc7, 0xc7,
+ 0x41, 0xf1, 0x00, 0x00, 0x00, 0x42, 0x0c, 0x01,
+ 0x00, 0x00, 0xc1, 0x00, 0x24, 0x01, 0x00, 0x43,
+ 0xf1, 0x00, 0x00, 0x00, 0x29, 0x61, 0x00, 0x00,
+ 0xc7, 0x41, 0xf1, 0x00, 0x00, 0x00, 0x42, 0x14,
+ 0x01, 0x00, 0x00, 0xc1, 0x01, 0x24, 0x01, 0x00,
+ 0xca, 0xc7, 0x41, 0xf1, 0x00, 0x00, 0x00, 0x42,
+ 0x15, 0x01, 0x00, 0x00, 0xc7, 0x41, 0xf1, 0x00,
+ 0x00, 0x00, 0x42, 0x16, 0x01, 0x00, 0x00, 0x62,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0xb7, 0x24, 0x02,
+ 0x00, 0x0e, 0x29, 0xc0, 0x03, 0x88, 0x01, 0x06,
+ 0x0d, 0x17, 0x71, 0x17, 0x58, 0xa9, 0x0e, 0x42,
+ 0x07, 0x01, 0x00, 0x01, 0x00, 0x01, 0x02, 0x00,
+ 0x00, 0x0d, 0x01, 0x9a, 0x04, 0x00, 0x01, 0x00,
+ 0xd2, 0x41, 0x02, 0x01, 0x00, 0x00, 0x04, 0xe9,
+ 0x00, 0x00, 0x00, 0xad, 0x28, 0xc0, 0x03, 0x8a,
+ 0x01, 0x00, 0x0e, 0x42, 0x07, 0x01, 0x00, 0x01,
+ 0x00, 0x01, 0x02, 0x01, 0x00, 0x19, 0x01, 0xae,
+ 0x04, 0x00, 0x01, 0x00, 0x6c, 0x00, 0x03, 0xd2,
+ 0x41, 0x02, 0x01, 0x00, 0x00, 0x04, 0xe9, 0x00,
  0x00, 0x00, 0xac, 0x11, 0xeb, 0x0a, 0x0e, 0xd2,
  0x41, 0x36, 0x00, 0x00, 0x00, 0xde, 0xac, 0x28,
- 0xc0, 0x03, 0x4a, 0x00, 0x0e, 0x42, 0x07, 0x01,
- 0x00, 0x01, 0x02, 0x01, 0x05, 0x00, 0x02, 0x53,
- 0x03, 0x6c, 0x00, 0x01, 0x80, 0xf4, 0x03, 0x04,
- 0x00, 0x60, 0x10, 0x00, 0x01, 0x00, 0x08, 0xcb,
- 0xd2, 0xf5, 0xeb, 0x18, 0xc7, 0xc7, 0x41, 0xec,
- 0x00, 0x00, 0x00, 0x42, 0xf9, 0x00, 0x00, 0x00,
- 0xc1, 0x00, 0x24, 0x01, 0x00, 0x43, 0xec, 0x00,
- 0x00, 0x00, 0x29, 0x61, 0x00, 0x00, 0xc7, 0x41,
- 0xec, 0x00, 0x00, 0x00, 0x42, 0xfb, 0x00, 0x00,
- 0x00, 0xc1, 0x01, 0x24, 0x01, 0x00, 0xca, 0xc7,
- 0x41, 0xec, 0x00, 0x00, 0x00, 0x42, 0xfc, 0x00,
- 0x00, 0x00, 0xc7, 0x41, 0xec, 0x00, 0x00, 0x00,
- 0x42, 0xfd, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00,
- 0x24, 0x01, 0x00, 0xb7, 0x24, 0x02, 0x00, 0x0e,
- 0x29, 0xc0, 0x03, 0x50, 0x06, 0x0d, 0x17, 0x71,
- 0x17, 0x58, 0xa9, 0x0e, 0x42, 0x07, 0x01, 0x00,
- 0x01, 0x00, 0x01, 0x02, 0x00, 0x00, 0x0d, 0x01,
- 0xf4, 0x03, 0x00, 0x01, 0x00, 0xd2, 0x41, 0xef,
- 0x00, 0x00, 0x00, 0x04, 0xe6, 0x00, 0x00, 0x00,
- 0xad, 0x28, 0xc0, 0x03, 0x52, 0x00, 0x0e, 0x42,
- 0x07, 0x01, 0x00, 0x01, 0x00, 0x01, 0x02, 0x01,
- 0x00, 0x19, 0x01, 0xfc, 0x03, 0x00, 0x01, 0x00,
- 0x6c, 0x00, 0x03, 0xd2, 0x41, 0xef, 0x00, 0x00,
- 0x00, 0x04, 0xe6, 0x00, 0x00, 0x00, 0xac, 0x11,
- 0xeb, 0x0a, 0x0e, 0xd2, 0x41, 0x36, 0x00, 0x00,
- 0x00, 0xde, 0xac, 0x28, 0xc0, 0x03, 0x54, 0x00,
- 0x0e, 0x43, 0x06, 0x01, 0xc4, 0x03, 0x00, 0x00,
- 0x00, 0x04, 0x00, 0x01, 0x1e, 0x00, 0x38, 0x97,
- 0x00, 0x00, 0x00, 0x38, 0xb4, 0x00, 0x00, 0x00,
- 0x38, 0xff, 0x00, 0x00, 0x00, 0x42, 0x00, 0x01,
- 0x00, 0x00, 0x24, 0x00, 0x00, 0xf0, 0xc0, 0x00,
- 0x9c, 0x23, 0x01, 0x00, 0xc0, 0x03, 0x5a, 0x01,
- 0x03, 0x0c, 0x28, 0x01, 0x01,
+ 0xc0, 0x03, 0x8c, 0x01, 0x00, 0x0e, 0x43, 0x06,
+ 0x01, 0xc6, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00,
+ 0x01, 0x1e, 0x00, 0x38, 0x97, 0x00, 0x00, 0x00,
+ 0x38, 0xb4, 0x00, 0x00, 0x00, 0x38, 0xfc, 0x00,
+ 0x00, 0x00, 0x42, 0x18, 0x01, 0x00, 0x00, 0x24,
+ 0x00, 0x00, 0xf0, 0xc0, 0x00, 0x9c, 0x23, 0x01,
+ 0x00, 0xc0, 0x03, 0x92, 0x01, 0x01, 0x03, 0x0c,
+ 0x28, 0x01, 0x01,
 };
 
 const uint32_t url_size = 12544;
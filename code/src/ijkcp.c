@@ -1,11 +1,243 @@
 #include "ijjs.h"
 #include "kcp/ikcp.h"
 
+/* the SSSE3 kernel is built for any x86 target and picked at run time, builds do not pass -mssse3 */
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define KCP_GF_SSSE3 1
+#include <tmmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define KCP_TARGET_SSSE3
+#else
+#define KCP_TARGET_SSSE3 __attribute__((target("ssse3")))
+#endif
+#endif
+
+#define KCP_SEND_POOL_MAX 64
+#define KCP_FEC_GROUPS 4
+#define KCP_FEC_HEADER 6
+#define KCP_FEC_OVERHEAD (KCP_FEC_HEADER + 2)
+#define KCP_FEC_DATA 0xf1
+/* the high byte of a parity flag is the data shard count of a group closed early, 0 for a full one */
+#define KCP_FEC_PARITY 0xf2
+
+typedef struct {
+    IJBool used;
+    IJBool done;
+    IJU32 base;
+    IJS32 count;
+    size_t* lens;
+    IJU8* shards;
+} IJJSKcpFecGroup;
+
+typedef struct {
+    IJS32 data_shards;
+    IJS32 parity_shards;
+    size_t cap;
+    IJU32 paws;
+    IJU8* matrix;
+    IJU8* scratch;
+    IJS32* rows;
+    struct {
+        IJU32 seqid;
+        IJS32 count;
+        size_t maxlen;
+        size_t* lens;
+        IJU8* shards;
+    } enc;
+    IJJSKcpFecGroup groups[KCP_FEC_GROUPS];
+    IJU64 recovered;
+} IJJSKcpFec;
+
+static uv_once_t gf__init_once = UV_ONCE_INIT;
+static IJU8 gf_exp[512];
+static IJU8 gf_log[256];
+static IJU8 gf_mul_lo[256][16];
+static IJU8 gf_mul_hi[256][16];
+static IJBool gf_ssse3;
+
+static IJU8 gfMul(IJU8 a, IJU8 b) {
+    if (a == 0 || b == 0)
+        return 0;
+    return gf_exp[gf_log[a] + gf_log[b]];
+}
+
+static IJU8 gfInv(IJU8 a) {
+    return gf_exp[255 - gf_log[a]];
+}
+
+static IJVoid gfInitOnce(IJVoid) {
+    IJS32 i, j, x = 1;
+    for (i = 0; i < 255; i++) {
+        gf_exp[i] = (IJU8)x;
+        gf_log[x] = (IJU8)i;
+        x <<= 1;
+        if (x & 0x100)
+            x ^= 0x11d;
+    }
+    for (i = 255; i < 512; i++)
+        gf_exp[i] = gf_exp[i - 255];
+    for (i = 0; i < 256; i++) {
+        for (j = 0; j < 16; j++) {
+            gf_mul_lo[i][j] = gfMul((IJU8)i, (IJU8)j);
+            gf_mul_hi[i][j] = gfMul((IJU8)i, (IJU8)(j << 4));
+        }
+    }
+#if defined(KCP_GF_SSSE3) && defined(_MSC_VER)
+    IJS32 info[4];
+    __cpuid(info, 1);
+    gf_ssse3 = (info[2] & (1 << 9)) != 0;
+#elif defined(KCP_GF_SSSE3)
+    __builtin_cpu_init();
+    gf_ssse3 = __builtin_cpu_supports("ssse3") != 0;
+#endif
+}
+
+#ifdef KCP_GF_SSSE3
+/* 16 lookups per pshufb, returns how many bytes it handled */
+KCP_TARGET_SSSE3 static size_t gfMulAddSsse3(IJU8 c, const IJU8* in, IJU8* out, size_t n) {
+    size_t i = 0;
+    __m128i lo = _mm_loadu_si128((const __m128i*)gf_mul_lo[c]);
+    __m128i hi = _mm_loadu_si128((const __m128i*)gf_mul_hi[c]);
+    __m128i mask = _mm_set1_epi8(0x0f);
+    for (; i + 16 <= n; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(in + i));
+        __m128i l = _mm_shuffle_epi8(lo, _mm_and_si128(x, mask));
+        __m128i h = _mm_shuffle_epi8(hi, _mm_and_si128(_mm_srli_epi64(x, 4), mask));
+        __m128i o = _mm_loadu_si128((const __m128i*)(out + i));
+        _mm_storeu_si128((__m128i*)(out + i), _mm_xor_si128(o, _mm_xor_si128(l, h)));
+    }
+    return i;
+}
+#endif
+
+/* out ^= c * in, using split nibble tables so SSSE3 can do 16 lookups per pshufb */
+static IJVoid gfMulAdd(IJU8 c, const IJU8* in, IJU8* out, size_t n) {
+    size_t i = 0;
+    if (c == 0)
+        return;
+#ifdef KCP_GF_SSSE3
+    if (gf_ssse3)
+        i = gfMulAddSsse3(c, in, out, n);
+#endif
+    for (; i < n; i++)
+        out[i] ^= gf_mul_lo[c][in[i] & 0x0f] ^ gf_mul_hi[c][in[i] >> 4];
+}
+
+static IJS32 gfInvertMatrix(IJU8* a, IJU8* inv, IJS32 n) {
+    IJS32 r, c, i;
+    memset(inv, 0, n * n);
+    for (i = 0; i < n; i++)
+        inv[i * n + i] = 1;
+    for (c = 0; c < n; c++) {
+        for (r = c; r < n && a[r * n + c] == 0; r++);
+        if (r == n)
+            return -1;
+        if (r != c) {
+            for (i = 0; i < n; i++) {
+                IJU8 t = a[r * n + i];
+                a[r * n + i] = a[c * n + i];
+                a[c * n + i] = t;
+                t = inv[r * n + i];
+                inv[r * n + i] = inv[c * n + i];
+                inv[c * n + i] = t;
+            }
+        }
+        IJU8 f = gfInv(a[c * n + c]);
+        for (i = 0; i < n; i++) {
+            a[c * n + i] = gfMul(f, a[c * n + i]);
+            inv[c * n + i] = gfMul(f, inv[c * n + i]);
+        }
+        for (r = 0; r < n; r++) {
+            if (r != c && a[r * n + c] != 0) {
+                f = a[r * n + c];
+                gfMulAdd(f, a + c * n, a + r * n, n);
+                gfMulAdd(f, inv + c * n, inv + r * n, n);
+            }
+        }
+    }
+    return 0;
+}
+
+static IJVoid ijKcpFecFree(IJJSKcpFec* fec) {
+    IJS32 i;
+    if (!fec)
+        return;
+    for (i = 0; i < KCP_FEC_GROUPS; i++) {
+        je_free(fec->groups[i].lens);
+        je_free(fec->groups[i].shards);
+    }
+    je_free(fec->enc.lens);
+    je_free(fec->enc.shards);
+    je_free(fec->matrix);
+    je_free(fec->scratch);
+    je_free(fec->rows);
+    je_free(fec);
+}
+
+static IJJSKcpFec* ijKcpFecNew(IJS32 data_shards, IJS32 parity_shards, size_t cap) {
+    IJS32 i, r, c, n = data_shards + parity_shards;
+    IJJSKcpFec* fec = je_calloc(1, sizeof(*fec));
+    if (!fec)
+        return NULL;
+    fec->data_shards = data_shards;
+    fec->parity_shards = parity_shards;
+    fec->cap = cap;
+    fec->paws = (0xffffffffu / n) * n;
+    fec->matrix = je_malloc(parity_shards * data_shards);
+    fec->scratch = je_malloc(2 * data_shards * data_shards);
+    fec->rows = je_malloc(data_shards * sizeof(*fec->rows));
+    fec->enc.lens = je_calloc(data_shards, sizeof(*fec->enc.lens));
+    fec->enc.shards = je_malloc(data_shards * cap);
+    IJBool ok = fec->matrix && fec->scratch && fec->rows && fec->enc.lens && fec->enc.shards;
+    for (i = 0; i < KCP_FEC_GROUPS && ok; i++) {
+        fec->groups[i].lens = je_calloc(n, sizeof(*fec->groups[i].lens));
+        fec->groups[i].shards = je_malloc(n * cap);
+        ok = fec->groups[i].lens && fec->groups[i].shards;
+    }
+    if (!ok) {
+        ijKcpFecFree(fec);
+        return NULL;
+    }
+    /* systematic code: the parity rows form a Cauchy matrix, so any data_shards rows are invertible */
+    for (r = 0; r < parity_shards; r++)
+        for (c = 0; c < data_shards; c++)
+            fec->matrix[r * data_shards + c] = gfInv((IJU8)((data_shards + r) ^ c));
+    return fec;
+}
+
+static IJVoid ijKcpFecPutHeader(IJAnsi* p, IJU32 seqid, IJU16 flag) {
+    IJU8* u = (IJU8*)p;
+    u[0] = (IJU8)seqid;
+    u[1] = (IJU8)(seqid >> 8);
+    u[2] = (IJU8)(seqid >> 16);
+    u[3] = (IJU8)(seqid >> 24);
+    u[4] = (IJU8)flag;
+    u[5] = (IJU8)(flag >> 8);
+}
+
+static IJU16 ijKcpFecGetU16(const IJU8* p) {
+    return (IJU16)(p[0] | (p[1] << 8));
+}
+
+static IJU32 ijKcpFecNext(IJJSKcpFec* fec, IJU32 seqid) {
+    return seqid + 1 >= fec->paws ? 0 : seqid + 1;
+}
+
+
 typedef struct {
     uv_udp_send_t req;
-    IJJSPromise result;
+    struct list_head link;
+    size_t cap;
     size_t size;
-} IJJSSendReq;
+    IJAnsi data[];
+} IJJSKcpSendReq;
+
+typedef struct {
+    struct list_head link;
+    IJJSPromise result;
+    IJU32 sn;
+} IJJSKcpWrite;
 
 typedef struct {
     JSContext* ctx;
@@ -13,94 +245,360 @@ typedef struct {
     IJS32 finalized;
     uv_udp_t udp;
     ikcpcb* kcp;
-    struct sockaddr sa;
+    struct sockaddr_storage sa;
+    IJBool has_sa;
+    struct sockaddr_storage from;
+    IJS32 from_flags;
     IJU32 conv;
     struct {
         size_t size;
         IJJSPromise result;
     } read;
-    IJJSSendReq* write;
+    struct list_head writes;
+    struct list_head batch;
+    struct list_head pool;
+    IJS32 npool;
+    IJJSKcpFec* fec;
     uv_idle_t idle;
     IJU64 nextupdate;
+    struct {
+        IJU64 bytes;
+        IJU64 packets;
+    } rx, tx;
 } IJJSKcp;
 
-static IJVoid uvKcpUpdateCb(uv_idle_t* handle) {
-    IJJSKcp* k = handle->data;
-    IJU64 now64 = uv_now(ijGetLoop(k->ctx));
-    if (now64 >= k->nextupdate)
-    {
-        ikcp_update(k->kcp, (IJU32)now64);
-        k->nextupdate = ikcp_check(k->kcp, (IJU32)now64);
+static IJJSKcpSendReq* ijKcpGetSendReq(IJJSKcp* k, size_t size) {
+    IJJSKcpSendReq* sr = NULL;
+    if (!list_empty(&k->pool)) {
+        sr = list_entry(k->pool.next, IJJSKcpSendReq, link);
+        list_del(&sr->link);
+        k->npool--;
+        if (sr->cap < size) {
+            je_free(sr);
+            sr = NULL;
+        }
+    }
+    if (!sr) {
+        size_t cap = max_int((IJS32)size, (IJS32)k->kcp->mtu + KCP_FEC_OVERHEAD);
+        sr = je_malloc(sizeof(*sr) + cap);
+        if (!sr)
+            return NULL;
+        sr->cap = cap;
+    }
+    sr->size = size;
+    return sr;
+}
+
+static IJVoid ijKcpPutSendReq(IJJSKcp* k, IJJSKcpSendReq* sr) {
+    if (k->npool >= KCP_SEND_POOL_MAX || k->closed) {
+        je_free(sr);
+        return;
+    }
+    list_add_tail(&sr->link, &k->pool);
+    k->npool++;
+}
+
+static IJVoid ijKcpFreePool(IJJSKcp* k) {
+    struct list_head *el, *el1;
+    list_for_each_safe(el, el1, &k->pool) {
+        IJJSKcpSendReq* sr = list_entry(el, IJJSKcpSendReq, link);
+        list_del(&sr->link);
+        je_free(sr);
     }
+    k->npool = 0;
 }
 
 static IJVoid uvKcpSendCb(uv_udp_send_t* req, IJS32 status) {
     IJJSKcp* k = req->handle->data;
     CHECK_NOT_NULL(k);
-    JSContext* ctx = k->ctx;
-    IJS32 is_reject = 0;
-    JSValue arg;
-    if (status < 0) {
-        arg = ijNewError(ctx, status);
-        is_reject = 1;
+    ijKcpPutSendReq(k, req->data);
+}
+
+/* the data shards the group does not have count as empty ones, so the parity rows stay the same */
+static IJVoid ijKcpFecParity(IJJSKcp* k) {
+    IJJSKcpFec* fec = k->fec;
+    IJS32 d = fec->data_shards;
+    IJS32 count = fec->enc.count;
+    IJS32 i, r;
+    IJU32 seqid = fec->enc.seqid - count + d;
+    size_t L = fec->enc.maxlen;
+    for (i = 0; i < count; i++)
+        memset(fec->enc.shards + i * fec->cap + fec->enc.lens[i], 0, L - fec->enc.lens[i]);
+    for (r = 0; r < fec->parity_shards; r++, seqid++) {
+        IJJSKcpSendReq* sr = ijKcpGetSendReq(k, L + KCP_FEC_HEADER);
+        if (!sr)
+            continue;
+        IJU8* out = (IJU8*)sr->data + KCP_FEC_HEADER;
+        ijKcpFecPutHeader(sr->data, seqid, KCP_FEC_PARITY | (count < d ? count << 8 : 0));
+        memset(out, 0, L);
+        for (i = 0; i < count; i++)
+            gfMulAdd(fec->matrix[r * d + i], fec->enc.shards + i * fec->cap, out, L);
+        list_add_tail(&sr->link, &k->batch);
     }
-    else {
-        arg = JS_UNDEFINED;
+    /* paws is a multiple of the group size, a group never wraps */
+    fec->enc.seqid = seqid >= fec->paws ? 0 : seqid;
+    fec->enc.count = 0;
+    fec->enc.maxlen = 0;
+}
+
+static IJVoid ijKcpFecEncode(IJJSKcp* k, const IJAnsi* shard, size_t len) {
+    IJJSKcpFec* fec = k->fec;
+    memcpy(fec->enc.shards + fec->enc.count * fec->cap, shard, len);
+    fec->enc.lens[fec->enc.count] = len;
+    fec->enc.maxlen = max_int((IJS32)fec->enc.maxlen, (IJS32)len);
+    fec->enc.seqid++;
+    if (++fec->enc.count == fec->data_shards)
+        ijKcpFecParity(k);
+}
+
+/* interactive traffic rarely fills a group, whatever an update produced gets its parity right away */
+static IJVoid ijKcpFecFlush(IJJSKcp* k) {
+    if (k->fec && k->fec->enc.count > 0)
+        ijKcpFecParity(k);
+}
+
+static IJVoid ijKcpFecRecover(IJJSKcp* k, IJJSKcpFecGroup* g) {
+    IJJSKcpFec* fec = k->fec;
+    IJS32 d = fec->data_shards;
+    IJS32 n = d + fec->parity_shards;
+    IJU8* a = fec->scratch;
+    IJU8* inv = fec->scratch + d * d;
+    IJS32 i, j;
+    size_t L = 0;
+    for (i = 0, j = 0; i < n && j < d; i++) {
+        if (g->lens[i]) {
+            fec->rows[j++] = i;
+            L = max_int((IJS32)L, (IJS32)g->lens[i]);
+        }
+    }
+    /* rows are in order, so the last one is a data shard only when no data shard is missing */
+    if (fec->rows[d - 1] < d)
+        return;
+    for (j = 0; j < d; j++) {
+        IJS32 row = fec->rows[j];
+        memset(g->shards + row * fec->cap + g->lens[row], 0, L - g->lens[row]);
+        if (row < d) {
+            memset(a + j * d, 0, d);
+            a[j * d + row] = 1;
+        }
+        else
+            memcpy(a + j * d, fec->matrix + (row - d) * d, d);
+    }
+    if (gfInvertMatrix(a, inv, d) != 0)
+        return;
+    for (i = 0; i < d; i++) {
+        if (g->lens[i])
+            continue;
+        IJU8* out = g->shards + i * fec->cap;
+        memset(out, 0, L);
+        for (j = 0; j < d; j++)
+            gfMulAdd(inv[i * d + j], g->shards + fec->rows[j] * fec->cap, out, L);
+        IJU16 sz = ijKcpFecGetU16(out);
+        if (sz >= 2 && sz <= L) {
+            ikcp_input(k->kcp, (const IJAnsi*)out + 2, sz - 2);
+            fec->recovered++;
+        }
     }
-    ijSettlePromise(ctx, &k->write->result, is_reject, 1, (JSValueConst*)&arg);
 }
+
+static IJVoid ijKcpInput(IJJSKcp* k, const IJAnsi* buf, size_t len) {
+    IJJSKcpFec* fec = k->fec;
+    if (!fec) {
+        ikcp_input(k->kcp, buf, (long)len);
+        return;
+    }
+    if (len < KCP_FEC_HEADER)
+        return;
+    const IJU8* p = (const IJU8*)buf;
+    IJU32 seqid = p[0] | (p[1] << 8) | (p[2] << 16) | ((IJU32)p[3] << 24);
+    IJU16 flag = ijKcpFecGetU16(p + 4);
+    IJS32 size = flag >> 8;
+    flag &= 0xff;
+    p += KCP_FEC_HEADER;
+    len -= KCP_FEC_HEADER;
+    if (flag == KCP_FEC_DATA) {
+        IJU16 sz = len >= 2 ? ijKcpFecGetU16(p) : 0;
+        if (sz < 2 || sz > len)
+            return;
+        ikcp_input(k->kcp, (const IJAnsi*)p + 2, sz - 2);
+        len = sz;
+    }
+    else if (flag != KCP_FEC_PARITY || size >= fec->data_shards)
+        return;
+    if (len > fec->cap)
+        return;
+    IJU32 n = fec->data_shards + fec->parity_shards;
+    IJU32 idx = seqid % n;
+    IJJSKcpFecGroup* g = &fec->groups[(seqid / n) % KCP_FEC_GROUPS];
+    if (!g->used || g->base != seqid - idx) {
+        g->used = true;
+        g->done = false;
+        g->base = seqid - idx;
+        g->count = 0;
+        memset(g->lens, 0, n * sizeof(*g->lens));
+    }
+    if (g->done || g->lens[idx])
+        return;
+    memcpy(g->shards + idx * fec->cap, p, len);
+    g->lens[idx] = len;
+    g->count++;
+    /* a group closed early, the data shards that were never sent are known to be empty */
+    for (IJS32 i = size; size > 0 && i < fec->data_shards; i++) {
+        if (!g->lens[i]) {
+            g->shards[i * fec->cap] = 0;
+            g->lens[i] = 1;
+            g->count++;
+        }
+    }
+    if (g->count < fec->data_shards)
+        return;
+    g->done = true;
+    ijKcpFecRecover(k, g);
+}
+
+/* mtu is the size of the datagrams on the wire, KCP gets whatever is left after the FEC header */
+static IJS32 ijKcpConfigure(IJJSKcp* k, IJS32 mtu, IJS32 data_shards, IJS32 parity_shards) {
+    IJJSKcpFec* fec = NULL;
+    IJS32 overhead = data_shards > 0 ? KCP_FEC_OVERHEAD : 0;
+    if (mtu - overhead < 50)
+        return UV_EINVAL;
+    if (data_shards > 0) {
+        uv_once(&gf__init_once, gfInitOnce);
+        fec = ijKcpFecNew(data_shards, parity_shards, mtu - KCP_FEC_HEADER);
+        if (!fec)
+            return UV_ENOMEM;
+    }
+    if (ikcp_setmtu(k->kcp, mtu - overhead) != 0) {
+        ijKcpFecFree(fec);
+        return UV_EINVAL;
+    }
+    ijKcpFecFree(k->fec);
+    k->fec = fec;
+    return 0;
+}
+
+static IJS32 ijKcpWireMtu(IJJSKcp* k) {
+    return k->kcp->mtu + (k->fec ? KCP_FEC_OVERHEAD : 0);
+}
+
 static int kcpOutput(const IJAnsi* buf, int size, struct IKCPCB* kcp, void* user){
-    IJS32 r;
     IJJSKcp* k = (IJJSKcp*)user;
-    uv_buf_t b;
-    b = uv_buf_init(buf, size);
-    r = uv_udp_try_send(&k->udp, &b, 1, &k->sa);
-    if (r == size) {
-        JSValue arg = JS_UNDEFINED;
-        ijSettlePromise(k->ctx, &k->write->result, 0, 1, (JSValueConst*)&arg);
-        return 0;
+    IJS32 overhead = k->fec ? KCP_FEC_OVERHEAD : 0;
+    IJJSKcpSendReq* sr = ijKcpGetSendReq(k, size + overhead);
+    if (!sr)
+        return -1;
+    memcpy(sr->data + overhead, buf, size);
+    list_add_tail(&sr->link, &k->batch);
+    if (k->fec) {
+        ijKcpFecPutHeader(sr->data, k->fec->enc.seqid, KCP_FEC_DATA);
+        sr->data[KCP_FEC_HEADER] = (IJAnsi)(size + 2);
+        sr->data[KCP_FEC_HEADER + 1] = (IJAnsi)((size + 2) >> 8);
+        ijKcpFecEncode(k, sr->data + KCP_FEC_HEADER, size + 2);
+    }
+    return 0;
+}
+
+static IJVoid ijKcpFlushBatch(IJJSKcp* k) {
+    struct list_head *el, *el1;
+    const struct sockaddr* sa = k->has_sa ? (struct sockaddr*)&k->sa : NULL;
+    list_for_each_safe(el, el1, &k->batch) {
+        IJJSKcpSendReq* sr = list_entry(el, IJJSKcpSendReq, link);
+        list_del(&sr->link);
+        k->tx.bytes += sr->size;
+        k->tx.packets++;
+        uv_buf_t b = uv_buf_init(sr->data, sr->size);
+        IJS32 r = uv_udp_try_send(&k->udp, &b, 1, sa);
+        if (r == (IJS32)sr->size) {
+            ijKcpPutSendReq(k, sr);
+            continue;
+        }
+        sr->req.data = sr;
+        r = uv_udp_send(&sr->req, &k->udp, &b, 1, sa, uvKcpSendCb);
+        if (r != 0)
+            ijKcpPutSendReq(k, sr);
     }
-    if (r >= 0) {
-        buf += r;
-        size -= r;
+}
+
+static IJVoid ijKcpSettleWrites(IJJSKcp* k, IJS32 err) {
+    JSContext* ctx = k->ctx;
+    struct list_head *el, *el1;
+    list_for_each_safe(el, el1, &k->writes) {
+        IJJSKcpWrite* w = list_entry(el, IJJSKcpWrite, link);
+        JSValue arg;
+        IJS32 is_reject = 0;
+        if (err < 0) {
+            arg = ijNewError(ctx, err);
+            is_reject = 1;
+        }
+        else if ((IJS32)(k->kcp->snd_nxt - w->sn) >= 0)
+            arg = JS_UNDEFINED;
+        else
+            break;
+        list_del(&w->link);
+        ijSettlePromise(ctx, &w->result, is_reject, 1, (JSValueConst*)&arg);
+        js_free(ctx, w);
     }
-    b = uv_buf_init(buf, size);
-    r = uv_udp_send(&(k->write->req), &k->udp, &b, 1, &k->sa, uvKcpSendCb);
-    return r;
 }
+
+static IJVoid uvKcpUpdateCb(uv_idle_t* handle) {
+    IJJSKcp* k = handle->data;
+    IJU64 now64 = uv_now(ijGetLoop(k->ctx));
+    if (now64 >= k->nextupdate)
+    {
+        ikcp_update(k->kcp, (IJU32)now64);
+        k->nextupdate = ikcp_check(k->kcp, (IJU32)now64);
+        ijKcpFecFlush(k);
+        ijKcpFlushBatch(k);
+        ijKcpSettleWrites(k, k->kcp->state == (IJU32)-1 ? UV_ETIMEDOUT : 0);
+    }
+}
+
+static IJVoid ijKcpMaybeDeliver(IJJSKcp* k) {
+    JSContext* ctx = k->ctx;
+    if (!ijIsPromisePending(ctx, &k->read.result))
+        return;
+    IJS32 len = ikcp_peeksize(k->kcp);
+    if (len <= 0)
+        return;
+    IJAnsi* data = js_malloc(ctx, len);
+    if (!data)
+        return;
+    uv_udp_recv_stop(&k->udp);
+    ikcp_recv(k->kcp, data, len);
+    JSValue arg = JS_NewObjectProto(ctx, JS_NULL);
+    JS_DefinePropertyValueStr(ctx, arg, "data", ijNewUint8Array(ctx, (IJU8*)data, len), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, arg, "flags", JS_NewInt32(ctx, k->from_flags), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, arg, "addr", ijAddr2Obj(ctx, (struct sockaddr*)&k->from), JS_PROP_C_W_E);
+    ijSettlePromise(ctx, &k->read.result, 0, 1, (JSValueConst*)&arg);
+    ijClearPromise(ctx, &k->read.result);
+}
+
 static IJVoid uvKcpRecvCb(uv_udp_t* handle, ssize_t nread, const uv_buf_t* buf, const struct sockaddr* addr, unsigned flags) {
     IJJSKcp* k = handle->data;
     CHECK_NOT_NULL(k);
+    JSContext* ctx = k->ctx;
     if (nread == 0 && addr == NULL) {
-        js_free(k->ctx, buf->base);
+        js_free(ctx, buf->base);
         return;
     }
-    JSContext* ctx = k->ctx;
-    JSValue arg;
-    IJS32 is_reject = 0;
     if (nread < 0) {
         uv_udp_recv_stop(handle);
-        arg = ijNewError(ctx, nread);
-        is_reject = 1;
         js_free(ctx, buf->base);
+        JSValue arg = ijNewError(ctx, nread);
+        ijSettlePromise(ctx, &k->read.result, 1, 1, (JSValueConst*)&arg);
+        ijClearPromise(ctx, &k->read.result);
+        return;
     }
-    else {
-        ikcp_input(k->kcp, buf->base, nread);
-        IJS32 len = ikcp_peeksize(k->kcp);
-        if (len > 0)
-        {
-            uv_udp_recv_stop(handle);
-            arg = JS_NewObjectProto(ctx, JS_NULL);
-            ikcp_recv(k->kcp, buf->base, len);
-            JS_DefinePropertyValueStr(ctx, arg, "data", ijNewUint8Array(ctx, (IJU8*)buf->base, len), JS_PROP_C_W_E);
-            JS_DefinePropertyValueStr(ctx, arg, "flags", JS_NewInt32(ctx, flags), JS_PROP_C_W_E);
-            JS_DefinePropertyValueStr(ctx, arg, "addr", ijAddr2Obj(ctx, addr), JS_PROP_C_W_E);
-        }
-        else
-            return;
-    }
-    ijSettlePromise(ctx, &k->read.result, is_reject, 1, (JSValueConst*)&arg);
-    ijClearPromise(ctx, &k->read.result);
+    IJU64 t0 = ijProfileBegin(ijGetRuntime(ctx));
+    k->rx.bytes += nread;
+    k->rx.packets++;
+    memcpy(&k->from, addr, addr->sa_family == AF_INET6 ? sizeof(struct sockaddr_in6) : sizeof(struct sockaddr_in));
+    k->from_flags = flags;
+    /* KCP copies the segments, so the datagram buffer can go right away */
+    ijKcpInput(k, buf->base, nread);
+    js_free(ctx, buf->base);
+    ijKcpMaybeDeliver(k);
+    ijProfileEnd(ijGetRuntime(ctx), IJJS_PHASE_IO, t0);
 }
 
 static IJVoid uvKcpAllocCb(uv_handle_t* handle, size_t suggested_size, uv_buf_t* buf) {
@@ -113,14 +611,23 @@ static IJVoid uvKcpAllocCb(uv_handle_t* handle, size_t suggested_size, uv_buf_t*
 static IJVoid uvKcpCloseCb(uv_handle_t* handle) {
     IJJSKcp* k = handle->data;
     CHECK_NOT_NULL(k);
-    ikcp_release(k->kcp);
-    k->closed = 1;
-    if (k->finalized)
+    /* both the UDP and the idle handle have to be closed */
+    if (++k->closed < 2)
+        return;
+    ijKcpFreePool(k);
+    ijKcpFecFree(k->fec);
+    k->fec = NULL;
+    if (k->finalized) {
+        ikcp_release(k->kcp);
         je_free(k);
+    }
 }
 static IJVoid uvKcpMaybeClose(IJJSKcp* k) {
-    if (!uv_is_closing((uv_handle_t*)&k->udp))
+    if (!uv_is_closing((uv_handle_t*)&k->udp)) {
+        uv_idle_stop(&k->idle);
+        uv_close((uv_handle_t*)&k->idle, uvKcpCloseCb);
         uv_close((uv_handle_t*)&k->udp, uvKcpCloseCb);
+    }
 }
 
 static JSClassID ijjs_kcp_class_id;
@@ -131,13 +638,19 @@ static IJJSKcp* ijKcpGet(JSContext* ctx, JSValueConst obj) {
 static IJVoid ijKcpFinalizer(JSRuntime* rt, JSValue val) {
     IJJSKcp* k = JS_GetOpaque(val, ijjs_kcp_class_id);
     if (k) {
-        uv_idle_stop(&k->idle);
-        uv_close((uv_handle_t*)&k->idle, NULL);
-        ikcp_release(k->kcp);
+        struct list_head *el, *el1;
+        list_for_each_safe(el, el1, &k->writes) {
+            IJJSKcpWrite* w = list_entry(el, IJJSKcpWrite, link);
+            list_del(&w->link);
+            ijFreePromiseRT(rt, &w->result);
+            js_free_rt(rt, w);
+        }
         ijFreePromiseRT(rt, &k->read.result);
         k->finalized = 1;
-        if (k->closed)
+        if (k->closed == 2) {
+            ikcp_release(k->kcp);
             je_free(k);
+        }
         else
             uvKcpMaybeClose(k);
     }
@@ -146,7 +659,12 @@ static IJVoid ijKcpFinalizer(JSRuntime* rt, JSValue val) {
 static IJVoid ijKcpMark(JSRuntime* rt, JSValueConst val, JS_MarkFunc* mark_func) {
     IJJSKcp* k = JS_GetOpaque(val, ijjs_kcp_class_id);
     if (k) {
+        struct list_head* el;
         ijMarkPromise(rt, &k->read.result, mark_func);
+        list_for_each(el, &k->writes) {
+            IJJSKcpWrite* w = list_entry(el, IJJSKcpWrite, link);
+            ijMarkPromise(rt, &w->result, mark_func);
+        }
     }
 }
 
@@ -164,23 +682,25 @@ static JSValue ijNewKcp(JSContext* ctx, IJS32 af, IJU32 conv) {
         JS_FreeValue(ctx, obj);
         return JS_EXCEPTION;
     }
-    uv_idle_init(ijGetLoop(ctx), &k->idle);
-    k->idle.data = k;
-    CHECK_EQ(uv_idle_start(&k->idle, uvKcpUpdateCb), 0);
     r = uv_udp_init_ex(ijGetLoop(ctx), &k->udp, af);
     if (r != 0) {
         JS_FreeValue(ctx, obj);
         je_free(k);
         return JS_ThrowInternalError(ctx, "couldn't initialize KCP handle");
     }
+    uv_idle_init(ijGetLoop(ctx), &k->idle);
+    k->idle.data = k;
+    CHECK_EQ(uv_idle_start(&k->idle, uvKcpUpdateCb), 0);
 	k->kcp = ikcp_create(conv, k);
-    k->write = NULL;
 	k->kcp->output = kcpOutput;
     k->conv = conv;
     k->ctx = ctx;
     k->closed = 0;
     k->finalized = 0;
     k->udp.data = k;
+    init_list_head(&k->writes);
+    init_list_head(&k->batch);
+    init_list_head(&k->pool);
     k->nextupdate = ikcp_check(k->kcp, uv_now(ijGetLoop(k->ctx)));
     uv_update_time(ijGetLoop(ctx));
     ijClearPromise(ctx, &k->read.result);
@@ -197,6 +717,7 @@ static JSValue ijKcpClose(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSV
         ijSettlePromise(ctx, &k->read.result, false, 1, (JSValueConst*)&arg);
         ijClearPromise(ctx, &k->read.result);
     }
+    ijKcpSettleWrites(k, UV_ECANCELED);
     uvKcpMaybeClose(k);
     return JS_UNDEFINED;
 }
@@ -287,7 +808,7 @@ static JSValue ijKcpSetMtu(JSContext* ctx, JSValueConst this_val, IJS32 argc, JS
     IJS32 mtu = 1400;
     if (!JS_IsUndefined(argv[0]) && JS_ToInt32(ctx, &mtu, argv[0]))
         return JS_EXCEPTION; 
-    ikcp_setmtu(k->kcp, mtu);
+    ijKcpConfigure(k, mtu, k->fec ? k->fec->data_shards : 0, k->fec ? k->fec->parity_shards : 0);
     return JS_UNDEFINED;
 }
 
@@ -325,6 +846,93 @@ static JSValue ijKcpSetNodelay(JSContext* ctx, JSValueConst this_val, IJS32 argc
     return JS_UNDEFINED;
 }
 
+static IJS32 ijKcpGetOption(JSContext* ctx, JSValueConst obj, const IJAnsi* name, IJS32* val) {
+    JSValue v = JS_GetPropertyStr(ctx, obj, name);
+    if (JS_IsException(v))
+        return -1;
+    if (JS_IsUndefined(v))
+        return 0;
+    IJS32 r = JS_ToInt32(ctx, val, v);
+    JS_FreeValue(ctx, v);
+    return r ? -1 : 1;
+}
+
+static JSValue ijKcpSetOptions(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSKcp* k = ijKcpGet(ctx, this_val);
+    if (!k)
+        return JS_EXCEPTION;
+    JSValueConst opts = argv[0];
+    if (!JS_IsObject(opts))
+        return JS_ThrowTypeError(ctx, "options must be an object");
+    IJS32 nodelay = -1, interval = -1, resend = -1, nc = -1;
+    IJS32 sndwnd = 0, rcvwnd = 0, mtu = 0, minrto = 0;
+    IJS32 data_shards = k->fec ? k->fec->data_shards : 0;
+    IJS32 parity_shards = k->fec ? k->fec->parity_shards : 0;
+    if (ijKcpGetOption(ctx, opts, "nodelay", &nodelay) < 0 ||
+        ijKcpGetOption(ctx, opts, "interval", &interval) < 0 ||
+        ijKcpGetOption(ctx, opts, "resend", &resend) < 0 ||
+        ijKcpGetOption(ctx, opts, "nc", &nc) < 0 ||
+        ijKcpGetOption(ctx, opts, "sndwnd", &sndwnd) < 0 ||
+        ijKcpGetOption(ctx, opts, "rcvwnd", &rcvwnd) < 0 ||
+        ijKcpGetOption(ctx, opts, "mtu", &mtu) < 0 ||
+        ijKcpGetOption(ctx, opts, "minrto", &minrto) < 0 ||
+        ijKcpGetOption(ctx, opts, "dataShards", &data_shards) < 0 ||
+        ijKcpGetOption(ctx, opts, "parityShards", &parity_shards) < 0)
+        return JS_EXCEPTION;
+    if (data_shards < 0 || parity_shards < 0 || data_shards + parity_shards > 255 ||
+        (data_shards > 0) != (parity_shards > 0))
+        return JS_ThrowRangeError(ctx, "invalid FEC shards %d/%d", data_shards, parity_shards);
+    IJBool fec_changed = data_shards != (k->fec ? k->fec->data_shards : 0) ||
+        parity_shards != (k->fec ? k->fec->parity_shards : 0);
+    if (mtu > 0 || fec_changed) {
+        if (mtu <= 0)
+            mtu = ijKcpWireMtu(k);
+        IJS32 r = ijKcpConfigure(k, mtu, data_shards, parity_shards);
+        if (r == UV_EINVAL)
+            return JS_ThrowRangeError(ctx, "invalid mtu %d", mtu);
+        if (r != 0)
+            return ijThrowErrno(ctx, r);
+    }
+    ikcp_nodelay(k->kcp, nodelay, interval, resend, nc);
+    ikcp_wndsize(k->kcp, sndwnd, rcvwnd);
+    /* ikcp_nodelay resets rx_minrto, so an explicit minrto goes last */
+    if (minrto > 0)
+        k->kcp->rx_minrto = minrto;
+    k->nextupdate = 0;
+    return JS_UNDEFINED;
+}
+
+static JSValue ijKcpStats(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSKcp* k = ijKcpGet(ctx, this_val);
+    if (!k)
+        return JS_EXCEPTION;
+    ikcpcb* kcp = k->kcp;
+    JSValue obj = JS_NewObjectProto(ctx, JS_NULL);
+    JS_DefinePropertyValueStr(ctx, obj, "rtt", JS_NewInt32(ctx, kcp->rx_srtt), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "rttvar", JS_NewInt32(ctx, kcp->rx_rttval), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "rto", JS_NewInt32(ctx, kcp->rx_rto), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "minrto", JS_NewInt32(ctx, kcp->rx_minrto), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "retransmits", JS_NewUint32(ctx, kcp->xmit), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "sndQueue", JS_NewUint32(ctx, kcp->nsnd_que), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "rcvQueue", JS_NewUint32(ctx, kcp->nrcv_que), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "rcvBuffer", JS_NewUint32(ctx, kcp->nrcv_buf), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "inflight", JS_NewUint32(ctx, kcp->nsnd_buf), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "waitsnd", JS_NewInt32(ctx, ikcp_waitsnd(kcp)), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "sndwnd", JS_NewUint32(ctx, kcp->snd_wnd), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "rcvwnd", JS_NewUint32(ctx, kcp->rcv_wnd), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "rmtwnd", JS_NewUint32(ctx, kcp->rmt_wnd), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "cwnd", JS_NewUint32(ctx, kcp->cwnd), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "mtu", JS_NewUint32(ctx, ijKcpWireMtu(k)), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "dataShards", JS_NewInt32(ctx, k->fec ? k->fec->data_shards : 0), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "parityShards", JS_NewInt32(ctx, k->fec ? k->fec->parity_shards : 0), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "fecRecovered", JS_NewInt64(ctx, k->fec ? k->fec->recovered : 0), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "rxBytes", JS_NewInt64(ctx, k->rx.bytes), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "rxPackets", JS_NewInt64(ctx, k->rx.packets), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "txBytes", JS_NewInt64(ctx, k->tx.bytes), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "txPackets", JS_NewInt64(ctx, k->tx.packets), JS_PROP_C_W_E);
+    return obj;
+}
+
 static JSValue ijKcpGetConv(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
     IJJSKcp* k = ijKcpGet(ctx, this_val);
     if (!k)
@@ -342,6 +950,11 @@ static JSValue ijKcpRecv(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSVa
     if (!JS_IsUndefined(argv[0]) && JS_ToIndex(ctx, &size, argv[0]))
         return JS_EXCEPTION;
     k->read.size = size;
+    if (ikcp_peeksize(k->kcp) > 0) {
+        JSValue promise = ijInitPromise(ctx, &k->read.result);
+        ijKcpMaybeDeliver(k);
+        return promise;
+    }
     IJS32 r = uv_udp_recv_start(&k->udp, uvKcpAllocCb, uvKcpRecvCb);
     if (r != 0)
         return ijThrowErrno(ctx, r);
@@ -379,21 +992,40 @@ static JSValue ijKcpSend(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSVa
     IJS32 r;
     if (!JS_IsUndefined(argv[1])) {
         r = ijObj2Addr(ctx, argv[1], &ss);
-        if (r != 0)
+        if (r != 0) {
+            if (is_string)
+                JS_FreeCString(ctx, buf);
             return JS_EXCEPTION;
+        }
         sa = (struct sockaddr*)&ss;
     }
-    if (k->write)
-        js_free(ctx, k->write);
-    k->write = js_malloc(ctx, sizeof(*k->write));
-    if (!k->write)
+    if (uv_is_closing((uv_handle_t*)&k->udp)) {
+        if (is_string)
+            JS_FreeCString(ctx, buf);
+        return ijThrowErrno(ctx, UV_EBADF);
+    }
+    IJJSKcpWrite* w = js_malloc(ctx, sizeof(*w));
+    if (!w) {
+        if (is_string)
+            JS_FreeCString(ctx, buf);
         return JS_EXCEPTION;
-    memcpy(&k->sa, sa, sizeof(k->sa));
-    k->write->req.data = k;
+    }
+    r = ikcp_send(k->kcp, buf, size);
     if (is_string)
         JS_FreeCString(ctx, buf);
-    ikcp_send(k->kcp, buf, size);
-    return ijInitPromise(ctx, &k->write->result);
+    if (r < 0) {
+        js_free(ctx, w);
+        return JS_ThrowRangeError(ctx, "message too large");
+    }
+    if (sa) {
+        memcpy(&k->sa, sa, sizeof(k->sa));
+        k->has_sa = true;
+    }
+    /* the write settles once its last segment has been handed to the socket */
+    w->sn = k->kcp->snd_nxt + k->kcp->nsnd_que;
+    list_add_tail(&w->link, &k->writes);
+    k->nextupdate = 0;
+    return ijInitPromise(ctx, &w->result);
 }
 
 
@@ -404,6 +1036,8 @@ static const JSCFunctionListEntry ijjs_kcp_proto_funcs[] = {
     JS_CFUNC_DEF("nodelay", 4, ijKcpSetNodelay),
     JS_CFUNC_DEF("setwndsize", 2, ijKcpSetWndSize),
     JS_CFUNC_DEF("setmtu", 1, ijKcpSetMtu),
+    JS_CFUNC_DEF("setOptions", 1, ijKcpSetOptions),
+    JS_CFUNC_DEF("stats", 0, ijKcpStats),
     JS_CFUNC_DEF("close", 0, ijKcpClose),
     JS_CFUNC_DEF("fileno", 0, ijKcpFileno),
     JS_CFUNC_MAGIC_DEF("getsockname", 0, ijKcpGetSockPeerName, 0),
@@ -21,8 +21,32 @@
 #include "ijjs.h"
 
 static zlog_category_t* zc = NULL;
+static uv_once_t log__init_once = UV_ONCE_INIT;
 static JSClassID ijjs_log_class_id;
 
+/* zlog reads its configuration and creates the log directory, so it is only
+   set up the first time something is logged instead of on every startup */
+static IJVoid ijLogInitOnce(IJVoid) {
+    IJAnsi buf[256] = {0};
+    strcpy(buf, ijGetScriptPath());
+    for (IJS32 _i = 255; _i >= 0; --_i)
+    {
+        if (buf[_i] == '/' || buf[_i] == '\\')
+            break;
+        else
+            buf[_i] = 0;
+    }
+    strcat(buf, "log");
+#if defined(_WIN32) || defined(_WIN64) || defined(WIN32) || defined(WIN64)
+    CreateDirectoryA(buf, NULL);
+#else
+    mkdir(buf, 0755);
+#endif
+    IJS32 rc = zlog_init(NULL, buf);
+    assert(rc == 0);
+    zc = zlog_get_category("ijjs_rule");
+}
+
 static IJVoid ijLogFinalizer(JSRuntime* rt, JSValue val) {
 }
 
@@ -35,7 +59,7 @@ static JSValue ijLogFatal(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSV
         IJAnsi* buf = (IJAnsi*)JS_ToCStringLen(ctx, &size, jsData);
         if (!buf)
             return JS_EXCEPTION;
-        zlog_fatal(zc, buf);
+        zlog_fatal(ijGetLogCategory(), buf);
         return JS_NULL;
     }
     return JS_EXCEPTION;   
@@ -47,7 +71,7 @@ static JSValue ijLogWarn(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSVa
         IJAnsi* buf = (IJAnsi*)JS_ToCStringLen(ctx, &size, jsData);
         if (!buf)
             return JS_EXCEPTION;
-        zlog_warn(zc, buf);
+        zlog_warn(ijGetLogCategory(), buf);
         return JS_NULL;
     }
     return JS_EXCEPTION; 
@@ -59,7 +83,7 @@ static JSValue ijLogInfo(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSVa
         IJAnsi* buf = (IJAnsi*)JS_ToCStringLen(ctx, &size, jsData);
         if (!buf)
             return JS_EXCEPTION;
-        zlog_info(zc, buf);
+        zlog_info(ijGetLogCategory(), buf);
         return JS_NULL;
     }
     return JS_EXCEPTION;
@@ -71,7 +95,7 @@ static JSValue ijLogDebug(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSV
         IJAnsi* buf = (IJAnsi*)JS_ToCStringLen(ctx, &size, jsData);
         if (!buf)
             return JS_EXCEPTION;
-        zlog_debug(zc, buf);
+        zlog_debug(ijGetLogCategory(), buf);
         return JS_NULL;
     }
     return JS_EXCEPTION;
@@ -88,33 +112,17 @@ static const JSCFunctionListEntry ijjs_log_proto_funcs[] = {
     JS_CFUNC_DEF("finalize", 0, ijLogFinalize)
 };
 
+zlog_category_t* ijGetLogCategory(IJVoid) {
+    uv_once(&log__init_once, ijLogInitOnce);
+    return zc;
+}
+
 IJVoid ijModLogInit(JSContext* ctx, JSModuleDef* m) {
     JSValue obj;
     JS_NewClassID(&ijjs_log_class_id);
     JS_NewClass(JS_GetRuntime(ctx), ijjs_log_class_id, &ijjs_log_class);
     obj = JS_NewObject(ctx);
     JS_SetPropertyFunctionList(ctx, obj, ijjs_log_proto_funcs, countof(ijjs_log_proto_funcs));
-    if (!zc)
-    {
-        IJAnsi buf[256] = {0};
-        strcpy(buf, ijGetScriptPath());
-        for (IJS32 _i = 255; _i >= 0; --_i)
-        {
-            if (buf[_i] == '/' || buf[_i] == '\\')
-                break;
-            else
-                buf[_i] = 0;
-        }
-        strcat(buf, "log");
-#if defined(_WIN32) || defined(_WIN64) || defined(WIN32) || defined(WIN64)
-        CreateDirectoryA(buf, NULL);
-#else
-        mkdir(buf, 0755);
-#endif
-        IJS32 rc = zlog_init(NULL, buf);
-        assert(rc == 0);
-        zc = zlog_get_category("ijjs_rule");
-    }
     JS_SetModuleExport(ctx, m, "log", obj);
 }
 
@@ -0,0 +1,128 @@
+/*
+ ijjs javascript runtime engine
+ Copyright (C) 2010-2017 Trix
+
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include "ijjs.h"
+
+static const IJAnsi* ijjs_phase_names[IJJS_PHASE_COUNT] = { "timers", "immediates", "io", "fs", "curl", "microtasks", "gc" };
+
+IJU64 ijProfileBegin(IJJSRuntime* qrt) {
+    return qrt->profiler.enabled ? uv_hrtime() : 0;
+}
+
+IJVoid ijProfileEnd(IJJSRuntime* qrt, IJS32 phase, IJU64 start) {
+    if (start && qrt->profiler.enabled)
+        ijHistogramRecord(&qrt->profiler.phases[phase], uv_hrtime() - start);
+}
+
+static IJVoid ijLoopProfReset(IJJSRuntime* qrt) {
+    for (IJS32 i = 0; i < IJJS_PHASE_COUNT; i++)
+        ijHistogramReset(&qrt->profiler.phases[i]);
+    qrt->profiler.since = uv_hrtime();
+}
+
+static IJVoid uvLoopProfDumpCb(uv_timer_t* handle) {
+    IJJSRuntime* qrt = handle->data;
+    CHECK_NOT_NULL(qrt);
+    IJAnsi line[1024];
+    IJS32 len = snprintf(line, sizeof(line), "loop profile %.0fms:", (uv_hrtime() - qrt->profiler.since) / 1e6);
+    for (IJS32 i = 0; i < IJJS_PHASE_COUNT && len < (IJS32)sizeof(line); i++) {
+        IJJSHistogram* h = &qrt->profiler.phases[i];
+        if (!h->count)
+            continue;
+        len += snprintf(line + len, sizeof(line) - len, " %s n=%llu total=%.3fms p50=%.1fus p99=%.1fus max=%.1fus;",
+            ijjs_phase_names[i], (unsigned long long)h->count, h->sum / 1e6,
+            ijHistogramPercentile(h, 50) / 1e3, ijHistogramPercentile(h, 99) / 1e3, h->max / 1e3);
+    }
+    zlog_category_t* zc = ijGetLogCategory();
+    if (zc)
+        zlog_info(zc, "%s", line);
+    /* every dump covers the window since the previous one */
+    ijLoopProfReset(qrt);
+}
+
+static JSValue ijLoopProfStart(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    IJS64 interval = 0;
+    if (!JS_IsUndefined(argv[0]) && JS_ToInt64(ctx, &interval, argv[0]))
+        return JS_EXCEPTION;
+    if (interval < 0)
+        return JS_ThrowRangeError(ctx, "invalid dump interval");
+    if (!qrt->profiler.enabled) {
+        ijLoopProfReset(qrt);
+        qrt->profiler.enabled = true;
+    }
+    uv_timer_stop(&qrt->profiler.dump);
+    if (interval > 0)
+        CHECK_EQ(uv_timer_start(&qrt->profiler.dump, uvLoopProfDumpCb, interval, interval), 0);
+    return JS_UNDEFINED;
+}
+
+static JSValue ijLoopProfStop(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    qrt->profiler.enabled = false;
+    uv_timer_stop(&qrt->profiler.dump);
+    return JS_UNDEFINED;
+}
+
+static JSValue ijLoopProfSnapshot(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    JSValue obj = JS_NewObjectProto(ctx, JS_NULL);
+    IJU64 elapsed = qrt->profiler.since ? uv_hrtime() - qrt->profiler.since : 0;
+    /* times are in milliseconds */
+    JS_DefinePropertyValueStr(ctx, obj, "enabled", JS_NewBool(ctx, qrt->profiler.enabled), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "elapsed", JS_NewFloat64(ctx, elapsed / 1e6), JS_PROP_C_W_E);
+    for (IJS32 i = 0; i < IJJS_PHASE_COUNT; i++) {
+        IJJSHistogram* h = &qrt->profiler.phases[i];
+        JSValue phase = JS_NewObjectProto(ctx, JS_NULL);
+        JS_DefinePropertyValueStr(ctx, phase, "count", JS_NewInt64(ctx, h->count), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, phase, "total", JS_NewFloat64(ctx, h->sum / 1e6), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, phase, "min", JS_NewFloat64(ctx, h->min / 1e6), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, phase, "max", JS_NewFloat64(ctx, h->max / 1e6), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, phase, "p50", JS_NewFloat64(ctx, ijHistogramPercentile(h, 50) / 1e6), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, phase, "p90", JS_NewFloat64(ctx, ijHistogramPercentile(h, 90) / 1e6), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, phase, "p99", JS_NewFloat64(ctx, ijHistogramPercentile(h, 99) / 1e6), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, obj, ijjs_phase_names[i], phase, JS_PROP_C_W_E);
+    }
+    if (JS_ToBool(ctx, argv[0]))
+        ijLoopProfReset(qrt);
+    return obj;
+}
+
+static const JSCFunctionListEntry ijjs_loopprof_funcs[] = {
+    JS_CFUNC_DEF("start", 1, ijLoopProfStart),
+    JS_CFUNC_DEF("stop", 0, ijLoopProfStop),
+    JS_CFUNC_DEF("snapshot", 1, ijLoopProfSnapshot),
+};
+
+IJVoid ijModLoopProfInit(JSContext* ctx, JSModuleDef* m) {
+    JSValue obj;
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    CHECK_EQ(uv_timer_init(&qrt->loop, &qrt->profiler.dump), 0);
+    qrt->profiler.dump.data = qrt;
+    uv_unref((uv_handle_t*)&qrt->profiler.dump);
+    obj = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, obj, ijjs_loopprof_funcs, countof(ijjs_loopprof_funcs));
+    JS_SetModuleExport(ctx, m, "loopProfiler", obj);
+}
+
+IJVoid ijModLoopProfExport(JSContext* ctx, JSModuleDef* m) {
+    JS_AddModuleExport(ctx, m, "loopProfiler");
+}
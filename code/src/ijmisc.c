@@ -35,6 +35,81 @@ static JSValue ijGetTimeOfDay(JSContext* ctx, JSValueConst this_val, IJS32 argc,
     return JS_NewInt64(ctx, tv.tv_sec * 1000 + (tv.tv_usec / 1000));
 }
 
+static JSValue ijLoopMetrics(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    IJJSHistogram* lag = &qrt->metrics.lag;
+    IJU64 idle = uv_metrics_idle_time(&qrt->loop);
+    IJU64 elapsed = qrt->metrics.start ? uv_hrtime() - qrt->metrics.start : 0;
+    JSValue obj = JS_NewObjectProto(ctx, JS_NULL);
+    /* times are in milliseconds, like performance.now() */
+    JS_DefinePropertyValueStr(ctx, obj, "idle", JS_NewFloat64(ctx, idle / 1e6), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "active", JS_NewFloat64(ctx, elapsed > idle ? (elapsed - idle) / 1e6 : 0), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "ticks", JS_NewInt64(ctx, qrt->metrics.ticks), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "jobs", JS_NewInt64(ctx, qrt->metrics.jobs), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "maxJobsPerTick", JS_NewInt64(ctx, qrt->metrics.max_tick_jobs), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "budgetHits", JS_NewInt64(ctx, qrt->metrics.budget_hits), JS_PROP_C_W_E);
+    JSValue hist = JS_NewObjectProto(ctx, JS_NULL);
+    JS_DefinePropertyValueStr(ctx, hist, "count", JS_NewInt64(ctx, lag->count), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, hist, "min", JS_NewFloat64(ctx, lag->min / 1e6), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, hist, "max", JS_NewFloat64(ctx, lag->max / 1e6), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, hist, "mean", JS_NewFloat64(ctx, lag->count ? lag->sum / lag->count / 1e6 : 0), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, hist, "p50", JS_NewFloat64(ctx, ijHistogramPercentile(lag, 50) / 1e6), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, hist, "p99", JS_NewFloat64(ctx, ijHistogramPercentile(lag, 99) / 1e6), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "lag", hist, JS_PROP_C_W_E);
+    if (JS_ToBool(ctx, argv[0]))
+        ijHistogramReset(lag);
+    return obj;
+}
+
+static JSValue ijStartupTimings(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    JSValue arr = JS_NewArray(ctx);
+    /* times are in milliseconds since the process (or worker) started */
+    for (IJU32 i = 0; i < qrt->startup.count; i++) {
+        IJJSStartupEntry* entry = &qrt->startup.entries[i];
+        JSValue obj = JS_NewObjectProto(ctx, JS_NULL);
+        JS_DefinePropertyValueStr(ctx, obj, "name", JS_NewString(ctx, entry->name), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, obj, "startTime", JS_NewFloat64(ctx, (entry->start - qrt->startup.origin) / 1e6), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, obj, "duration", JS_NewFloat64(ctx, entry->duration / 1e6), JS_PROP_C_W_E);
+        JS_DefinePropertyValueUint32(ctx, arr, i, obj, JS_PROP_C_W_E);
+    }
+    return arr;
+}
+
+static JSValue ijGCEntries(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    IJJSGCEntry entries[IJJS_GC_ENTRIES];
+    IJU32 count = qrt->gc.count;
+    /* copied out first, building the result can run the GC and add entries */
+    for (IJU32 i = 0; i < count; i++)
+        entries[i] = qrt->gc.entries[(qrt->gc.head + i) % IJJS_GC_ENTRIES];
+    qrt->gc.head = 0;
+    qrt->gc.count = 0;
+    JSValue arr = JS_NewArray(ctx);
+    /* the cycles since the last call, times are hrtime() in milliseconds */
+    for (IJU32 i = 0; i < count; i++) {
+        JSValue obj = JS_NewObjectProto(ctx, JS_NULL);
+        JS_DefinePropertyValueStr(ctx, obj, "startTime", JS_NewFloat64(ctx, entries[i].start / 1e6), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, obj, "duration", JS_NewFloat64(ctx, entries[i].duration / 1e6), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, obj, "freed", JS_NewInt64(ctx, entries[i].freed), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, obj, "heapSize", JS_NewInt64(ctx, entries[i].heap_size), JS_PROP_C_W_E);
+        JS_DefinePropertyValueUint32(ctx, arr, i, obj, JS_PROP_C_W_E);
+    }
+    return arr;
+}
+
+static JSValue ijSetJobBudget(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    IJU32 count, us = 0;
+    if (JS_ToUint32(ctx, &count, argv[0]))
+        return JS_EXCEPTION;
+    if (!JS_IsUndefined(argv[1]) && JS_ToUint32(ctx, &us, argv[1]))
+        return JS_EXCEPTION;
+    qrt->options.job_budget = count;
+    qrt->options.job_budget_us = us;
+    return JS_UNDEFINED;
+}
+
 static JSValue ijUname(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
     JSValue obj;
     IJS32 r;
@@ -264,6 +339,10 @@ static const JSCFunctionListEntry ijjs_misc_funcs[] = {
     IJJS_CONST(STDERR_FILENO),
     JS_CFUNC_DEF("hrtime", 0, ijHrTime),
     JS_CFUNC_DEF("gettimeofday", 0, ijGetTimeOfDay),
+    JS_CFUNC_DEF("loopMetrics", 1, ijLoopMetrics),
+    JS_CFUNC_DEF("setJobBudget", 2, ijSetJobBudget),
+    JS_CFUNC_DEF("startupTimings", 0, ijStartupTimings),
+    JS_CFUNC_DEF("gcEntries", 0, ijGCEntries),
     JS_CFUNC_DEF("uname", 0, ijUname),
     JS_CFUNC_DEF("isatty", 1, ijIsAtty),
     JS_CFUNC_DEF("environ", 0, ijEnviron),
@@ -45,22 +45,32 @@
 
 static const IJAnsi http[] = "http://";
 static const IJAnsi https[] = "https://";
-static const IJAnsi json_tpl_start[] = "export default JSON.parse(`";
-static const IJAnsi json_tpl_end[] = "`);";
+
+/* the value of a json module, kept for its default export and for bundles */
+typedef struct IJJSJsonModule {
+    struct IJJSJsonModule* next;
+    JSModuleDef* m;
+    JSValue value;
+} IJJSJsonModule;
 
 JSModuleDef* ijLoadHttp(JSContext* ctx, const IJAnsi* url) {
     JSModuleDef* m;
     DynBuf dbuf;
     dbuf_init(&dbuf);
-    IJS32 r = ijCurlLoadHttp(&dbuf, url);
+    IJS32 r = ijHttpModuleLoad(ctx, url, &dbuf);
     if (r != 200) {
         m = NULL;
-        JS_ThrowReferenceError(ctx, "could not load '%s' code: %d", url, r);
+        if (r == 0)
+            JS_ThrowReferenceError(ctx, "could not load '%s': not in the http cache", url);
+        else
+            JS_ThrowReferenceError(ctx, "could not load '%s' code: %d", url, r);
         goto end;
     }
-    JSValue func_val = JS_Eval(ctx, (IJAnsi*)dbuf.buf, dbuf.size, url, JS_EVAL_TYPE_MODULE | JS_EVAL_FLAG_COMPILE_ONLY);
+    dbuf_putc(&dbuf, '\0');
+    JSValue func_val = JS_Eval(ctx, (IJAnsi*)dbuf.buf, dbuf.size - 1, url, JS_EVAL_TYPE_MODULE | JS_EVAL_FLAG_COMPILE_ONLY);
     if (JS_IsException(func_val)) {
         JS_FreeValue(ctx, func_val);
+        ijHttpModuleForget(ctx, url);
         m = NULL;
         goto end;
     }
@@ -121,10 +131,66 @@ fail:
     return m;
 }
 
-JSModuleDef* ijModuleLoader(JSContext* ctx, const IJAnsi* module_name, IJVoid* opaque) {
+static IJS32 ijModuleJsonInit(JSContext* ctx, JSModuleDef* m) {
+    return JS_SetModuleExport(ctx, m, "default", ijModuleJsonValue(ctx, m));
+}
+
+JSModuleDef* ijModuleNewJson(JSContext* ctx, const IJAnsi* module_name, JSValue value) {
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    JSModuleDef* m = JS_NewCModule(ctx, module_name, ijModuleJsonInit);
+    IJJSJsonModule* j = m ? js_malloc(ctx, sizeof(*j)) : NULL;
+    if (!j || JS_AddModuleExport(ctx, m, "default") < 0) {
+        js_free(ctx, j);
+        JS_FreeValue(ctx, value);
+        return NULL;
+    }
+    j->m = m;
+    j->value = value;
+    j->next = qrt->json_modules;
+    qrt->json_modules = j;
+    return m;
+}
+
+JSValue ijModuleJsonValue(JSContext* ctx, JSModuleDef* m) {
+    for (IJJSJsonModule* j = ijGetRuntime(ctx)->json_modules; j; j = j->next) {
+        if (j->m == m)
+            return JS_DupValue(ctx, j->value);
+    }
+    return JS_UNDEFINED;
+}
+
+IJVoid ijModuleFreeJson(IJJSRuntime* qrt) {
+    IJJSJsonModule* j = qrt->json_modules;
+    while (j) {
+        IJJSJsonModule* next = j->next;
+        JS_FreeValue(qrt->ctx, j->value);
+        js_free(qrt->ctx, j);
+        j = next;
+    }
+    qrt->json_modules = NULL;
+}
+
+/* the file is parsed into the value of the default export, it is never compiled as code */
+static JSModuleDef* ijLoadJson(JSContext* ctx, const IJAnsi* filename) {
+    DynBuf source;
+    dbuf_init(&source);
+    if (!ijPrefetchTake(ctx, filename, &source) && ijLoadFile(ctx, &source, filename) != 0) {
+        dbuf_free(&source);
+        JS_ThrowReferenceError(ctx, "could not load '%s'", filename);
+        return NULL;
+    }
+    dbuf_putc(&source, '\0');
+    JSValue value = JS_ParseJSON(ctx, (const IJAnsi*)source.buf, source.size - 1, filename);
+    dbuf_free(&source);
+    if (JS_IsException(value))
+        return NULL;
+    return ijModuleNewJson(ctx, filename, value);
+}
+
+static JSModuleDef* ijModuleLoad(JSContext* ctx, const IJAnsi* module_name, IJBool* native) {
     JSModuleDef* m;
     JSValue func_val;
-    IJS32 r, is_json;
+    IJS32 r;
     DynBuf dbuf;
     IJAnsi dlfile[260] = { 0 };
     IJS32 type = SCRIPT_MODULE;
@@ -138,7 +204,7 @@ JSModuleDef* ijModuleLoader(JSContext* ctx, const IJAnsi* module_name, IJVoid* o
     else {
         strcpy(dlfile, module_name);
         strcat(dlfile, DL_SUFFIX);
-        if (ACCESS(dlfile, 0) == 0) {
+        if (ijResolveExists(ijGetRuntime(ctx), dlfile)) {
             type = DL_MODULE;
         }
         else {
@@ -152,27 +218,42 @@ JSModuleDef* ijModuleLoader(JSContext* ctx, const IJAnsi* module_name, IJVoid* o
     case HTTP_MODULE:
         return ijLoadHttp(ctx, module_name);
     case DL_MODULE:
+        *native = TRUE;
         return ijLoadDynamicLibrary(ctx, dlfile);
     default:
+        if (has_suffix(dlfile, ".json"))
+            return ijLoadJson(ctx, dlfile);
         dbuf_init(&dbuf);
-        is_json = has_suffix(dlfile, ".json");
-        if (is_json)
-            dbuf_put(&dbuf, (const IJU8*)json_tpl_start, strlen(json_tpl_start));
-        r = ijLoadFile(ctx, &dbuf, dlfile);
+        func_val = ijCodeCacheLoad(ctx, dlfile, &dbuf);
+        if (!JS_IsUndefined(func_val)) {
+            dbuf_free(&dbuf);
+            goto loaded;
+        }
+        if (dbuf.size != 0)
+            r = 0;
+        else if (ijPrefetchTake(ctx, dlfile, &dbuf))
+            r = 0;
+        else if ((r = ijLoadFile(ctx, &dbuf, dlfile)) == 0)
+            ijPrefetchImports(ctx, dlfile, &dbuf);
         if (r != 0) {
             dbuf_free(&dbuf);
             JS_ThrowReferenceError(ctx, "could not load '%s'", dlfile);
             return NULL;
         }
-        if (is_json)
-            dbuf_put(&dbuf, (const IJU8*)json_tpl_end, strlen(json_tpl_end));
+        if (ijBundleScanWorkers(ctx, (const IJAnsi*)dbuf.buf, dbuf.size) < 0) {
+            dbuf_free(&dbuf);
+            return NULL;
+        }
         dbuf_putc(&dbuf, '\0');
         func_val = JS_Eval(ctx, (IJAnsi*)dbuf.buf, dbuf.size, dlfile, JS_EVAL_TYPE_MODULE | JS_EVAL_FLAG_COMPILE_ONLY);
+        if (!JS_IsException(func_val))
+            ijCodeCacheStore(ctx, dlfile, func_val, &dbuf);
         dbuf_free(&dbuf);
         if (JS_IsException(func_val)) {
             JS_FreeValue(ctx, func_val);
             return NULL;
         }
+loaded:
         ijModuleSetImportMeta(ctx, func_val, TRUE, FALSE);
         m = JS_VALUE_GET_PTR(func_val);
         JS_FreeValue(ctx, func_val);
@@ -180,6 +261,23 @@ JSModuleDef* ijModuleLoader(JSContext* ctx, const IJAnsi* module_name, IJVoid* o
     }
 }
 
+JSModuleDef* ijModuleLoader(JSContext* ctx, const IJAnsi* module_name, IJVoid* opaque) {
+    JSModuleDef* m;
+    IJBool native = FALSE;
+    JSValue bundled = ijBundleLoadModule(ctx, module_name);
+    if (JS_IsException(bundled))
+        return NULL;
+    if (!JS_IsUndefined(bundled)) {
+        m = JS_VALUE_GET_PTR(bundled);
+        JS_FreeValue(ctx, bundled);
+        return m;
+    }
+    m = ijModuleLoad(ctx, module_name, &native);
+    if (m && ijBundleAdd(ctx, module_name, m, native) < 0)
+        return NULL;
+    return m;
+}
+
 IJS32 ijModuleSetImportMeta(JSContext* ctx, JSValueConst func_val, JS_BOOL use_realpath, JS_BOOL is_main) {
     JSModuleDef* m;
     IJAnsi buf[PATH_MAX + 16];
@@ -197,16 +295,14 @@ IJS32 ijModuleSetImportMeta(JSContext* ctx, JSValueConst func_val, JS_BOOL use_r
     if (!strchr(module_name, ':')) {
         pstrcpy(buf, sizeof(buf), "file://");
         if (use_realpath) {
-            uv_fs_t req;
-            r = uv_fs_realpath(NULL, &req, module_name, NULL);
+            IJAnsi path[PATH_MAX];
+            r = ijResolveRealpath(ijGetRuntime(ctx), module_name, path, sizeof(path));
             if (r != 0) {
-                uv_fs_req_cleanup(&req);
                 JS_ThrowTypeError(ctx, "realpath failure");
                 JS_FreeCString(ctx, module_name);
                 return -1;
             }
-            pstrcat(buf, sizeof(buf), req.ptr);
-            uv_fs_req_cleanup(&req);
+            pstrcat(buf, sizeof(buf), path);
         } else {
             pstrcat(buf, sizeof(buf), module_name);
         }
@@ -360,7 +456,8 @@ IJAnsi* ijModuleNormalizer(JSContext* ctx, const IJAnsi* base_name, const IJAnsi
                 p[0] = '/';
         }
 #endif
-        if (ACCESS(filename, 0) == 0) 
+        /* bundled modules need not exist on disk, urls are taken as they are */
+        if (strstr(filename, "://") || ijResolveExists(qrt, filename) || ijBundleFind(qrt, filename) >= 0)
             return filename;
         else
         {
@@ -0,0 +1,378 @@
+/*
+ ijjs javascript runtime engine
+ Copyright (C) 2010-2017 Trix
+
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include "ijjs.h"
+#include <string.h>
+
+#define IJJS_PREFETCH_BUCKETS 256
+
+/*
+ * When a module is loaded its static imports are known before it is compiled, so the files
+ * they name are read on the thread pool while the main thread parses. Every file read there is
+ * also scanned for its own imports, which are queued as soon as the loader takes the file, so
+ * a whole module graph streams in ahead of the compiler. Compiling stays on the main thread,
+ * functions must keep their source for toString() and bytecode would lose it. Json imports are
+ * read there as well but parsed by the loader, a value built in another runtime would have to be
+ * serialized across and that costs more than the parse.
+ */
+typedef struct IJJSPrefetch {
+    uv_work_t req;
+    struct IJJSPrefetch* next;
+    IJJSRuntime* qrt;
+    IJU64 hash;
+    IJAnsi* filename;
+    DynBuf source;
+    IJAnsi** imports;
+    IJU32 import_count;
+    IJS32 status;
+    IJS32 refs;       /* the table and the thread pool request */
+    IJBool done;      /* guarded by the mutex, set by the thread pool */
+    IJBool taken;
+} IJJSPrefetch;
+
+/* FNV-1a */
+static IJU64 ijPrefetchHash(const IJAnsi* key) {
+    IJU64 h = 14695981039346656037ULL;
+    for (; *key; key++) {
+        h ^= (IJU8)*key;
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+static IJVoid ijPrefetchFreeImports(IJJSPrefetch* p) {
+    for (IJU32 i = 0; i < p->import_count; i++)
+        je_free(p->imports[i]);
+    je_free(p->imports);
+    p->imports = NULL;
+    p->import_count = 0;
+}
+
+static IJVoid ijPrefetchRelease(IJJSPrefetch* p) {
+    if (--p->refs)
+        return;
+    ijPrefetchFreeImports(p);
+    dbuf_free(&p->source);
+    je_free(p->filename);
+    je_free(p);
+}
+
+static IJBool ijPrefetchIdent(IJAnsi c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == '$' || (IJU8)c >= 0x80;
+}
+
+static const IJAnsi* ijPrefetchSkip(const IJAnsi* s, const IJAnsi* end) {
+    while (s < end) {
+        if (*s == ' ' || *s == '\t' || *s == '\r' || *s == '\n') {
+            s++;
+        } else if (*s == '/' && s + 1 < end && s[1] == '/') {
+            while (s < end && *s != '\n')
+                s++;
+        } else if (*s == '/' && s + 1 < end && s[1] == '*') {
+            for (s += 2; s + 1 < end && !(s[0] == '*' && s[1] == '/'); s++)
+                ;
+            s += 2;
+        } else {
+            break;
+        }
+    }
+    return s < end ? s : end;
+}
+
+/* s points after the opening quote, returns the position after the closing one */
+static const IJAnsi* ijPrefetchString(const IJAnsi* s, const IJAnsi* end, IJAnsi quote) {
+    for (; s < end; s++) {
+        if (*s == '\\')
+            s++;
+        else if (*s == quote)
+            return s + 1;
+    }
+    return end;
+}
+
+static IJBool ijPrefetchWord(const IJAnsi* s, size_t len, const IJAnsi* word) {
+    return strlen(word) == len && !memcmp(s, word, len);
+}
+
+static IJVoid ijPrefetchAdd(IJJSPrefetch* p, const IJAnsi* s, size_t len) {
+    if (!len || len >= PATH_MAX || memchr(s, '\\', len))
+        return;
+    IJAnsi* name = je_malloc(len + 1);
+    CHECK_NOT_NULL(name);
+    memcpy(name, s, len);
+    name[len] = '\0';
+    p->imports = je_realloc(p->imports, (p->import_count + 1) * sizeof(*p->imports));
+    CHECK_NOT_NULL(p->imports);
+    p->imports[p->import_count++] = name;
+}
+
+/*
+ * Reads the clause after an import or export keyword up to its module specifier. Anything that
+ * is not `import 'x'`, `import ... from 'x'` or `export ... from 'x'` ends the clause, so
+ * import() and import.meta are left alone. A missed import only means it is read later.
+ */
+static const IJAnsi* ijPrefetchClause(IJJSPrefetch* p, const IJAnsi* s, const IJAnsi* end, IJBool is_import) {
+    static const IJAnsi* declarations[] = { "default", "function", "class", "const", "let", "var", "async" };
+    IJBool from = is_import;
+    for (IJS32 tokens = 0; tokens < 256; tokens++) {
+        s = ijPrefetchSkip(s, end);
+        if (s == end)
+            return s;
+        if (*s == '\'' || *s == '"') {
+            const IJAnsi* e = ijPrefetchString(s + 1, end, *s);
+            if (from && e[-1] == *s)
+                ijPrefetchAdd(p, s + 1, e - s - 2);
+            return e;
+        } else if (*s == '{') {
+            while (s < end && *s != '}')
+                s++;
+            s++;
+            from = FALSE;
+        } else if (*s == '*' || *s == ',') {
+            s++;
+            from = FALSE;
+        } else if (ijPrefetchIdent(*s)) {
+            const IJAnsi* word = s;
+            while (s < end && ijPrefetchIdent(*s))
+                s++;
+            from = ijPrefetchWord(word, s - word, "from");
+            if (!is_import && tokens == 0) {
+                for (IJS32 i = 0; i < countof(declarations); i++) {
+                    if (ijPrefetchWord(word, s - word, declarations[i]))
+                        return s;
+                }
+            }
+        } else {
+            return s;
+        }
+    }
+    return s;
+}
+
+static IJVoid ijPrefetchScan(IJJSPrefetch* p, const IJAnsi* s, size_t len) {
+    const IJAnsi* end = s + len;
+    IJAnsi prev = '\0';
+    while (s < end) {
+        if (*s == '/' && s + 1 < end && (s[1] == '/' || s[1] == '*')) {
+            s = ijPrefetchSkip(s, end);
+        } else if (*s == '\'' || *s == '"' || *s == '`') {
+            s = ijPrefetchString(s + 1, end, *s);
+            prev = '"';
+        } else if (ijPrefetchIdent(*s)) {
+            const IJAnsi* word = s;
+            while (s < end && ijPrefetchIdent(*s))
+                s++;
+            /* obj.import is a property, not a declaration */
+            if (prev != '.' && ijPrefetchWord(word, s - word, "import"))
+                s = ijPrefetchClause(p, s, end, TRUE);
+            else if (prev != '.' && ijPrefetchWord(word, s - word, "export"))
+                s = ijPrefetchClause(p, s, end, FALSE);
+            prev = 'a';
+        } else {
+            if (*s != ' ' && *s != '\t' && *s != '\r' && *s != '\n')
+                prev = *s;
+            s++;
+        }
+    }
+}
+
+static IJBool ijPrefetchIsJson(const IJAnsi* filename) {
+    size_t len = strlen(filename);
+    return len > 5 && !strcmp(filename + len - 5, ".json");
+}
+
+static IJVoid ijPrefetchWork(uv_work_t* req) {
+    IJJSPrefetch* p = req->data;
+    IJJSRuntime* qrt = p->qrt;
+    p->status = ijLoadFile(NULL, &p->source, p->filename);
+    if (p->status == 0 && !ijPrefetchIsJson(p->filename))
+        ijPrefetchScan(p, (const IJAnsi*)p->source.buf, p->source.size);
+    uv_mutex_lock(&qrt->prefetch.mutex);
+    p->done = TRUE;
+    uv_cond_broadcast(&qrt->prefetch.cond);
+    uv_mutex_unlock(&qrt->prefetch.mutex);
+}
+
+static IJVoid ijPrefetchAfterWork(uv_work_t* req, IJS32 status) {
+    ijPrefetchRelease(req->data);
+}
+
+static IJJSPrefetch* ijPrefetchFind(IJJSRuntime* qrt, const IJAnsi* filename, IJU64 hash) {
+    for (IJJSPrefetch* p = qrt->prefetch.table[hash % IJJS_PREFETCH_BUCKETS]; p; p = p->next) {
+        if (p->hash == hash && !strcmp(p->filename, filename))
+            return p;
+    }
+    return NULL;
+}
+
+static IJJSPrefetch* ijPrefetchNew(IJJSRuntime* qrt, const IJAnsi* filename, IJU64 hash) {
+    IJJSPrefetch* p = je_calloc(1, sizeof(*p));
+    CHECK_NOT_NULL(p);
+    size_t len = strlen(filename) + 1;
+    p->filename = je_malloc(len);
+    CHECK_NOT_NULL(p->filename);
+    memcpy(p->filename, filename, len);
+    p->qrt = qrt;
+    p->hash = hash;
+    p->refs = 1;
+    p->req.data = p;
+    dbuf_init(&p->source);
+    p->next = qrt->prefetch.table[hash % IJJS_PREFETCH_BUCKETS];
+    qrt->prefetch.table[hash % IJJS_PREFETCH_BUCKETS] = p;
+    return p;
+}
+
+static uv_once_t ijPrefetchOnce = UV_ONCE_INIT;
+static IJBool ijPrefetchParallel;
+
+/* with a single CPU the thread pool only takes turns with the main thread */
+static IJVoid ijPrefetchCheckCpus(IJVoid) {
+#if IJJS_PLATFORM == IJJS_PLATFORM_WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    ijPrefetchParallel = info.dwNumberOfProcessors > 1;
+#else
+    ijPrefetchParallel = sysconf(_SC_NPROCESSORS_ONLN) > 1;
+#endif
+}
+
+/* bundled modules are already in memory and cached ones are not compiled from source */
+static IJBool ijPrefetchEnabled(IJJSRuntime* qrt) {
+    if (!qrt->prefetch.table || !qrt->options.module_prefetch || qrt->options.code_cache_dir || qrt->bundle.data)
+        return FALSE;
+    uv_once(&ijPrefetchOnce, ijPrefetchCheckCpus);
+    return ijPrefetchParallel;
+}
+
+static IJVoid ijPrefetchSubmit(JSContext* ctx, const IJAnsi* base_name, IJAnsi** imports, IJU32 count) {
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    IJAnsi base[PATH_MAX];
+    for (IJU32 i = 0; i < count; i++) {
+        /* the normalizer rewrites the separators of its base in place */
+        snprintf(base, sizeof(base), "%s", base_name);
+        IJAnsi* name = ijModuleNormalizer(ctx, base, imports[i], qrt);
+        if (!name) {
+            JS_FreeValue(ctx, JS_GetException(ctx));
+            continue;
+        }
+        size_t len = strlen(name);
+        if (!strncmp(name, "http://", 7) || !strncmp(name, "https://", 8)) {
+            ijHttpModulePrefetch(ctx, name);
+        } else if (((len > 3 && !strcmp(name + len - 3, ".js")) || ijPrefetchIsJson(name)) && !strstr(name, "://") && ijPrefetchEnabled(qrt)) {
+            IJU64 hash = ijPrefetchHash(name);
+            if (!ijPrefetchFind(qrt, name, hash)) {
+                IJJSPrefetch* p = ijPrefetchNew(qrt, name, hash);
+                if (uv_queue_work(&qrt->loop, &p->req, ijPrefetchWork, ijPrefetchAfterWork) == 0)
+                    p->refs++;
+                else
+                    p->done = p->taken = TRUE;
+            }
+        }
+        js_free(ctx, name);
+    }
+}
+
+/* urls are fetched even when files are not prefetched, so sources that name one are scanned */
+static IJBool ijPrefetchHasUrl(const DynBuf* source) {
+    for (size_t i = 0; i + 3 <= source->size; i++) {
+        if (source->buf[i] == ':' && source->buf[i + 1] == '/' && source->buf[i + 2] == '/')
+            return TRUE;
+    }
+    return FALSE;
+}
+
+IJVoid ijPrefetchImports(JSContext* ctx, const IJAnsi* filename, const DynBuf* source) {
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    IJBool enabled = ijPrefetchEnabled(qrt);
+    if (!enabled && !ijPrefetchHasUrl(source))
+        return;
+    IJU64 hash = ijPrefetchHash(filename);
+    if (enabled && !strstr(filename, "://") && !ijPrefetchFind(qrt, filename, hash)) {
+        /* remembered so that an import cycle back to this module does not read it again */
+        IJJSPrefetch* p = ijPrefetchNew(qrt, filename, hash);
+        p->done = p->taken = TRUE;
+    }
+    IJJSPrefetch scan = { 0 };
+    ijPrefetchScan(&scan, (const IJAnsi*)source->buf, source->size);
+    ijPrefetchSubmit(ctx, filename, scan.imports, scan.import_count);
+    ijPrefetchFreeImports(&scan);
+}
+
+IJBool ijPrefetchTake(JSContext* ctx, const IJAnsi* filename, DynBuf* source) {
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    if (!ijPrefetchEnabled(qrt))
+        return FALSE;
+    IJJSPrefetch* p = ijPrefetchFind(qrt, filename, ijPrefetchHash(filename));
+    if (!p || p->taken)
+        return FALSE;
+    p->taken = TRUE;
+    uv_mutex_lock(&qrt->prefetch.mutex);
+    IJBool done = p->done;
+    uv_mutex_unlock(&qrt->prefetch.mutex);
+    /* a read still waiting for a thread is not worth waiting for, the caller reads the file */
+    if (!done && uv_cancel((uv_req_t*)&p->req) == 0)
+        return FALSE;
+    uv_mutex_lock(&qrt->prefetch.mutex);
+    while (!p->done)
+        uv_cond_wait(&qrt->prefetch.cond, &qrt->prefetch.mutex);
+    uv_mutex_unlock(&qrt->prefetch.mutex);
+    if (p->status != 0) {
+        ijPrefetchFreeImports(p);
+        return FALSE;
+    }
+    dbuf_free(source);
+    memcpy(source, &p->source, sizeof(*source));
+    dbuf_init(&p->source);
+    ijPrefetchSubmit(ctx, filename, p->imports, p->import_count);
+    ijPrefetchFreeImports(p);
+    return TRUE;
+}
+
+IJVoid ijPrefetchInit(IJJSRuntime* qrt) {
+    CHECK_EQ(uv_mutex_init(&qrt->prefetch.mutex), 0);
+    CHECK_EQ(uv_cond_init(&qrt->prefetch.cond), 0);
+    qrt->prefetch.table = je_calloc(IJJS_PREFETCH_BUCKETS, sizeof(*qrt->prefetch.table));
+    CHECK_NOT_NULL(qrt->prefetch.table);
+}
+
+/* the loop has to run afterwards, requests are released by their after work callbacks */
+IJVoid ijPrefetchShutdown(IJJSRuntime* qrt) {
+    if (!qrt->prefetch.table)
+        return;
+    for (IJS32 i = 0; i < IJJS_PREFETCH_BUCKETS; i++) {
+        IJJSPrefetch* p = qrt->prefetch.table[i];
+        while (p) {
+            IJJSPrefetch* next = p->next;
+            if (p->refs > 1 && uv_cancel((uv_req_t*)&p->req) != 0) {
+                uv_mutex_lock(&qrt->prefetch.mutex);
+                while (!p->done)
+                    uv_cond_wait(&qrt->prefetch.cond, &qrt->prefetch.mutex);
+                uv_mutex_unlock(&qrt->prefetch.mutex);
+            }
+            ijPrefetchRelease(p);
+            p = next;
+        }
+    }
+    je_free(qrt->prefetch.table);
+    qrt->prefetch.table = NULL;
+    uv_cond_destroy(&qrt->prefetch.cond);
+    uv_mutex_destroy(&qrt->prefetch.mutex);
+}
@@ -0,0 +1,491 @@
+/*
+ ijjs javascript runtime engine
+ Copyright (C) 2010-2017 Trix
+
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include "ijjs.h"
+
+#define IJJS_CPU_PROF_MAX_DEPTH 256
+#define IJJS_CPU_PROF_DEFAULT_INTERVAL 1000
+
+/* sentinels for the synthetic frames */
+static const IJAnsi ijjs_prof_root[] = "(root)";
+static const IJAnsi ijjs_prof_program[] = "(program)";
+static const IJAnsi ijjs_prof_idle[] = "(idle)";
+
+typedef struct {
+    const IJVoid* id;
+    /* keeps the function behind id alive so that its address is not reused while profiling */
+    JSValue ref;
+    IJAnsi* name;
+    IJAnsi* url;
+    IJS32 line;
+} IJJSProfFunc;
+
+typedef struct {
+    IJU32 func;
+    IJU32 parent;
+    IJU32 first_child;
+    IJU32 next_sibling;
+    IJU64 hits;
+} IJJSProfNode;
+
+typedef struct IJJSCpuProfiler {
+    /* shared with the sampler thread */
+    volatile IJS32 pending;
+    volatile IJS32 running;
+    uv_thread_t thread;
+    uv_mutex_t mutex;
+    uv_cond_t cond;
+    IJU32 interval;
+    IJU64 start;
+    IJU64 last;
+    IJU64 last_idle;
+    IJJSProfFunc* funcs;
+    IJU32 func_count;
+    IJU32 func_size;
+    IJU32* func_table;
+    IJU32 func_table_size;
+    IJJSProfNode* nodes;
+    IJU32 node_count;
+    IJU32 node_size;
+    IJU32* samples;
+    IJU64* times;
+    IJU32 sample_count;
+    IJU32 sample_size;
+    IJU32 program;
+    IJU32 idle;
+} IJJSCpuProfiler;
+
+static IJVoid ijCpuProfThread(IJVoid* arg) {
+    IJJSCpuProfiler* p = arg;
+    uv_mutex_lock(&p->mutex);
+    while (p->running) {
+        uv_cond_timedwait(&p->cond, &p->mutex, p->interval * 1000ULL);
+        p->pending = 1;
+    }
+    uv_mutex_unlock(&p->mutex);
+}
+
+static inline IJU32 ijCpuProfHash(const IJVoid* id, IJU32 size) {
+    uintptr_t h = (uintptr_t)id;
+    h ^= h >> 17;
+    h *= 0x9E3779B1u;
+    return (IJU32)(h ^ (h >> 15)) & (size - 1);
+}
+
+static IJVoid ijCpuProfRehash(IJJSCpuProfiler* p) {
+    IJU32 size = p->func_table_size ? p->func_table_size * 2 : 256;
+    IJU32* table = je_calloc(size, sizeof(*table));
+    CHECK_NOT_NULL(table);
+    for (IJU32 i = 0; i < p->func_count; i++) {
+        IJU32 h = ijCpuProfHash(p->funcs[i].id, size);
+        while (table[h])
+            h = (h + 1) & (size - 1);
+        table[h] = i + 1;
+    }
+    je_free(p->func_table);
+    p->func_table = table;
+    p->func_table_size = size;
+}
+
+static IJU32 ijCpuProfAddFunc(JSContext* ctx, IJJSCpuProfiler* p, const IJVoid* id, const IJAnsi* name, const IJAnsi* url, IJS32 line) {
+    if (p->func_count == p->func_size) {
+        p->func_size = p->func_size ? p->func_size * 2 : 64;
+        p->funcs = je_realloc(p->funcs, p->func_size * sizeof(*p->funcs));
+        CHECK_NOT_NULL(p->funcs);
+    }
+    /* keep the open addressing table at most half full */
+    if ((p->func_count + 1) * 2 > p->func_table_size)
+        ijCpuProfRehash(p);
+    IJJSProfFunc* f = &p->funcs[p->func_count];
+    f->id = id;
+    f->ref = JS_UNDEFINED;
+    f->name = js_strdup(ctx, name);
+    f->url = js_strdup(ctx, url);
+    CHECK_NOT_NULL(f->name);
+    CHECK_NOT_NULL(f->url);
+    f->line = line;
+    IJU32 h = ijCpuProfHash(id, p->func_table_size);
+    while (p->func_table[h])
+        h = (h + 1) & (p->func_table_size - 1);
+    p->func_table[h] = ++p->func_count;
+    return p->func_count - 1;
+}
+
+static IJU32 ijCpuProfFindFunc(JSContext* ctx, IJJSCpuProfiler* p, const IJVoid* id, IJS32 level) {
+    IJU32 h = ijCpuProfHash(id, p->func_table_size);
+    while (p->func_table[h]) {
+        if (p->funcs[p->func_table[h] - 1].id == id)
+            return p->func_table[h] - 1;
+        h = (h + 1) & (p->func_table_size - 1);
+    }
+    /* first time this function shows up, resolve its name and location */
+    IJAnsi name[256];
+    IJAnsi url[1024];
+    IJS32 line;
+    if (JS_GetStackFrameInfo(ctx, level, name, sizeof(name), url, sizeof(url), &line))
+        name[0] = url[0] = '\0', line = -1;
+    IJU32 func = ijCpuProfAddFunc(ctx, p, id, name, url, line);
+    p->funcs[func].ref = JS_GetStackFrameFunction(ctx, level);
+    return func;
+}
+
+static IJU32 ijCpuProfChild(IJJSCpuProfiler* p, IJU32 parent, IJU32 func) {
+    IJU32 i;
+    for (i = p->nodes[parent].first_child; i; i = p->nodes[i].next_sibling) {
+        if (p->nodes[i].func == func)
+            return i;
+    }
+    if (p->node_count == p->node_size) {
+        p->node_size = p->node_size ? p->node_size * 2 : 256;
+        p->nodes = je_realloc(p->nodes, p->node_size * sizeof(*p->nodes));
+        CHECK_NOT_NULL(p->nodes);
+    }
+    i = p->node_count++;
+    p->nodes[i].func = func;
+    p->nodes[i].parent = parent;
+    p->nodes[i].first_child = 0;
+    p->nodes[i].hits = 0;
+    p->nodes[i].next_sibling = p->nodes[parent].first_child;
+    p->nodes[parent].first_child = i;
+    return i;
+}
+
+static IJVoid ijCpuProfRecord(IJJSCpuProfiler* p, IJU32 node, IJU64 time, IJU64 hits) {
+    if (p->sample_count == p->sample_size) {
+        p->sample_size = p->sample_size ? p->sample_size * 2 : 1024;
+        p->samples = je_realloc(p->samples, p->sample_size * sizeof(*p->samples));
+        p->times = je_realloc(p->times, p->sample_size * sizeof(*p->times));
+        CHECK_NOT_NULL(p->samples);
+        CHECK_NOT_NULL(p->times);
+    }
+    p->samples[p->sample_count] = node;
+    p->times[p->sample_count] = time;
+    p->sample_count++;
+    p->nodes[node].hits += hits;
+    p->last = time;
+}
+
+/* JS only gets sampled while it runs, time spent outside of it since the
+   previous sample is charged to (idle) or (program) depending on how much
+   of it the loop spent polling */
+static IJVoid ijCpuProfGap(IJJSRuntime* qrt, IJJSCpuProfiler* p, IJU64 now) {
+    IJU64 interval = p->interval * 1000ULL;
+    IJU64 idle = uv_metrics_idle_time(&qrt->loop);
+    IJU64 idle_delta = idle - p->last_idle;
+    p->last_idle = idle;
+    if (now - p->last <= interval * 2)
+        return;
+    IJU64 gap = now - p->last - interval;
+    ijCpuProfRecord(p, idle_delta * 2 > gap ? p->idle : p->program, p->last + interval, gap / interval);
+}
+
+static IJVoid ijCpuProfSample(IJJSRuntime* qrt, IJJSCpuProfiler* p) {
+    const IJVoid* frames[IJJS_CPU_PROF_MAX_DEPTH];
+    IJS32 n = JS_GetStackFrames(qrt->ctx, frames, IJJS_CPU_PROF_MAX_DEPTH);
+    IJU64 now = uv_hrtime();
+    if (n <= 0)
+        return;
+    ijCpuProfGap(qrt, p, now);
+    IJU32 node = 0;
+    for (IJS32 level = n - 1; level >= 0; level--)
+        node = ijCpuProfChild(p, node, ijCpuProfFindFunc(qrt->ctx, p, frames[level], level));
+    ijCpuProfRecord(p, node, now, 1);
+}
+
+static IJS32 ijCpuProfInterrupt(JSRuntime* rt, IJVoid* opaque) {
+    IJJSRuntime* qrt = opaque;
+    IJJSCpuProfiler* p = qrt->cpu_profiler;
+    if (p && p->pending) {
+        p->pending = 0;
+        ijCpuProfSample(qrt, p);
+    }
+    return 0;
+}
+
+static IJVoid ijCpuProfDestroy(JSContext* ctx, IJJSCpuProfiler* p) {
+    for (IJU32 i = 0; i < p->func_count; i++) {
+        JS_FreeValue(ctx, p->funcs[i].ref);
+        js_free(ctx, p->funcs[i].name);
+        js_free(ctx, p->funcs[i].url);
+    }
+    je_free(p->funcs);
+    je_free(p->func_table);
+    je_free(p->nodes);
+    je_free(p->samples);
+    je_free(p->times);
+    je_free(p);
+}
+
+IJS32 ijCpuProfilerStart(IJJSRuntime* qrt, IJU32 interval) {
+    if (qrt->cpu_profiler)
+        return UV_EBUSY;
+    IJJSCpuProfiler* p = je_calloc(1, sizeof(*p));
+    if (!p)
+        return UV_ENOMEM;
+    p->interval = interval ? interval : IJJS_CPU_PROF_DEFAULT_INTERVAL;
+    p->node_size = 256;
+    p->nodes = je_calloc(p->node_size, sizeof(*p->nodes));
+    CHECK_NOT_NULL(p->nodes);
+    /* node 0 is the root, func 0 is its frame */
+    p->node_count = 1;
+    ijCpuProfAddFunc(qrt->ctx, p, ijjs_prof_root, ijjs_prof_root, "", -1);
+    p->program = ijCpuProfChild(p, 0, ijCpuProfAddFunc(qrt->ctx, p, ijjs_prof_program, ijjs_prof_program, "", -1));
+    p->idle = ijCpuProfChild(p, 0, ijCpuProfAddFunc(qrt->ctx, p, ijjs_prof_idle, ijjs_prof_idle, "", -1));
+    p->start = p->last = uv_hrtime();
+    p->last_idle = uv_metrics_idle_time(&qrt->loop);
+    p->running = 1;
+    CHECK_EQ(uv_mutex_init(&p->mutex), 0);
+    CHECK_EQ(uv_cond_init(&p->cond), 0);
+    IJS32 r = uv_thread_create(&p->thread, ijCpuProfThread, p);
+    if (r != 0) {
+        uv_cond_destroy(&p->cond);
+        uv_mutex_destroy(&p->mutex);
+        ijCpuProfDestroy(qrt->ctx, p);
+        return r;
+    }
+    qrt->cpu_profiler = p;
+    JS_SetInterruptHandler(qrt->rt, ijCpuProfInterrupt, qrt);
+    return 0;
+}
+
+static IJJSCpuProfiler* ijCpuProfStop(IJJSRuntime* qrt) {
+    IJJSCpuProfiler* p = qrt->cpu_profiler;
+    if (!p)
+        return NULL;
+    JS_SetInterruptHandler(qrt->rt, NULL, NULL);
+    qrt->cpu_profiler = NULL;
+    uv_mutex_lock(&p->mutex);
+    p->running = 0;
+    uv_cond_signal(&p->cond);
+    uv_mutex_unlock(&p->mutex);
+    CHECK_EQ(uv_thread_join(&p->thread), 0);
+    uv_cond_destroy(&p->cond);
+    uv_mutex_destroy(&p->mutex);
+    ijCpuProfGap(qrt, p, uv_hrtime());
+    return p;
+}
+
+/* Chrome DevTools .cpuprofile layout, node ids are 1-based and times in microseconds */
+static JSValue ijCpuProfToProfile(JSContext* ctx, IJJSCpuProfiler* p, IJU64 end) {
+    JSValue obj = JS_NewObject(ctx);
+    JSValue nodes = JS_NewArray(ctx);
+    for (IJU32 i = 0; i < p->node_count; i++) {
+        IJJSProfNode* n = &p->nodes[i];
+        IJJSProfFunc* f = &p->funcs[n->func];
+        JSValue node = JS_NewObject(ctx);
+        JSValue frame = JS_NewObject(ctx);
+        JS_DefinePropertyValueStr(ctx, frame, "functionName", JS_NewString(ctx, f->name), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, frame, "scriptId", JS_NewString(ctx, "0"), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, frame, "url", JS_NewString(ctx, f->url), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, frame, "lineNumber", JS_NewInt32(ctx, f->line > 0 ? f->line - 1 : -1), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, frame, "columnNumber", JS_NewInt32(ctx, f->line > 0 ? 0 : -1), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, node, "id", JS_NewUint32(ctx, i + 1), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, node, "callFrame", frame, JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, node, "hitCount", JS_NewInt64(ctx, n->hits), JS_PROP_C_W_E);
+        JSValue children = JS_NewArray(ctx);
+        IJU32 k = 0;
+        for (IJU32 c = n->first_child; c; c = p->nodes[c].next_sibling)
+            JS_DefinePropertyValueUint32(ctx, children, k++, JS_NewUint32(ctx, c + 1), JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, node, "children", children, JS_PROP_C_W_E);
+        JS_DefinePropertyValueUint32(ctx, nodes, i, node, JS_PROP_C_W_E);
+    }
+    JSValue samples = JS_NewArray(ctx);
+    JSValue deltas = JS_NewArray(ctx);
+    IJU64 prev = p->start / 1000;
+    for (IJU32 i = 0; i < p->sample_count; i++) {
+        JS_DefinePropertyValueUint32(ctx, samples, i, JS_NewUint32(ctx, p->samples[i] + 1), JS_PROP_C_W_E);
+        JS_DefinePropertyValueUint32(ctx, deltas, i, JS_NewInt64(ctx, p->times[i] / 1000 - prev), JS_PROP_C_W_E);
+        prev = p->times[i] / 1000;
+    }
+    JS_DefinePropertyValueStr(ctx, obj, "nodes", nodes, JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "startTime", JS_NewInt64(ctx, p->start / 1000), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "endTime", JS_NewInt64(ctx, end / 1000), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "samples", samples, JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "timeDeltas", deltas, JS_PROP_C_W_E);
+    return obj;
+}
+
+static IJVoid ijCpuProfPutFrame(DynBuf* dbuf, const IJAnsi* str) {
+    /* ';' separates frames and must not appear inside one */
+    for (; *str; str++)
+        dbuf_putc(dbuf, *str == ';' ? ',' : *str);
+}
+
+static IJVoid ijCpuProfPutStack(DynBuf* dbuf, IJJSCpuProfiler* p, IJU32 node) {
+    if (p->nodes[node].parent) {
+        ijCpuProfPutStack(dbuf, p, p->nodes[node].parent);
+        dbuf_putc(dbuf, ';');
+    }
+    IJJSProfFunc* f = &p->funcs[p->nodes[node].func];
+    ijCpuProfPutFrame(dbuf, f->name[0] ? f->name : "(anonymous)");
+    if (f->url[0]) {
+        IJAnsi line[16];
+        snprintf(line, sizeof(line), ":%d", f->line);
+        dbuf_putstr(dbuf, " (");
+        ijCpuProfPutFrame(dbuf, f->url);
+        dbuf_putstr(dbuf, line);
+        dbuf_putc(dbuf, ')');
+    }
+}
+
+/* Brendan Gregg's folded stacks, one "outer;...;inner count" line per stack */
+static JSValue ijCpuProfToFolded(JSContext* ctx, IJJSCpuProfiler* p) {
+    DynBuf dbuf;
+    dbuf_init(&dbuf);
+    for (IJU32 i = 1; i < p->node_count; i++) {
+        if (!p->nodes[i].hits)
+            continue;
+        ijCpuProfPutStack(&dbuf, p, i);
+        dbuf_printf(&dbuf, " %llu\n", (unsigned long long)p->nodes[i].hits);
+    }
+    JSValue str = JS_NewStringLen(ctx, (const IJAnsi*)dbuf.buf, dbuf.size);
+    dbuf_free(&dbuf);
+    return str;
+}
+
+static IJS32 ijCpuProfWrite(JSContext* ctx, const IJAnsi* path, JSValueConst str) {
+    size_t len;
+    if (JS_IsException(str))
+        return UV_ENOMEM;
+    const IJAnsi* buf = JS_ToCStringLen(ctx, &len, str);
+    if (!buf)
+        return UV_ENOMEM;
+    uv_fs_t req;
+    IJS32 r = uv_fs_open(NULL, &req, path, O_WRONLY | O_CREAT | O_TRUNC, 0644, NULL);
+    uv_fs_req_cleanup(&req);
+    if (r >= 0) {
+        uv_file fd = r;
+        uv_buf_t b = uv_buf_init((IJAnsi*)buf, (IJU32)len);
+        r = uv_fs_write(NULL, &req, fd, &b, 1, 0, NULL);
+        uv_fs_req_cleanup(&req);
+        r = r < 0 ? r : (size_t)r == len ? 0 : UV_EIO;
+        uv_fs_close(NULL, &req, fd, NULL);
+        uv_fs_req_cleanup(&req);
+    }
+    JS_FreeCString(ctx, buf);
+    return r;
+}
+
+/* --cpu-prof-dir is created with its parents, like node does */
+static IJS32 ijCpuProfMkdir(const IJAnsi* dir) {
+    IJAnsi path[1024];
+    uv_fs_t req;
+    IJS32 r = 0;
+    if (!*dir)
+        return UV_ENOENT;
+    if (snprintf(path, sizeof(path), "%s", dir) >= (IJS32)sizeof(path))
+        return UV_ENAMETOOLONG;
+    for (IJAnsi* p = path + 1; r == 0; p++) {
+#if IJJS_PLATFORM == IJJS_PLATFORM_WIN32
+        if (*p && *p != '/' && *p != '\\')
+            continue;
+#else
+        if (*p && *p != '/')
+            continue;
+#endif
+        IJAnsi c = *p;
+        *p = '\0';
+        r = uv_fs_mkdir(NULL, &req, path, 0755, NULL);
+        uv_fs_req_cleanup(&req);
+        if (r == UV_EEXIST)
+            r = 0;
+        *p = c;
+        if (!c)
+            break;
+    }
+    return r;
+}
+
+IJS32 ijCpuProfilerShutdown(IJJSRuntime* qrt) {
+    IJJSCpuProfiler* p = ijCpuProfStop(qrt);
+    IJS32 r = 0;
+    if (!p)
+        return 0;
+    if (qrt->options.cpu_prof) {
+        JSContext* ctx = qrt->ctx;
+        IJU64 end = uv_hrtime();
+        IJAnsi path[1024];
+        IJS32 len = ijDiagnosticFilename(path, sizeof(path) - 16, qrt->options.cpu_prof_dir, "CPU");
+        JSValue profile = ijCpuProfToProfile(ctx, p, end);
+        JSValue json = JS_JSONStringify(ctx, profile, JS_UNDEFINED, JS_UNDEFINED);
+        JSValue folded = ijCpuProfToFolded(ctx, p);
+        if (qrt->options.cpu_prof_dir)
+            r = ijCpuProfMkdir(qrt->options.cpu_prof_dir);
+        if (r != 0) {
+            fprintf(stderr, "ijjs: could not create %s: %s\n", qrt->options.cpu_prof_dir, uv_strerror(r));
+        } else {
+            strcpy(path + len, ".cpuprofile");
+            if ((r = ijCpuProfWrite(ctx, path, json)) != 0)
+                fprintf(stderr, "ijjs: could not write %s: %s\n", path, uv_strerror(r));
+            strcpy(path + len, ".folded");
+            IJS32 r2 = ijCpuProfWrite(ctx, path, folded);
+            if (r2 != 0) {
+                fprintf(stderr, "ijjs: could not write %s: %s\n", path, uv_strerror(r2));
+                r = r2;
+            }
+        }
+        JS_FreeValue(ctx, profile);
+        JS_FreeValue(ctx, json);
+        JS_FreeValue(ctx, folded);
+    }
+    ijCpuProfDestroy(qrt->ctx, p);
+    return r;
+}
+
+static JSValue ijProfilerStart(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    IJU32 interval = 0;
+    if (!JS_IsUndefined(argv[0]) && JS_ToUint32(ctx, &interval, argv[0]))
+        return JS_EXCEPTION;
+    if (qrt->cpu_profiler)
+        return JS_ThrowTypeError(ctx, "profiler already started");
+    IJS32 r = ijCpuProfilerStart(qrt, interval);
+    if (r != 0)
+        return ijThrowErrno(ctx, r);
+    return JS_UNDEFINED;
+}
+
+static JSValue ijProfilerStop(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    IJJSCpuProfiler* p = ijCpuProfStop(qrt);
+    if (!p)
+        return JS_ThrowTypeError(ctx, "profiler not started");
+    JSValue obj = JS_NewObjectProto(ctx, JS_NULL);
+    JS_DefinePropertyValueStr(ctx, obj, "cpuprofile", ijCpuProfToProfile(ctx, p, uv_hrtime()), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "folded", ijCpuProfToFolded(ctx, p), JS_PROP_C_W_E);
+    ijCpuProfDestroy(ctx, p);
+    return obj;
+}
+
+static const JSCFunctionListEntry ijjs_profiler_funcs[] = {
+    JS_CFUNC_DEF("start", 1, ijProfilerStart),
+    JS_CFUNC_DEF("stop", 0, ijProfilerStop),
+};
+
+IJVoid ijModProfilerInit(JSContext* ctx, JSModuleDef* m) {
+    JSValue obj = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, obj, ijjs_profiler_funcs, countof(ijjs_profiler_funcs));
+    JS_SetModuleExport(ctx, m, "profiler", obj);
+}
+
+IJVoid ijModProfilerExport(JSContext* ctx, JSModuleDef* m) {
+    JS_AddModuleExport(ctx, m, "profiler");
+}
@@ -0,0 +1,281 @@
+/*
+ ijjs javascript runtime engine
+ Copyright (C) 2010-2017 Trix
+
+ This software is provided 'as-is', without any express or implied
+ warranty.  In no event will the authors be held liable for any damages
+ arising from the use of this software.
+
+ Permission is granted to anyone to use this software for any purpose,
+ including commercial applications, and to alter it and redistribute it
+ freely, subject to the following restrictions:
+
+ 1. The origin of this software must not be misrepresented; you must not
+ claim that you wrote the original software. If you use this software
+ in a product, an acknowledgment in the product documentation would be
+ appreciated but is not required.
+ 2. Altered source versions must be plainly marked as such, and must not be
+ misrepresented as being the original software.
+ 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include "ijjs.h"
+#include <string.h>
+#if IJJS_PLATFORM == IJJS_PLATFORM_WIN32
+#define IJJS__PATHSEP  '\\'
+#define IJJS__PATHSEPS "\\"
+#else
+#define IJJS__PATHSEP  '/'
+#define IJJS__PATHSEPS "/"
+#endif
+
+/* the first character of a key says what the entry is */
+#define IJJS_RESOLVE_DIR 'D'        /* directory that was scanned, path is its realpath */
+#define IJJS_RESOLVE_FILE 'F'       /* directory entry, kind is its uv_dirent_type_t */
+#define IJJS_RESOLVE_REALPATH 'R'   /* realpath of a file that could be a link */
+
+typedef struct {
+    IJU64 hash;
+    IJAnsi* key;
+    IJAnsi* path;
+    IJS32 kind;
+} IJJSResolveEntry;
+
+/*
+ * Directories are scanned once and their entries answer later probes, so importing many files
+ * from a directory costs one scandir() and one realpath() instead of access() and realpath()
+ * per file. Only files that were seen are trusted, a miss is checked on disk again, so files
+ * created later are still found. Workers read the cache of the runtime that spawned them.
+ */
+typedef struct IJJSResolveCache {
+    uv_rwlock_t lock;
+    IJU32 refs;
+    struct IJJSResolveCache* parent;
+    IJJSResolveEntry* entries;
+    IJU32 count;
+    IJU32 size;
+    IJU32* table;
+    IJU32 table_size;
+} IJJSResolveCache;
+
+/* FNV-1a */
+static IJU64 ijResolveHash(const IJAnsi* key) {
+    IJU64 h = 14695981039346656037ULL;
+    for (; *key; key++) {
+        h ^= (IJU8)*key;
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+static IJJSResolveEntry* ijResolveFind(IJJSResolveCache* c, const IJAnsi* key, IJU64 hash) {
+    if (!c->table_size)
+        return NULL;
+    IJU32 h = (IJU32)hash & (c->table_size - 1);
+    while (c->table[h]) {
+        IJJSResolveEntry* e = &c->entries[c->table[h] - 1];
+        if (e->hash == hash && !strcmp(e->key, key))
+            return e;
+        h = (h + 1) & (c->table_size - 1);
+    }
+    return NULL;
+}
+
+static IJVoid ijResolveRehash(IJJSResolveCache* c) {
+    IJU32 size = c->table_size ? c->table_size * 2 : 256;
+    IJU32* table = je_calloc(size, sizeof(*table));
+    CHECK_NOT_NULL(table);
+    for (IJU32 i = 0; i < c->count; i++) {
+        IJU32 h = (IJU32)c->entries[i].hash & (size - 1);
+        while (table[h])
+            h = (h + 1) & (size - 1);
+        table[h] = i + 1;
+    }
+    je_free(c->table);
+    c->table = table;
+    c->table_size = size;
+}
+
+static IJAnsi* ijResolveStrdup(const IJAnsi* s) {
+    if (!s)
+        return NULL;
+    size_t len = strlen(s) + 1;
+    IJAnsi* p = je_malloc(len);
+    CHECK_NOT_NULL(p);
+    memcpy(p, s, len);
+    return p;
+}
+
+/* only the runtime that owns the cache adds to it */
+static IJVoid ijResolvePut(IJJSResolveCache* c, const IJAnsi* key, const IJAnsi* path, IJS32 kind) {
+    IJU64 hash = ijResolveHash(key);
+    uv_rwlock_wrlock(&c->lock);
+    if (!ijResolveFind(c, key, hash)) {
+        if (c->count == c->size) {
+            c->size = c->size ? c->size * 2 : 128;
+            c->entries = je_realloc(c->entries, c->size * sizeof(*c->entries));
+            CHECK_NOT_NULL(c->entries);
+        }
+        /* keep the open addressing table at most half full */
+        if ((c->count + 1) * 2 > c->table_size)
+            ijResolveRehash(c);
+        IJJSResolveEntry* e = &c->entries[c->count];
+        e->hash = hash;
+        e->key = ijResolveStrdup(key);
+        e->path = ijResolveStrdup(path);
+        e->kind = kind;
+        IJU32 h = (IJU32)hash & (c->table_size - 1);
+        while (c->table[h])
+            h = (h + 1) & (c->table_size - 1);
+        c->table[h] = ++c->count;
+    }
+    uv_rwlock_wrunlock(&c->lock);
+}
+
+/* copies the entry out, the parent cache may grow while a worker reads it */
+static IJBool ijResolveGet(IJJSResolveCache* c, const IJAnsi* key, IJAnsi* path, size_t size, IJS32* kind) {
+    IJU64 hash = ijResolveHash(key);
+    for (; c; c = c->parent) {
+        uv_rwlock_rdlock(&c->lock);
+        IJJSResolveEntry* e = ijResolveFind(c, key, hash);
+        if (e) {
+            if (path)
+                snprintf(path, size, "%s", e->path ? e->path : "");
+            if (kind)
+                *kind = e->kind;
+        }
+        uv_rwlock_rdunlock(&c->lock);
+        if (e)
+            return TRUE;
+    }
+    return FALSE;
+}
+
+IJJSResolveCache* ijResolveCacheNew(IJJSResolveCache* parent) {
+    IJJSResolveCache* c = je_calloc(1, sizeof(*c));
+    CHECK_NOT_NULL(c);
+    CHECK_EQ(uv_rwlock_init(&c->lock), 0);
+    c->refs = 1;
+    if (parent) {
+        uv_rwlock_wrlock(&parent->lock);
+        parent->refs++;
+        uv_rwlock_wrunlock(&parent->lock);
+        c->parent = parent;
+    }
+    return c;
+}
+
+IJVoid ijResolveCacheRelease(IJJSResolveCache* c) {
+    if (!c)
+        return;
+    uv_rwlock_wrlock(&c->lock);
+    IJU32 refs = --c->refs;
+    uv_rwlock_wrunlock(&c->lock);
+    if (refs)
+        return;
+    ijResolveCacheRelease(c->parent);
+    for (IJU32 i = 0; i < c->count; i++) {
+        je_free(c->entries[i].key);
+        je_free(c->entries[i].path);
+    }
+    je_free(c->entries);
+    je_free(c->table);
+    uv_rwlock_destroy(&c->lock);
+    je_free(c);
+}
+
+static IJVoid ijResolveKey(IJAnsi* key, size_t size, IJAnsi type, const IJAnsi* path) {
+    snprintf(key, size, "%c%s", type, path);
+}
+
+/* splits path into the directory that gets scanned and the name looked up in it */
+static const IJAnsi* ijResolveSplit(const IJAnsi* path, IJAnsi* dir, size_t size) {
+    const IJAnsi* p = strrchr(path, IJJS__PATHSEP);
+    if (!p) {
+        snprintf(dir, size, ".");
+        return path;
+    }
+    snprintf(dir, size, "%.*s", (IJS32)(p == path ? 1 : p - path), path);
+    return p + 1;
+}
+
+static IJVoid ijResolveScan(IJJSResolveCache* c, const IJAnsi* dir) {
+    IJAnsi key[PATH_MAX + 2];
+    IJAnsi realdir[PATH_MAX];
+    uv_fs_t req;
+    uv_dirent_t ent;
+    ijResolveKey(key, sizeof(key), IJJS_RESOLVE_DIR, dir);
+    if (ijResolveGet(c, key, NULL, 0, NULL))
+        return;
+    IJS32 r = uv_fs_realpath(NULL, &req, dir, NULL);
+    if (r == 0)
+        snprintf(realdir, sizeof(realdir), "%s", (const IJAnsi*)req.ptr);
+    uv_fs_req_cleanup(&req);
+    /* a directory that cannot be read is remembered too, its files are probed one by one */
+    ijResolvePut(c, key, r == 0 ? realdir : NULL, 0);
+    if (r != 0 || uv_fs_scandir(NULL, &req, dir, 0, NULL) < 0) {
+        uv_fs_req_cleanup(&req);
+        return;
+    }
+    IJBool cwd = !strcmp(dir, ".");
+    while (uv_fs_scandir_next(&req, &ent) != UV_EOF) {
+        if (cwd)
+            snprintf(key, sizeof(key), "%c%s", IJJS_RESOLVE_FILE, ent.name);
+        else if (dir[0] == IJJS__PATHSEP && !dir[1])
+            snprintf(key, sizeof(key), "%c%c%s", IJJS_RESOLVE_FILE, IJJS__PATHSEP, ent.name);
+        else
+            snprintf(key, sizeof(key), "%c%s%c%s", IJJS_RESOLVE_FILE, dir, IJJS__PATHSEP, ent.name);
+        ijResolvePut(c, key, NULL, ent.type);
+    }
+    uv_fs_req_cleanup(&req);
+}
+
+IJBool ijResolveExists(IJJSRuntime* qrt, const IJAnsi* path) {
+    IJAnsi key[PATH_MAX + 2];
+    IJAnsi dir[PATH_MAX];
+    uv_fs_t req;
+    if (strlen(path) >= PATH_MAX)
+        return FALSE;
+    ijResolveSplit(path, dir, sizeof(dir));
+    ijResolveScan(qrt->resolve, dir);
+    ijResolveKey(key, sizeof(key), IJJS_RESOLVE_FILE, path);
+    if (ijResolveGet(qrt->resolve, key, NULL, 0, NULL))
+        return TRUE;
+    IJS32 r = uv_fs_access(NULL, &req, path, F_OK, NULL);
+    uv_fs_req_cleanup(&req);
+    if (r != 0)
+        return FALSE;
+    ijResolvePut(qrt->resolve, key, NULL, UV_DIRENT_UNKNOWN);
+    return TRUE;
+}
+
+IJS32 ijResolveRealpath(IJJSRuntime* qrt, const IJAnsi* path, IJAnsi* buf, size_t size) {
+    IJAnsi key[PATH_MAX + 2];
+    IJAnsi dir[PATH_MAX];
+    IJS32 kind;
+    uv_fs_t req;
+    if (strlen(path) >= PATH_MAX)
+        return UV_ENAMETOOLONG;
+    const IJAnsi* name = ijResolveSplit(path, dir, sizeof(dir));
+    if (ijResolveExists(qrt, path)) {
+        ijResolveKey(key, sizeof(key), IJJS_RESOLVE_FILE, path);
+        ijResolveGet(qrt->resolve, key, NULL, 0, &kind);
+        /* a regular file lives where its directory does */
+        ijResolveKey(key, sizeof(key), IJJS_RESOLVE_DIR, dir);
+        if (kind == UV_DIRENT_FILE && ijResolveGet(qrt->resolve, key, buf, size, NULL) && buf[0]) {
+            size_t len = strlen(buf);
+            snprintf(buf + len, size - len, "%s%s", buf[len - 1] == IJJS__PATHSEP ? "" : IJJS__PATHSEPS, name);
+            return 0;
+        }
+    }
+    ijResolveKey(key, sizeof(key), IJJS_RESOLVE_REALPATH, path);
+    if (ijResolveGet(qrt->resolve, key, buf, size, NULL))
+        return 0;
+    IJS32 r = uv_fs_realpath(NULL, &req, path, NULL);
+    if (r == 0) {
+        snprintf(buf, size, "%s", (const IJAnsi*)req.ptr);
+        ijResolvePut(qrt->resolve, key, buf, 0);
+    }
+    uv_fs_req_cleanup(&req);
+    return r;
+}
@@ -71,7 +71,9 @@ static JSClassDef ijjs_signal_handler_class = { "SignalHandler", .finalizer = ij
 static IJVoid uvSignalCb(uv_signal_t* handle, IJS32 sig_num) {
     IJJSSignalHandler* sh = handle->data;
     CHECK_NOT_NULL(sh);
+    IJU64 t0 = ijProfileBegin(ijGetRuntime(sh->ctx));
     ijCallHandler(sh->ctx, sh->func);
+    ijProfileEnd(ijGetRuntime(sh->ctx), IJJS_PHASE_IO, t0);
 }
 
 static JSValue ijSignal(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
@@ -49,6 +49,48 @@ static JSValue ijStdGc(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValu
     return JS_UNDEFINED;
 }
 
+static JSValue ijMemoryUsageEntry(JSContext* ctx, IJS64 count, IJS64 size) {
+    JSValue obj = JS_NewObjectProto(ctx, JS_NULL);
+    JS_DefinePropertyValueStr(ctx, obj, "count", JS_NewInt64(ctx, count), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "size", JS_NewInt64(ctx, size), JS_PROP_C_W_E);
+    return obj;
+}
+
+/* sizes are in bytes and cover the calling runtime only */
+static JSValue ijStdMemoryUsage(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    JSMemoryUsage mu;
+    size_t rss = 0;
+    JS_ComputeMemoryUsage(JS_GetRuntime(ctx), &mu);
+    uv_resident_set_memory(&rss);
+    JSValue obj = JS_NewObjectProto(ctx, JS_NULL);
+    JS_DefinePropertyValueStr(ctx, obj, "rss", JS_NewInt64(ctx, rss), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "heapUsed", JS_NewInt64(ctx, mu.memory_used_size), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "mallocSize", JS_NewInt64(ctx, mu.malloc_size), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "mallocCount", JS_NewInt64(ctx, mu.malloc_count), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "mallocLimit", mu.malloc_limit < 0 ? JS_NewFloat64(ctx, INFINITY) : JS_NewInt64(ctx, mu.malloc_limit), JS_PROP_C_W_E);
+    /* everything the runtime thread allocated, JS heap and native code alike */
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    JS_DefinePropertyValueStr(ctx, obj, "arena", JS_NewInt32(ctx, qrt->arena.index), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "arenaAllocated", JS_NewInt64(ctx, ijAllocatorArenaAllocated(qrt)), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "atoms", ijMemoryUsageEntry(ctx, mu.atom_count, mu.atom_size), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "strings", ijMemoryUsageEntry(ctx, mu.str_count, mu.str_size), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "objects", ijMemoryUsageEntry(ctx, mu.obj_count, mu.obj_size), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "properties", ijMemoryUsageEntry(ctx, mu.prop_count, mu.prop_size), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "shapes", ijMemoryUsageEntry(ctx, mu.shape_count, mu.shape_size), JS_PROP_C_W_E);
+    JSValue funcs = ijMemoryUsageEntry(ctx, mu.js_func_count, mu.js_func_size);
+    JS_DefinePropertyValueStr(ctx, funcs, "codeSize", JS_NewInt64(ctx, mu.js_func_code_size), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, funcs, "lineTableSize", JS_NewInt64(ctx, mu.js_func_pc2line_size), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "bytecode", funcs, JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "cFunctions", JS_NewInt64(ctx, mu.c_func_count), JS_PROP_C_W_E);
+    JSValue arrays = JS_NewObjectProto(ctx, JS_NULL);
+    JS_DefinePropertyValueStr(ctx, arrays, "count", JS_NewInt64(ctx, mu.array_count), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, arrays, "fastCount", JS_NewInt64(ctx, mu.fast_array_count), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, arrays, "fastElements", JS_NewInt64(ctx, mu.fast_array_elements), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "arrays", arrays, JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "typedArrays", ijMemoryUsageEntry(ctx, mu.binary_object_count, mu.binary_object_size), JS_PROP_C_W_E);
+    return obj;
+}
+
 static JSValue ijEvalScript(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
     const IJAnsi* str;
     size_t len;
@@ -64,6 +106,7 @@ static JSValue ijEvalScript(JSContext* ctx, JSValueConst this_val, IJS32 argc, J
 static const JSCFunctionListEntry ijjs_std_funcs[] = {
     JS_CFUNC_DEF("exit", 1, ijStdExit),
     JS_CFUNC_DEF("gc", 0, ijStdGc),
+    JS_CFUNC_DEF("memoryUsage", 0, ijStdMemoryUsage),
     JS_CFUNC_DEF("evalScript", 1, ijEvalScript),
     JS_CFUNC_DEF("loadScript", 1, ijLoadScript),
 };
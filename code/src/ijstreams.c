@@ -95,6 +95,7 @@ static IJVoid uvStreamReadCb(uv_stream_t* handle, ssize_t nread, const uv_buf_t*
     CHECK_NOT_NULL(s);
     uv_read_stop(handle);
     JSContext* ctx = s->ctx;
+    IJU64 t0 = ijProfileBegin(ijGetRuntime(ctx));
     JSValue arg;
     IJS32 is_reject = 0;
     if (nread < 0) {
@@ -110,6 +111,7 @@ static IJVoid uvStreamReadCb(uv_stream_t* handle, ssize_t nread, const uv_buf_t*
     }
     ijSettlePromise(ctx, &s->read.result, is_reject, 1, (JSValueConst*)&arg);
     ijClearPromise(ctx, &s->read.result);
+    ijProfileEnd(ijGetRuntime(ctx), IJJS_PHASE_IO, t0);
 }
 
 static JSValue ijStreamRead(JSContext* ctx, IJJSStream* s, IJS32 argc, JSValueConst* argv) {
@@ -131,6 +133,7 @@ static IJVoid uvStreamWriteCb(uv_write_t* req, IJS32 status) {
     IJJSStream* s = req->handle->data;
     CHECK_NOT_NULL(s);
     JSContext* ctx = s->ctx;
+    IJU64 t0 = ijProfileBegin(ijGetRuntime(ctx));
     IJJSWriteReq* wr = req->data;
     IJS32 is_reject = 0;
     JSValue arg;
@@ -142,6 +145,7 @@ static IJVoid uvStreamWriteCb(uv_write_t* req, IJS32 status) {
     }
     ijSettlePromise(ctx, &wr->result, is_reject, 1, (JSValueConst*)&arg);
     js_free(ctx, wr);
+    ijProfileEnd(ijGetRuntime(ctx), IJJS_PHASE_IO, t0);
 }
 
 static JSValue ijStreamWrite(JSContext* ctx, IJJSStream* s, IJS32 argc, JSValueConst* argv) {
@@ -269,6 +273,7 @@ static IJVoid uvStreamConnectionCb(uv_stream_t* handle, IJS32 status) {
         return;
     }
     JSContext* ctx = s->ctx;
+    IJU64 t0 = ijProfileBegin(ijGetRuntime(ctx));
     JSValue arg;
     IJS32 is_reject = 0;
     if (status == 0) {
@@ -297,6 +302,7 @@ static IJVoid uvStreamConnectionCb(uv_stream_t* handle, IJS32 status) {
     }
     ijSettlePromise(ctx, &s->accept.result, is_reject, 1, (JSValueConst*)&arg);
     ijClearPromise(ctx, &s->accept.result);
+    ijProfileEnd(ijGetRuntime(ctx), IJJS_PHASE_IO, t0);
 }
 
 static JSValue ijStreamListen(JSContext* ctx, IJJSStream* s, IJS32 argc, JSValueConst* argv) {
@@ -21,17 +21,151 @@
 
 #include "ijjs.h"
 
+#define IJJS_TIMER_MASK (IJJS_TIMER_SLOTS - 1)
+#define IJJS_TIMER_RANGE (1ULL << (IJJS_TIMER_LEVELS * IJJS_TIMER_BITS))
 
 typedef struct {
     JSContext* ctx;
-    uv_timer_t handle;
-    IJS32 interval;
+    struct list_head link;
+    IJU64 expire;
+    IJS32 slot;
+    IJBool armed;
+    IJBool unref;
+    IJS64 delay;
+    IJS64 repeat;
     JSValue obj;
     JSValue func;
     IJS32 argc;
     JSValue argv[];
 } IJJSTimer;
 
+/*
+ * All timers of a runtime live in a hierarchical wheel with 1ms ticks driven by a
+ * single uv_timer_t. Level 0 holds timers due within the next 64 ticks, each upper
+ * level covers 64 times the range of the one below and is cascaded down whenever the
+ * lower level wraps, so insert and cancel are O(1) list operations.
+ */
+static IJVoid ijTimerWheelAdd(IJJSRuntime* qrt, IJJSTimer* th) {
+    IJU64 now = qrt->timers.now;
+    IJU64 expire = th->expire;
+    IJS32 level = 0;
+    if (expire < now)
+        expire = now;
+    else if (expire - now >= IJJS_TIMER_RANGE)
+        expire = now + IJJS_TIMER_RANGE - 1;
+    while (level < IJJS_TIMER_LEVELS - 1 && expire - now >= (1ULL << ((level + 1) * IJJS_TIMER_BITS)))
+        level++;
+    IJS32 idx = (expire >> (level * IJJS_TIMER_BITS)) & IJJS_TIMER_MASK;
+    th->slot = level * IJJS_TIMER_SLOTS + idx;
+    list_add_tail(&th->link, &qrt->timers.slots[level][idx]);
+    qrt->timers.pending[level] |= 1ULL << idx;
+}
+
+static IJVoid ijTimerWheelDel(IJJSRuntime* qrt, IJJSTimer* th) {
+    IJS32 level = th->slot / IJJS_TIMER_SLOTS;
+    IJS32 idx = th->slot & IJJS_TIMER_MASK;
+    list_del(&th->link);
+    if (list_empty(&qrt->timers.slots[level][idx]))
+        qrt->timers.pending[level] &= ~(1ULL << idx);
+}
+
+/* first tick at or after timers.now that has a level 0 slot to run or an upper slot to cascade */
+static IJU64 ijTimerWheelNext(IJJSRuntime* qrt) {
+    IJU64 now = qrt->timers.now;
+    IJU64 next = UINT64_MAX;
+    for (IJS32 level = 0; level < IJJS_TIMER_LEVELS; level++) {
+        IJU64 bits = qrt->timers.pending[level];
+        if (!bits)
+            continue;
+        IJS32 shift = level * IJJS_TIMER_BITS;
+        IJU32 cur = (now >> shift) & IJJS_TIMER_MASK;
+        IJBool inclusive = (now & ((1ULL << shift) - 1)) == 0;
+        IJU32 start = (cur + (inclusive ? 0 : 1)) & IJJS_TIMER_MASK;
+        IJU64 rot = start ? (bits >> start) | (bits << (IJJS_TIMER_SLOTS - start)) : bits;
+        IJU32 dist = (start + ctz64(rot) - cur) & IJJS_TIMER_MASK;
+        if (dist == 0 && !inclusive)
+            dist = IJJS_TIMER_SLOTS;
+        IJU64 t = ((now >> shift) << shift) + ((IJU64)dist << shift);
+        if (t < next)
+            next = t;
+    }
+    return next;
+}
+
+static IJVoid ijTimerWheelDetach(IJJSRuntime* qrt, IJS32 level, IJS32 idx, struct list_head* list) {
+    struct list_head* slot = &qrt->timers.slots[level][idx];
+    init_list_head(list);
+    while (!list_empty(slot)) {
+        struct list_head* el = slot->next;
+        list_del(el);
+        list_add_tail(el, list);
+    }
+    qrt->timers.pending[level] &= ~(1ULL << idx);
+}
+
+static IJS32 ijTimerWheelCascade(IJJSRuntime* qrt, IJS32 level) {
+    struct list_head list;
+    IJS32 idx = (qrt->timers.now >> (level * IJJS_TIMER_BITS)) & IJJS_TIMER_MASK;
+    ijTimerWheelDetach(qrt, level, idx, &list);
+    while (!list_empty(&list)) {
+        IJJSTimer* th = list_entry(list.next, IJJSTimer, link);
+        list_del(&th->link);
+        ijTimerWheelAdd(qrt, th);
+    }
+    return idx;
+}
+
+static IJVoid uvTimerWheelCb(uv_timer_t* handle);
+
+static IJVoid ijTimerWheelSchedule(IJJSRuntime* qrt) {
+    IJU64 next = ijTimerWheelNext(qrt);
+    if (next == UINT64_MAX) {
+        uv_timer_stop(&qrt->timers.handle);
+        qrt->timers.due = UINT64_MAX;
+        return;
+    }
+    if (next == qrt->timers.due && uv_is_active((uv_handle_t*)&qrt->timers.handle))
+        return;
+    IJU64 now = uv_now(&qrt->loop);
+    CHECK_EQ(uv_timer_start(&qrt->timers.handle, uvTimerWheelCb, next > now ? next - now : 0, 0), 0);
+    qrt->timers.due = next;
+}
+
+/* the shared handle only keeps the loop alive while a ref'ed timer is armed */
+static IJVoid ijTimerWheelUpdateRef(IJJSRuntime* qrt) {
+    if (qrt->timers.refs)
+        uv_ref((uv_handle_t*)&qrt->timers.handle);
+    else
+        uv_unref((uv_handle_t*)&qrt->timers.handle);
+}
+
+static IJVoid ijTimerArm(IJJSTimer* th, IJS64 delay) {
+    IJJSRuntime* qrt = ijGetRuntime(th->ctx);
+    if (th->armed)
+        ijTimerWheelDel(qrt, th);
+    else if (!th->unref && qrt->timers.refs++ == 0)
+        ijTimerWheelUpdateRef(qrt);
+    th->expire = uv_now(&qrt->loop) + (delay > 0 ? delay : 0);
+    th->armed = true;
+    ijTimerWheelAdd(qrt, th);
+    if (th->expire < qrt->timers.due || !uv_is_active((uv_handle_t*)&qrt->timers.handle))
+        ijTimerWheelSchedule(qrt);
+}
+
+static IJVoid ijTimerUnarmed(IJJSRuntime* qrt, IJJSTimer* th) {
+    th->armed = false;
+    if (!th->unref && --qrt->timers.refs == 0)
+        ijTimerWheelUpdateRef(qrt);
+}
+
+static IJVoid ijTimerDisarm(IJJSTimer* th) {
+    if (th->armed) {
+        IJJSRuntime* qrt = ijGetRuntime(th->ctx);
+        ijTimerWheelDel(qrt, th);
+        ijTimerUnarmed(qrt, th);
+    }
+}
+
 static IJVoid ijClearTimer(IJJSTimer* th) {
     JSContext* ctx = th->ctx;
     JS_FreeValue(ctx, th->func);
@@ -57,19 +191,54 @@ static IJVoid ijCallTimer(IJJSTimer* th) {
     JS_FreeValue(ctx, ret);
 }
 
-static IJVoid uvTimerClose(uv_handle_t* handle) {
-    IJJSTimer* th = handle->data;
-    CHECK_NOT_NULL(th);
-    je_free(th);
+static IJVoid ijFireTimer(IJJSTimer* th) {
+    JSContext* ctx = th->ctx;
+    /* the callback may clear the timer and drop the last reference to it */
+    JSValue obj = JS_DupValue(ctx, th->obj);
+    if (!JS_IsUndefined(th->func) && !th->armed) {
+        if (th->repeat)
+            ijTimerArm(th, th->repeat);
+        ijCallTimer(th);
+        /* a fired timeout keeps its callback so refresh() can re-arm it */
+        if (!th->armed) {
+            JSValue self = th->obj;
+            th->obj = JS_UNDEFINED;
+            JS_FreeValue(ctx, self);
+        }
+        /* microtasks queued by the callback run before the next timer, within the job budget */
+        ijExecuteJobs(ctx);
+    }
+    JS_FreeValue(ctx, obj);
 }
 
-static IJVoid uvTimerCb(uv_timer_t* handle) {
-    IJJSTimer* th = handle->data;
-    CHECK_NOT_NULL(th);
-    ijExecuteJobs(th->ctx);
-    ijCallTimer(th);
-    if (!th->interval)
-        ijClearTimer(th);
+static IJVoid uvTimerWheelCb(uv_timer_t* handle) {
+    IJJSRuntime* qrt = handle->data;
+    CHECK_NOT_NULL(qrt);
+    IJU64 t0 = ijProfileBegin(qrt);
+    IJU64 cur = uv_now(&qrt->loop);
+    qrt->timers.due = UINT64_MAX;
+    while (qrt->timers.now <= cur) {
+        IJU64 next = ijTimerWheelNext(qrt);
+        if (next > cur) {
+            qrt->timers.now = cur + 1;
+            break;
+        }
+        qrt->timers.now = next;
+        IJS32 idx = next & IJJS_TIMER_MASK;
+        for (IJS32 level = 1; idx == 0 && level < IJJS_TIMER_LEVELS; level++)
+            idx = ijTimerWheelCascade(qrt, level);
+        struct list_head work;
+        ijTimerWheelDetach(qrt, 0, next & IJJS_TIMER_MASK, &work);
+        qrt->timers.now++;
+        while (!list_empty(&work)) {
+            IJJSTimer* th = list_entry(work.next, IJJSTimer, link);
+            list_del(&th->link);
+            ijTimerUnarmed(qrt, th);
+            ijFireTimer(th);
+        }
+    }
+    ijTimerWheelSchedule(qrt);
+    ijProfileEnd(qrt, IJJS_PHASE_TIMERS, t0);
 }
 
 static JSClassID ijjs_timer_class_id;
@@ -77,8 +246,9 @@ static JSClassID ijjs_timer_class_id;
 static IJVoid ijTimerFinalizer(JSRuntime* rt, JSValue val) {
     IJJSTimer* th = JS_GetOpaque(val, ijjs_timer_class_id);
     if (th) {
+        ijTimerDisarm(th);
         ijClearTimer(th);
-        uv_close((uv_handle_t*)&th->handle, uvTimerClose);
+        je_free(th);
     }
 }
 
@@ -113,16 +283,16 @@ static JSValue ijSetTimeout(JSContext* ctx, JSValueConst this_val, IJS32 argc, J
         return JS_EXCEPTION;
     }
     th->ctx = ctx;
-    CHECK_EQ(uv_timer_init(ijGetLoop(ctx), &th->handle), 0);
-    th->handle.data = th;
-    th->interval = magic;
+    /* like Node, a zero interval still waits one tick between runs */
+    th->delay = delay;
+    th->repeat = magic ? max_int64(delay, 1) : 0;
     th->obj = JS_DupValue(ctx, obj);
     th->func = JS_DupValue(ctx, func);
     th->argc = nargs;
     for (IJS32 i = 0; i < nargs; i++)
         th->argv[i] = JS_DupValue(ctx, argv[i + 2]);
-    CHECK_EQ(uv_timer_start(&th->handle, uvTimerCb, delay, magic ? delay : 0 /* repeat */), 0);
     JS_SetOpaque(obj, th);
+    ijTimerArm(th, delay);
     return obj;
 }
 
@@ -130,25 +300,233 @@ static JSValue ijClearTimeout(JSContext* ctx, JSValueConst this_val, IJS32 argc,
     IJJSTimer* th = JS_GetOpaque2(ctx, argv[0], ijjs_timer_class_id);
     if (!th)
         return JS_EXCEPTION;
-    CHECK_EQ(uv_timer_stop(&th->handle), 0);
+    ijTimerDisarm(th);
     ijClearTimer(th);
     return JS_UNDEFINED;
 }
 
+static JSValue ijTimerRef(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv, IJS32 magic) {
+    IJJSTimer* th = JS_GetOpaque2(ctx, this_val, ijjs_timer_class_id);
+    if (!th)
+        return JS_EXCEPTION;
+    IJBool unref = magic;
+    if (th->unref != unref) {
+        IJJSRuntime* qrt = ijGetRuntime(ctx);
+        th->unref = unref;
+        if (th->armed) {
+            if (unref)
+                qrt->timers.refs--;
+            else
+                qrt->timers.refs++;
+            ijTimerWheelUpdateRef(qrt);
+        }
+    }
+    return JS_DupValue(ctx, this_val);
+}
+
+static JSValue ijTimerHasRef(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSTimer* th = JS_GetOpaque2(ctx, this_val, ijjs_timer_class_id);
+    if (!th)
+        return JS_EXCEPTION;
+    return JS_NewBool(ctx, !th->unref);
+}
+
+static JSValue ijTimerRefresh(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJJSTimer* th = JS_GetOpaque2(ctx, this_val, ijjs_timer_class_id);
+    if (!th)
+        return JS_EXCEPTION;
+    /* cleared timers have dropped their callback and stay cleared */
+    if (JS_IsUndefined(th->func))
+        return JS_DupValue(ctx, this_val);
+    if (JS_IsUndefined(th->obj))
+        th->obj = JS_DupValue(ctx, this_val);
+    ijTimerArm(th, th->repeat ? th->repeat : th->delay);
+    return JS_DupValue(ctx, this_val);
+}
+
+typedef struct IJJSImmediate {
+    IJS64 id;
+    JSValue func;
+    IJS32 argc;
+    JSValue* argv;
+} IJJSImmediate;
+
+static IJVoid ijClearImmediateEntry(JSContext* ctx, IJJSImmediate* im) {
+    JS_FreeValue(ctx, im->func);
+    im->func = JS_UNDEFINED;
+    for (IJS32 i = 0; i < im->argc; i++)
+        JS_FreeValue(ctx, im->argv[i]);
+    js_free(ctx, im->argv);
+    im->argv = NULL;
+    im->argc = 0;
+}
+
+/*
+ * Immediates are queued in a flat array and the whole array is swapped out and run
+ * as one batch from a shared check handle, so anything queued while a batch runs
+ * waits for the next loop iteration.
+ */
+static IJVoid uvImmediateCb(uv_check_t* handle) {
+    IJJSRuntime* qrt = handle->data;
+    CHECK_NOT_NULL(qrt);
+    JSContext* ctx = qrt->ctx;
+    IJU64 t0 = ijProfileBegin(qrt);
+    IJJSImmediateQueue batch = qrt->immediates.queue;
+    qrt->immediates.queue = qrt->immediates.batch;
+    qrt->immediates.batch = batch;
+    for (; qrt->immediates.batch.pos < qrt->immediates.batch.count; qrt->immediates.batch.pos++) {
+        IJJSImmediate* im = &qrt->immediates.batch.items[qrt->immediates.batch.pos];
+        if (JS_IsUndefined(im->func))
+            continue;
+        /* taken out of the entry first, the callback may clear its own immediate */
+        IJJSImmediate run = *im;
+        im->func = JS_UNDEFINED;
+        im->argc = 0;
+        im->argv = NULL;
+        JSValue ret = JS_Call(ctx, run.func, JS_UNDEFINED, run.argc, (JSValueConst*)run.argv);
+        if (JS_IsException(ret))
+            ijDumpError(ctx);
+        JS_FreeValue(ctx, ret);
+        ijClearImmediateEntry(ctx, &run);
+        ijExecuteJobs(ctx);
+    }
+    qrt->immediates.batch.count = 0;
+    qrt->immediates.batch.pos = 0;
+    if (qrt->immediates.queue.count == 0)
+        uv_check_stop(handle);
+    ijProfileEnd(qrt, IJJS_PHASE_IMMEDIATES, t0);
+}
+
+static JSValue ijSetImmediate(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    JSValueConst func = argv[0];
+    if (!JS_IsFunction(ctx, func))
+        return JS_ThrowTypeError(ctx, "not a function");
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    CHECK_NOT_NULL(qrt);
+    IJJSImmediateQueue* q = &qrt->immediates.queue;
+    if (q->count == q->size) {
+        IJU32 size = q->size ? q->size * 2 : 64;
+        IJJSImmediate* items = js_realloc(ctx, q->items, size * sizeof(*items));
+        if (!items)
+            return JS_EXCEPTION;
+        q->items = items;
+        q->size = size;
+    }
+    IJJSImmediate* im = &q->items[q->count];
+    im->argc = argc > 1 ? argc - 1 : 0;
+    im->argv = NULL;
+    if (im->argc) {
+        im->argv = js_malloc(ctx, im->argc * sizeof(JSValue));
+        if (!im->argv)
+            return JS_EXCEPTION;
+        for (IJS32 i = 0; i < im->argc; i++)
+            im->argv[i] = JS_DupValue(ctx, argv[i + 1]);
+    }
+    im->func = JS_DupValue(ctx, func);
+    im->id = ++qrt->immediates.next_id;
+    if (q->count++ == 0)
+        CHECK_EQ(uv_check_start(&qrt->immediates.check, uvImmediateCb), 0);
+    return JS_NewInt64(ctx, im->id);
+}
+
+static IJJSImmediate* ijFindImmediate(IJJSImmediate* items, IJU32 lo, IJU32 hi, IJS64 id) {
+    while (lo < hi) {
+        IJU32 mid = lo + (hi - lo) / 2;
+        if (items[mid].id < id)
+            lo = mid + 1;
+        else if (items[mid].id > id)
+            hi = mid;
+        else
+            return &items[mid];
+    }
+    return NULL;
+}
+
+static JSValue ijClearImmediate(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    IJS64 id;
+    if (JS_IsUndefined(argv[0]) || JS_ToInt64(ctx, &id, argv[0]))
+        return JS_UNDEFINED;
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    CHECK_NOT_NULL(qrt);
+    /* both arrays are sorted by id since immediates are only ever appended */
+    IJJSImmediate* im = ijFindImmediate(qrt->immediates.batch.items, qrt->immediates.batch.pos, qrt->immediates.batch.count, id);
+    if (!im)
+        im = ijFindImmediate(qrt->immediates.queue.items, 0, qrt->immediates.queue.count, id);
+    if (im)
+        ijClearImmediateEntry(ctx, im);
+    return JS_UNDEFINED;
+}
+
+static JSValue ijMicrotaskJob(JSContext* ctx, IJS32 argc, JSValueConst* argv) {
+    JSValue ret = JS_Call(ctx, argv[0], JS_UNDEFINED, 0, NULL);
+    if (JS_IsException(ret))
+        return ret;
+    JS_FreeValue(ctx, ret);
+    return JS_UNDEFINED;
+}
+
+static JSValue ijQueueMicrotask(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
+    if (!JS_IsFunction(ctx, argv[0]))
+        return JS_ThrowTypeError(ctx, "not a function");
+    if (JS_EnqueueJob(ctx, ijMicrotaskJob, 1, argv))
+        return JS_EXCEPTION;
+    return JS_UNDEFINED;
+}
+
+static const JSCFunctionListEntry ijjs_timer_proto_funcs[] = {
+    JS_CFUNC_MAGIC_DEF("ref", 0, ijTimerRef, 0),
+    JS_CFUNC_MAGIC_DEF("unref", 0, ijTimerRef, 1),
+    JS_CFUNC_DEF("hasRef", 0, ijTimerHasRef),
+    JS_CFUNC_DEF("refresh", 0, ijTimerRefresh),
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "Timer", JS_PROP_CONFIGURABLE),
+};
+
 static const JSCFunctionListEntry ijjs_timer_funcs[] = {
     JS_CFUNC_MAGIC_DEF("setTimeout", 2, ijSetTimeout, 0),
     JS_CFUNC_DEF("clearTimeout", 1, ijClearTimeout),
     JS_CFUNC_MAGIC_DEF("setInterval", 2, ijSetTimeout, 1),
     JS_CFUNC_DEF("clearInterval", 1, ijClearTimeout),
+    JS_CFUNC_DEF("setImmediate", 1, ijSetImmediate),
+    JS_CFUNC_DEF("clearImmediate", 1, ijClearImmediate),
+    JS_CFUNC_DEF("queueMicrotask", 1, ijQueueMicrotask),
     JS_PROP_STRING_DEF("[Symbol.toStringTag]", "Timer", JS_PROP_CONFIGURABLE),
 };
 
 IJVoid ijModTimersInit(JSContext* ctx, JSModuleDef* m) {
     JS_NewClassID(&ijjs_timer_class_id);
     JS_NewClass(JS_GetRuntime(ctx), ijjs_timer_class_id, &ijjs_timer_class);
+    JSValue proto = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, proto, ijjs_timer_proto_funcs, countof(ijjs_timer_proto_funcs));
+    JS_SetClassProto(ctx, ijjs_timer_class_id, proto);
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    CHECK_EQ(uv_timer_init(&qrt->loop, &qrt->timers.handle), 0);
+    qrt->timers.handle.data = qrt;
+    uv_unref((uv_handle_t*)&qrt->timers.handle);
+    qrt->timers.now = uv_now(&qrt->loop);
+    qrt->timers.due = UINT64_MAX;
+    qrt->timers.refs = 0;
+    for (IJS32 i = 0; i < IJJS_TIMER_LEVELS; i++) {
+        qrt->timers.pending[i] = 0;
+        for (IJS32 j = 0; j < IJJS_TIMER_SLOTS; j++)
+            init_list_head(&qrt->timers.slots[i][j]);
+    }
+    CHECK_EQ(uv_check_init(&qrt->loop, &qrt->immediates.check), 0);
+    qrt->immediates.check.data = qrt;
     JS_SetModuleExportList(ctx, m, ijjs_timer_funcs, countof(ijjs_timer_funcs));
 }
 
 IJVoid ijModTimersExport(JSContext* ctx, JSModuleDef* m) {
     JS_AddModuleExportList(ctx, m, ijjs_timer_funcs, countof(ijjs_timer_funcs));
 }
+
+/* immediates still queued when the runtime goes away never run */
+IJVoid ijTimersShutdown(JSContext* ctx) {
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    IJJSImmediateQueue* queues[] = { &qrt->immediates.queue, &qrt->immediates.batch };
+    for (IJU32 i = 0; i < countof(queues); i++) {
+        for (IJU32 j = 0; j < queues[i]->count; j++)
+            ijClearImmediateEntry(ctx, &queues[i]->items[j]);
+        js_free(ctx, queues[i]->items);
+        memset(queues[i], 0, sizeof(*queues[i]));
+    }
+}
@@ -109,6 +109,7 @@ static IJVoid uvUdpRecvCb(uv_udp_t* handle, ssize_t nread, const uv_buf_t* buf,
     }
     uv_udp_recv_stop(handle);
     JSContext* ctx = u->ctx;
+    IJU64 t0 = ijProfileBegin(ijGetRuntime(ctx));
     JSValue arg;
     IJS32 is_reject = 0;
     if (nread < 0) {
@@ -123,6 +124,7 @@ static IJVoid uvUdpRecvCb(uv_udp_t* handle, ssize_t nread, const uv_buf_t* buf,
     }
     ijSettlePromise(ctx, &u->read.result, is_reject, 1, (JSValueConst*)&arg);
     ijClearPromise(ctx, &u->read.result);
+    ijProfileEnd(ijGetRuntime(ctx), IJJS_PHASE_IO, t0);
 }
 
 static JSValue ijUdpRecv(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
@@ -145,6 +147,7 @@ static IJVoid uvUdpSendCb(uv_udp_send_t* req, IJS32 status) {
     IJJSUdp* u = req->handle->data;
     CHECK_NOT_NULL(u);
     JSContext* ctx = u->ctx;
+    IJU64 t0 = ijProfileBegin(ijGetRuntime(ctx));
     IJJSSendReq* sr = req->data;
     IJS32 is_reject = 0;
     JSValue arg;
@@ -156,6 +159,7 @@ static IJVoid uvUdpSendCb(uv_udp_send_t* req, IJS32 status) {
     }
     ijSettlePromise(ctx, &sr->result, is_reject, 1, (JSValueConst*)&arg);
     js_free(ctx, sr);
+    ijProfileEnd(ijGetRuntime(ctx), IJJS_PHASE_IO, t0);
 }
 
 static JSValue ijUdpSend(JSContext* ctx, JSValueConst this_val, IJS32 argc, JSValueConst* argv) {
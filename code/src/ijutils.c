@@ -21,6 +21,7 @@
 #include "ijjs.h"
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include <curl/curl.h>
 
 
@@ -252,6 +253,33 @@ JSValue ijNewUint8Array(JSContext* ctx, IJU8* data, size_t size) {
     return buf;
 }
 
+static uv_once_t diag__init_once = UV_ONCE_INIT;
+static uv_mutex_t diag__seq_mutex;
+static IJU32 diag__seq = 0;
+
+static IJVoid ijDiagnosticInitOnce(IJVoid) {
+    CHECK_EQ(uv_mutex_init(&diag__seq_mutex), 0);
+}
+
+/* <dir>/<prefix>.<date>.<time>.<pid>.<seq>, the caller appends the extension */
+IJS32 ijDiagnosticFilename(IJAnsi* buf, size_t size, const IJAnsi* dir, const IJAnsi* prefix) {
+    IJAnsi stamp[32];
+    time_t now = time(NULL);
+    struct tm tm;
+#if IJJS_PLATFORM == IJJS_PLATFORM_WIN32
+    localtime_s(&tm, &now);
+#else
+    localtime_r(&now, &tm);
+#endif
+    strftime(stamp, sizeof(stamp), "%Y%m%d.%H%M%S", &tm);
+    uv_once(&diag__init_once, ijDiagnosticInitOnce);
+    uv_mutex_lock(&diag__seq_mutex);
+    IJU32 seq = ++diag__seq;
+    uv_mutex_unlock(&diag__seq_mutex);
+    return snprintf(buf, size, "%s%s%s.%s.%d.%03u", dir ? dir : "", dir ? "/" : "",
+        prefix, stamp, (IJS32)uv_os_getpid(), seq);
+}
+
 static IJAnsi* je_strdup(IJAnsi* s)
 {
     IJAnsi* t = NULL;
@@ -351,8 +379,10 @@ static IJVoid uvPollCb(uv_poll_t* handle, IJS32 status, IJS32 events) {
     if (events & UV_WRITABLE)
         flags |= CURL_CSELECT_OUT;
     IJS32 running_handles;
+    IJU64 t0 = ijProfileBegin(qrt);
     curl_multi_socket_action(qrt->curl_ctx.curlm_h, poll_ctx->sockfd, flags, &running_handles);
     ijCheckMultiInfo(qrt);
+    ijProfileEnd(qrt, IJJS_PHASE_CURL, t0);
 }
 
 static IJS32 ijCurlHandleSocket(CURL* easy, curl_socket_t s, IJS32 action, IJVoid* userp, IJVoid* socketp) {
@@ -401,8 +431,10 @@ static IJVoid uvTimerCb(uv_timer_t* handle) {
     IJJSRuntime* qrt = handle->data;
     CHECK_NOT_NULL(qrt);
     IJS32 running_handles;
+    IJU64 t0 = ijProfileBegin(qrt);
     curl_multi_socket_action(qrt->curl_ctx.curlm_h, CURL_SOCKET_TIMEOUT, 0, &running_handles);
     ijCheckMultiInfo(qrt);
+    ijProfileEnd(qrt, IJJS_PHASE_CURL, t0);
 }
 
 static IJS32 ijCurlStartTimeout(CURLM* multi, long timeout_ms, IJVoid* userp) {
@@ -35,6 +35,7 @@ extern const IJU32 repl_size;
 static IJS32 ijjs__argc = 0;
 static IJAnsi **ijjs__argv = NULL;
 static IJJSRuntime* ijjs__rt = NULL;
+static IJU64 ijjs__start = 0;
 
 
 
@@ -43,11 +44,17 @@ const IJAnsi* ijGetScriptPath(){
 }
 
 static IJS32 ijInit(JSContext* ctx, JSModuleDef* m) {
+    ijModAllocatorInit(ctx, m);
+    ijModCronInit(ctx, m);
     ijModDNSInit(ctx, m);
     ijModErrorInit(ctx, m);
     ijModFSInit(ctx, m);
+    ijModHeapInit(ctx, m);
+    ijModHrTimerInit(ctx, m);
+    ijModLoopProfInit(ctx, m);
     ijModMiscInit(ctx, m);
     ijModProcessInit(ctx, m);
+    ijModProfilerInit(ctx, m);
     ijModSignalsInit(ctx, m);
     ijModStdInit(ctx, m);
     ijModStreamsInit(ctx, m);
@@ -66,11 +73,17 @@ JSModuleDef* ijInitModuleUV(JSContext* ctx, const IJAnsi* name) {
     m = JS_NewCModule(ctx, name, ijInit);
     if (!m)
         return NULL;
+    ijModAllocatorExport(ctx, m);
+    ijModCronExport(ctx, m);
     ijModDNSExport(ctx, m);
     ijModErrorExport(ctx, m);
     ijModFSExport(ctx, m);
+    ijModHeapExport(ctx, m);
+    ijModHrTimerExport(ctx, m);
+    ijModLoopProfExport(ctx, m);
     ijModMiscExport(ctx, m);
     ijModProcessExport(ctx, m);
+    ijModProfilerExport(ctx, m);
     ijModStdExport(ctx, m);
     ijModStreamsExport(ctx, m);
     ijModSignalsExport(ctx, m);
@@ -137,7 +150,18 @@ static IJVoid uvStop(uv_async_t* handle) {
 IJVoid ijDefaultOptions(IJJSRunOptions* options) {
     static IJJSRunOptions default_options = {
         .abort_on_unhandled_rejection = false,
-        .stack_size = IJJS_DEFAULT_STACK_SIZE
+        .stack_size = IJJS_DEFAULT_STACK_SIZE,
+        .job_budget = 0,
+        .job_budget_us = 0,
+        .cpu_prof = false,
+        .cpu_prof_interval = 0,
+        .cpu_prof_dir = NULL,
+        .code_cache_dir = NULL,
+        .module_prefetch = true,
+        .http_cache_dir = NULL,
+        .offline = false,
+        .memory_limit = 0,
+        .gc_threshold = 0
     };
     memcpy(options, &default_options, sizeof(*options));
 }
@@ -152,10 +176,14 @@ IJJSRuntime* ijNewRuntimeOptions(IJJSRunOptions* options) {
     return ijNewRuntimeInternal(false, options);
 }
 
-IJJSRuntime* ijNewRuntimeWorker(IJVoid) {
-    IJJSRunOptions options;
-    ijDefaultOptions(&options);
-    return ijNewRuntimeInternal(true, &options);
+IJJSRuntime* ijNewRuntimeWorker(IJJSRunOptions* options) {
+    IJJSRunOptions defaults;
+    /* workers inherit the options of the runtime that spawned them */
+    if (!options) {
+        ijDefaultOptions(&defaults);
+        options = &defaults;
+    }
+    return ijNewRuntimeInternal(true, options);
 }
 #if defined(__APPLE__)
 #define JE_MALLOC_OVERHEAD  0
@@ -168,11 +196,12 @@ static inline size_t je_def_malloc_usable_size(void* ptr)
 }
 static IJVoid* je_def_malloc(JSMallocState* s, size_t size)
 {
+    IJJSRuntime* qrt = s->opaque;
     void* ptr;
     assert(size != 0);
     if (unlikely(s->malloc_size + size > s->malloc_limit))
         return NULL;
-    ptr = je_malloc(size);
+    ptr = je_mallocx(size, qrt->arena.flags);
     if (!ptr)
         return NULL;
     s->malloc_count++;
@@ -181,14 +210,16 @@ static IJVoid* je_def_malloc(JSMallocState* s, size_t size)
 }
 static IJVoid je_def_free(JSMallocState* s, IJVoid* ptr)
 {
+    IJJSRuntime* qrt = s->opaque;
     if (!ptr)
         return;
     s->malloc_count--;
     s->malloc_size -= je_def_malloc_usable_size(ptr) + JE_MALLOC_OVERHEAD;
-    je_free(ptr);
+    je_dallocx(ptr, qrt->arena.flags);
 }
 static IJVoid* je_def_realloc(JSMallocState* s, void* ptr, size_t size)
 {
+    IJJSRuntime* qrt = s->opaque;
     size_t old_size;
     if (!ptr) {
         if (size == 0)
@@ -199,38 +230,76 @@ static IJVoid* je_def_realloc(JSMallocState* s, void* ptr, size_t size)
     if (size == 0) {
         s->malloc_count--;
         s->malloc_size -= old_size + JE_MALLOC_OVERHEAD;
-        je_free(ptr);
+        je_dallocx(ptr, qrt->arena.flags);
         return NULL;
     }
     if (s->malloc_size + size - old_size > s->malloc_limit)
         return NULL;
-    ptr = je_realloc(ptr, size);
+    ptr = je_rallocx(ptr, size, qrt->arena.flags);
     if (!ptr)
         return NULL;
     s->malloc_size += je_def_malloc_usable_size(ptr) - old_size;
     return ptr;
 }
+/* every cycle is kept for performance entries and timed for the loop profiler */
+static IJVoid ijGCCallback(JSRuntime* rt, JS_BOOL done, IJVoid* opaque) {
+    IJJSRuntime* qrt = opaque;
+    if (!done) {
+        qrt->gc.start = uv_hrtime();
+        qrt->gc.start_size = JS_GetMallocSize(rt);
+        return;
+    }
+    IJU64 now = uv_hrtime();
+    size_t size = JS_GetMallocSize(rt);
+    /* the oldest entry makes room once the buffer is full */
+    IJJSGCEntry* entry = &qrt->gc.entries[(qrt->gc.head + qrt->gc.count) % IJJS_GC_ENTRIES];
+    if (qrt->gc.count < IJJS_GC_ENTRIES)
+        qrt->gc.count++;
+    else
+        qrt->gc.head = (qrt->gc.head + 1) % IJJS_GC_ENTRIES;
+    entry->start = qrt->gc.start;
+    entry->duration = now - qrt->gc.start;
+    entry->freed = qrt->gc.start_size > size ? qrt->gc.start_size - size : 0;
+    entry->heap_size = size;
+    if (qrt->profiler.enabled)
+        ijHistogramRecord(&qrt->profiler.phases[IJJS_PHASE_GC], entry->duration);
+}
+
 IJJSRuntime* ijNewRuntimeInternal(IJBool is_worker, IJJSRunOptions* options) {
+    IJU64 start = uv_hrtime();
     IJJSRuntime* qrt = je_calloc(1, sizeof(*qrt));
     memcpy(&qrt->options, options, sizeof(*options));
+    qrt->resolve = ijResolveCacheNew(NULL);
+    ijPrefetchInit(qrt);
+    /* the main runtime measures its startup from main() */
+    qrt->startup.origin = !is_worker && ijjs__start ? ijjs__start : start;
     JSMallocFunctions je_malloc_funcs = {
         je_def_malloc,
         je_def_free,
         je_def_realloc,
         je_def_malloc_usable_size
     };
-    qrt->rt = JS_NewRuntime2(&je_malloc_funcs, NULL);
+    /* every runtime gets its own arena and tcache so workers do not contend */
+    ijAllocatorAttach(qrt);
+    qrt->rt = JS_NewRuntime2(&je_malloc_funcs, qrt);
     CHECK_NOT_NULL(qrt->rt);
     qrt->ctx = JS_NewContext(qrt->rt);
     CHECK_NOT_NULL(qrt->ctx);
     JS_SetRuntimeOpaque(qrt->rt, qrt);
     JS_SetContextOpaque(qrt->ctx, qrt);
     JS_SetMaxStackSize(qrt->rt, options->stack_size);
+    /* 0 keeps the QuickJS defaults, no heap limit and a first collection at 256KB */
+    if (options->memory_limit)
+        JS_SetMemoryLimit(qrt->rt, options->memory_limit);
+    if (options->gc_threshold)
+        JS_SetGCThreshold(qrt->rt, options->gc_threshold);
+    JS_SetGCCallback(qrt->rt, ijGCCallback, qrt);
     JS_AddIntrinsicBigFloat(qrt->ctx);
     JS_AddIntrinsicBigDecimal(qrt->ctx);
     qrt->is_worker = is_worker;
     uv_replace_allocator(je_malloc, je_realloc, je_calloc, je_free);
     CHECK_EQ(uv_loop_init(&qrt->loop), 0);
+    CHECK_EQ(uv_loop_configure(&qrt->loop, UV_METRICS_IDLE_TIME), 0);
     CHECK_EQ(uv_prepare_init(&qrt->loop, &qrt->jobs.prepare), 0);
     qrt->jobs.prepare.data = qrt;
     CHECK_EQ(uv_idle_init(&qrt->loop, &qrt->jobs.idle), 0);
@@ -239,6 +308,7 @@ IJJSRuntime* ijNewRuntimeInternal(IJBool is_worker, IJJSRunOptions* options) {
     qrt->jobs.check.data = qrt;
     CHECK_EQ(uv_async_init(&qrt->loop, &qrt->stop, uvStop), 0);
     qrt->stop.data = qrt;
+    ijStartupMark(qrt, "runtime", start);
     JS_SetModuleLoaderFunc(qrt->rt, ijModuleNormalizer, ijModuleLoader, qrt);
     JS_SetHostPromiseRejectionTracker(qrt->rt, ijPromiseRejectionTracker, NULL);
     qrt->in_bootstrap = true;
@@ -251,22 +321,45 @@ IJJSRuntime* ijNewRuntimeInternal(IJBool is_worker, IJJSRunOptions* options) {
     qrt->builtins.u8array_ctor = JS_GetPropertyStr(qrt->ctx, global_obj, "Uint8Array");
     CHECK_EQ(JS_IsUndefined(qrt->builtins.u8array_ctor), 0);
     JS_FreeValue(qrt->ctx, global_obj);
+    if (options->cpu_prof)
+        CHECK_EQ(ijCpuProfilerStart(qrt, options->cpu_prof_interval), 0);
     ijjs__rt = qrt;
     return ijjs__rt;
 }
 IJVoid ijFreeRuntime(IJJSRuntime* qrt) {
+    ijCpuProfilerShutdown(qrt);
     uv_close((uv_handle_t*)&qrt->jobs.prepare, NULL);
     uv_close((uv_handle_t*)&qrt->jobs.idle, NULL);
     uv_close((uv_handle_t*)&qrt->jobs.check, NULL);
     uv_close((uv_handle_t*)&qrt->stop, NULL);
+    uv_close((uv_handle_t*)&qrt->timers.handle, NULL);
+    uv_close((uv_handle_t*)&qrt->immediates.check, NULL);
+    uv_close((uv_handle_t*)&qrt->cron.timer, NULL);
+    uv_close((uv_handle_t*)&qrt->hrtimers.timer, NULL);
+    uv_close((uv_handle_t*)&qrt->hrtimers.idle, NULL);
+    uv_close((uv_handle_t*)&qrt->profiler.dump, NULL);
+#if IJJS_PLATFORM == IJJS_PLATFORM_LINUX
+    if (qrt->hrtimers.fd >= 0) {
+        uv_close((uv_handle_t*)&qrt->hrtimers.poll, NULL);
+        close(qrt->hrtimers.fd);
+    }
+#endif
     JS_FreeValue(qrt->ctx, qrt->builtins.u8array_ctor);
+    ijModuleFreeJson(qrt);
+    ijTimersShutdown(qrt->ctx);
     JS_FreeContext(qrt->ctx);
     JS_FreeRuntime(qrt->rt);
+    ijPrefetchShutdown(qrt);
+    ijBundleClose(qrt);
+    ijResolveCacheRelease(qrt->resolve);
+    ijAllocatorDetach(qrt);
+    ijHttpModuleShutdown(qrt);
     if (qrt->curl_ctx.curlm_h) {
         curl_multi_cleanup(qrt->curl_ctx.curlm_h);
         uv_close((uv_handle_t*)&qrt->curl_ctx.timer, NULL);
     }
     m3_FreeEnvironment(qrt->wasm_ctx.env);
+    je_free(qrt->cron.heap);
     IJS32 closed = 0;
     for (IJS32 i = 0; i < 5; i++) {
         if (uv_loop_close(&qrt->loop) == 0) {
@@ -284,6 +377,7 @@ IJVoid ijFreeRuntime(IJJSRuntime* qrt) {
 }
 
 IJVoid ijSetupArgs(IJS32 argc, IJAnsi** argv) {
+    ijjs__start = uv_hrtime();
     ijjs__argc = argc;
     ijjs__argv = uv_setup_args(argc, argv);
     if (!ijjs__argv)
@@ -303,7 +397,7 @@ static IJVoid uvIdleCb(uv_idle_t* handle) {
 }
 
 static IJVoid uvMaybeIdle(IJJSRuntime* qrt) {
-    if (JS_IsJobPending(qrt->rt))
+    if (JS_IsJobPending(qrt->rt) || qrt->immediates.queue.count)
         CHECK_EQ(uv_idle_start(&qrt->jobs.idle, uvIdleCb), 0);
     else
         CHECK_EQ(uv_idle_stop(&qrt->jobs.idle), 0);
@@ -315,33 +409,126 @@ static IJVoid uvPrepareCb(uv_prepare_t* handle) {
     uvMaybeIdle(qrt);
 }
 
+static IJBool ijJobBudgetExhausted(IJJSRuntime* qrt) {
+    if (qrt->jobs.exhausted)
+        return true;
+    if ((qrt->options.job_budget && qrt->metrics.tick_jobs >= qrt->options.job_budget) ||
+        (qrt->options.job_budget_us && qrt->jobs.tick_start && uv_hrtime() - qrt->jobs.tick_start >= qrt->options.job_budget_us * 1000ULL)) {
+        qrt->jobs.exhausted = true;
+        qrt->metrics.budget_hits++;
+        return true;
+    }
+    return false;
+}
+
 IJVoid ijExecuteJobs(JSContext* ctx) {
     JSContext* ctx1;
     IJS32 err;
-    for (;;) {
+    IJJSRuntime* qrt = ijGetRuntime(ctx);
+    /* jobs left over once the per tick budget is spent keep the idle handle running,
+       so the loop polls for I/O without blocking before draining the rest */
+    while (JS_IsJobPending(qrt->rt) && !ijJobBudgetExhausted(qrt)) {
+        if (!qrt->jobs.tick_start && qrt->options.job_budget_us)
+            qrt->jobs.tick_start = uv_hrtime();
         err = JS_ExecutePendingJob(JS_GetRuntime(ctx), &ctx1);
         if (err <= 0) {
             if (err < 0)
                 ijDumpError(ctx1);
             break;
         }
+        qrt->metrics.tick_jobs++;
     }
 }
 
+static IJVoid ijLoopMetricsTick(IJJSRuntime* qrt) {
+    IJU64 now = uv_hrtime();
+    IJU64 idle = uv_metrics_idle_time(&qrt->loop);
+    /* lag is the busy part of the last iteration, time spent blocked in poll is not counted */
+    IJU64 busy = now - qrt->metrics.last_check;
+    IJU64 waited = idle - qrt->metrics.last_idle;
+    ijHistogramRecord(&qrt->metrics.lag, busy > waited ? busy - waited : 0);
+    qrt->metrics.last_check = now;
+    qrt->metrics.last_idle = idle;
+    qrt->metrics.ticks++;
+    qrt->metrics.jobs += qrt->metrics.tick_jobs;
+    if (qrt->metrics.tick_jobs > qrt->metrics.max_tick_jobs)
+        qrt->metrics.max_tick_jobs = qrt->metrics.tick_jobs;
+    qrt->metrics.tick_jobs = 0;
+    qrt->jobs.tick_start = 0;
+    qrt->jobs.exhausted = false;
+}
+
 static IJVoid uvCheckCb(uv_check_t* handle) {
     IJJSRuntime* qrt = handle->data;
     CHECK_NOT_NULL(qrt);
+    IJU64 t0 = ijProfileBegin(qrt);
     ijExecuteJobs(qrt->ctx);
+    ijProfileEnd(qrt, IJJS_PHASE_MICROTASKS, t0);
+    ijLoopMetricsTick(qrt);
     uvMaybeIdle(qrt);
 }
 
+/* log-linear buckets, 2^IJJS_HIST_SUB_BITS per power of two */
+static IJU32 ijHistogramIndex(IJU64 value) {
+    if (value < (1ULL << IJJS_HIST_SUB_BITS))
+        return (IJU32)value;
+    IJS32 msb = 63 - clz64(value);
+    IJS32 shift = msb - IJJS_HIST_SUB_BITS;
+    return ((shift + 1) << IJJS_HIST_SUB_BITS) + (IJU32)((value >> shift) & ((1ULL << IJJS_HIST_SUB_BITS) - 1));
+}
+
+static IJU64 ijHistogramBucketValue(IJU32 index) {
+    IJU32 sub = index & ((1U << IJJS_HIST_SUB_BITS) - 1);
+    IJS32 shift = (IJS32)(index >> IJJS_HIST_SUB_BITS) - 1;
+    if (shift < 0)
+        return sub;
+    return ((1ULL << IJJS_HIST_SUB_BITS) + sub) << shift;
+}
+
+IJVoid ijHistogramRecord(IJJSHistogram* h, IJU64 value) {
+    if (h->count == 0 || value < h->min)
+        h->min = value;
+    if (value > h->max)
+        h->max = value;
+    h->count++;
+    h->sum += (IJF64)value;
+    h->buckets[ijHistogramIndex(value)]++;
+}
+
+IJU64 ijHistogramPercentile(IJJSHistogram* h, IJF64 percentile) {
+    if (h->count == 0)
+        return 0;
+    IJU64 rank = (IJU64)(percentile / 100 * h->count + 0.5);
+    IJU64 seen = 0;
+    if (rank < 1)
+        rank = 1;
+    for (IJU32 i = 0; i < IJJS_HIST_BUCKETS; i++) {
+        seen += h->buckets[i];
+        if (seen >= rank) {
+            /* report the highest value the bucket can hold, like HDR histograms do */
+            IJU64 v = i + 1 < IJJS_HIST_BUCKETS ? ijHistogramBucketValue(i + 1) - 1 : h->max;
+            return v < h->min ? h->min : v > h->max ? h->max : v;
+        }
+    }
+    return h->max;
+}
+
+IJVoid ijHistogramReset(IJJSHistogram* h) {
+    memset(h, 0, sizeof(*h));
+}
+
 IJVoid ijRun(IJJSRuntime* qrt) {
+    qrt->metrics.start = uv_hrtime();
+    qrt->metrics.last_check = qrt->metrics.start;
+    qrt->metrics.last_idle = uv_metrics_idle_time(&qrt->loop);
     CHECK_EQ(uv_prepare_start(&qrt->jobs.prepare, uvPrepareCb), 0);
     uv_unref((uv_handle_t*)&qrt->jobs.prepare);
     CHECK_EQ(uv_check_start(&qrt->jobs.check, uvCheckCb), 0);
     uv_unref((uv_handle_t*)&qrt->jobs.check);
     if (!qrt->is_worker)
         uv_unref((uv_handle_t *) &qrt->stop);
+    /* jobs queued while evaluating the entry script run before the first timer */
+    ijExecuteJobs(qrt->ctx);
     uvMaybeIdle(qrt);
     uv_run(&qrt->loop, UV_RUN_DEFAULT);
 }
@@ -377,31 +564,79 @@ IJS32 ijLoadFile(JSContext* ctx, DynBuf* dbuf, const IJAnsi* filename) {
         if (r != 0)
             break;
     } while (1);
+    uv_fs_close(NULL, &req, fd, NULL);
+    uv_fs_req_cleanup(&req);
     return r;
 }
 
+static IJVoid ijEmitWindowLoad(JSContext* ctx) {
+    static IJAnsi emit_window_load[] = "window.dispatchEvent(new Event('load'));";
+    JSValue ret = JS_Eval(ctx, emit_window_load, strlen(emit_window_load), "<global>", JS_EVAL_TYPE_GLOBAL);
+    if (JS_IsException(ret))
+        ijDumpError(ctx);
+    JS_FreeValue(ctx, ret);
+}
+
 JSValue ijEvalFile(JSContext* ctx, const IJAnsi* filename, IJS32 flags, IJBool is_main, IJAnsi* override_filename) {
     DynBuf dbuf;
     IJS32 r, eval_flags;
-    JSValue ret;
-    dbuf_init(&dbuf);
-    r = ijLoadFile(ctx, &dbuf, filename);
-    if (r != 0) {
-        dbuf_free(&dbuf);
-        JS_ThrowReferenceError(ctx, "could not load '%s'", filename);
-        return JS_EXCEPTION;
+    JSValue ret = JS_UNDEFINED;
+    /* a worker entry of a packaged app was compiled into the bundle under the name it is started with */
+    if (ijBundleFind(ijGetRuntime(ctx), filename) >= 0) {
+        ret = ijBundleLoadModule(ctx, filename);
+        if (JS_IsException(ret) || JS_ResolveModule(ctx, ret) < 0)
+            return JS_EXCEPTION;
+        ret = JS_EvalFunction(ctx, ret);
+        if (!JS_IsException(ret) && is_main)
+            ijEmitWindowLoad(ctx);
+        return ret;
     }
-    dbuf_putc(&dbuf, '\0');
-    if (flags == -1) {
-        if (JS_DetectModule((const IJAnsi*)dbuf.buf, dbuf.size))
-            eval_flags = JS_EVAL_TYPE_MODULE;
-        else
-            eval_flags = JS_EVAL_TYPE_GLOBAL;
+    dbuf_init(&dbuf);
+    /* only modules go through the code cache, scripts are always compiled */
+    IJBool cacheable = !override_filename && (flags == -1 || (flags & JS_EVAL_TYPE_MASK) == JS_EVAL_TYPE_MODULE);
+    if (cacheable)
+        ret = ijCodeCacheLoad(ctx, filename, &dbuf);
+    if (!JS_IsUndefined(ret)) {
+        /* JS_Eval resolves the imports while compiling, cached bytecode has to do it here */
+        if (JS_ResolveModule(ctx, ret) < 0) {
+            dbuf_free(&dbuf);
+            return JS_EXCEPTION;
+        }
+        eval_flags = flags == -1 ? JS_EVAL_TYPE_MODULE : flags;
     } else {
-        eval_flags = flags;
+        if (dbuf.size == 0) {
+            r = ijLoadFile(ctx, &dbuf, filename);
+            if (r != 0) {
+                dbuf_free(&dbuf);
+                JS_ThrowReferenceError(ctx, "could not load '%s'", filename);
+                return JS_EXCEPTION;
+            }
+        }
+        if (ijBundleDetect(dbuf.buf, dbuf.size)) {
+            r = ijBundleAttach(ctx, dbuf.buf, dbuf.size, TRUE);
+            if (r == 0)
+                dbuf_init(&dbuf);
+            dbuf_free(&dbuf);
+            return r == 0 ? ijEvalBundle(ctx, is_main) : JS_EXCEPTION;
+        }
+        dbuf_putc(&dbuf, '\0');
+        if (flags == -1) {
+            if (JS_DetectModule((const IJAnsi*)dbuf.buf, dbuf.size))
+                eval_flags = JS_EVAL_TYPE_MODULE;
+            else
+                eval_flags = JS_EVAL_TYPE_GLOBAL;
+        } else {
+            eval_flags = flags;
+        }
     }
     if ((eval_flags & JS_EVAL_TYPE_MASK) == JS_EVAL_TYPE_MODULE) {
-        ret = JS_Eval(ctx, (IJAnsi*)dbuf.buf, dbuf.size, override_filename != NULL ? override_filename : filename, eval_flags | JS_EVAL_FLAG_COMPILE_ONLY);
+        if (JS_IsUndefined(ret)) {
+            /* its imports are read on the thread pool while this file compiles */
+            ijPrefetchImports(ctx, filename, &dbuf);
+            ret = JS_Eval(ctx, (IJAnsi*)dbuf.buf, dbuf.size, override_filename != NULL ? override_filename : filename, eval_flags | JS_EVAL_FLAG_COMPILE_ONLY);
+            if (!JS_IsException(ret) && cacheable)
+                ijCodeCacheStore(ctx, filename, ret, &dbuf);
+        }
         if (!JS_IsException(ret)) {
             ijModuleSetImportMeta(ctx, ret, TRUE, is_main);
             ret = JS_EvalFunction(ctx, ret);
@@ -409,13 +644,20 @@ JSValue ijEvalFile(JSContext* ctx, const IJAnsi* filename, IJS32 flags, IJBool i
     } else {
         ret = JS_Eval(ctx, (IJAnsi*)dbuf.buf, dbuf.size, override_filename != NULL ? override_filename : filename, eval_flags);
     }
-    if (!JS_IsException(ret) && is_main) {
-        static IJAnsi emit_window_load[] = "window.dispatchEvent(new Event('load'));";
-        JSValue ret1 = JS_Eval(ctx, emit_window_load, strlen(emit_window_load), "<global>", JS_EVAL_TYPE_GLOBAL);
-        if (JS_IsException(ret1)) {
-            ijDumpError(ctx);
-        }
-    }
+    if (!JS_IsException(ret) && is_main)
+        ijEmitWindowLoad(ctx);
     dbuf_free(&dbuf);
     return ret;
+}
+
+JSValue ijEvalBundle(JSContext* ctx, IJBool is_main) {
+    JSValue ret = ijBundleEntry(ctx);
+    if (JS_IsException(ret))
+        return ret;
+    /* the entry keeps the name it was compiled with, that file need not exist here */
+    ijModuleSetImportMeta(ctx, ret, FALSE, is_main);
+    ret = JS_EvalFunction(ctx, ret);
+    if (!JS_IsException(ret) && is_main)
+        ijEmitWindowLoad(ctx);
+    return ret;
 }
\ No newline at end of file
@@ -40,6 +40,8 @@ typedef struct {
     const IJAnsi* path;
     uv_os_sock_t channel_fd;
     uv_sem_t* sem;
+    IJJSRunOptions* options;
+    struct IJJSResolveCache* resolve;
     IJJSRuntime* wrt;
 } IJJSWorkerData;
 
@@ -92,15 +94,27 @@ error:
 
 static IJVoid ijWorkerEntry(IJVoid* arg) {
     IJJSWorkerData* wd = arg;
-    IJJSRuntime* wrt = ijNewRuntimeWorker();
+    IJJSRuntime* wrt = ijNewRuntimeWorker(wd->options);
     CHECK_NOT_NULL(wrt);
+    /* files the spawning runtime already resolved are not probed again */
+    ijResolveCacheRelease(wrt->resolve);
+    wrt->resolve = ijResolveCacheNew(wd->resolve);
     JSContext* ctx = ijGetJSContext(wrt);
+    /* the runtime was created in a deeper frame than the one the worker runs JS from */
+    JS_UpdateStackTop(JS_GetRuntime(ctx));
+    /* a packaged app starts its workers from the bundle it carries */
+    size_t bundle_size = 0;
+    const IJU8* bundle = ijBundleEmbedded(&bundle_size);
+    if (bundle && ijBundleAttach(ctx, bundle, bundle_size, FALSE))
+        ijDumpError(ctx);
     wrt->in_bootstrap = true;
     JSValue global_obj = JS_GetGlobalObject(ctx);
     JSValue worker_obj = ijNewWorker(ctx, wd->channel_fd, false);
     JS_SetPropertyStr(ctx, global_obj, "workerThis", worker_obj);
     JS_FreeValue(ctx, global_obj);
+    IJU64 start = uv_hrtime();
     CHECK_EQ(0, ijEvalBinary(ctx, worker_bootstrap, worker_bootstrap_size));
+    ijStartupMark(wrt, "worker-bootstrap", start);
     wrt->in_bootstrap = false;
     JSValue filename = JS_NewString(ctx, wd->path);
     CHECK_EQ(JS_EnqueueJob(ctx, ijWorkerEval, 1, (JSValueConst *) &filename), 0);
@@ -186,10 +200,12 @@ static IJVoid uvReadCb(uv_stream_t* handle, ssize_t nread, const uv_buf_t* buf)
         }
         return;
     }
+    IJU64 t0 = ijProfileBegin(ijGetRuntime(ctx));
     JSValue obj = JS_ReadObject(ctx, (const IJU8*)buf->base, buf->len, 0);
     ijMaybeEmitEvent(w, WORKER_EVENT_MESSAGE, obj);
     JS_FreeValue(ctx, obj);
     js_free(ctx, buf->base);
+    ijProfileEnd(ijGetRuntime(ctx), IJJS_PHASE_IO, t0);
 }
 
 static JSValue ijNewWorker(JSContext* ctx, uv_os_sock_t channel_fd, IJBool is_main) {
@@ -288,7 +304,7 @@ static JSValue ijWorkerConstructor(JSContext* ctx, JSValueConst new_target, IJS3
     IJJSWorker* w = ijWorkerGet(ctx, obj);
     uv_sem_t sem;
     CHECK_EQ(uv_sem_init(&sem, 0), 0);
-    IJJSWorkerData worker_data = { .channel_fd = fds[1], .path = path, .sem = &sem, .wrt = NULL };
+    IJJSWorkerData worker_data = { .channel_fd = fds[1], .path = path, .sem = &sem, .options = &ijGetRuntime(ctx)->options, .resolve = ijGetRuntime(ctx)->resolve, .wrt = NULL };
     CHECK_EQ(uv_thread_create(&w->tid, ijWorkerEntry, (IJVoid*)&worker_data), 0);
     uv_sem_wait(&sem);
     uv_sem_destroy(&sem);
@@ -1,7 +1,15 @@
 // Type definitions for ijjs
 // Project: https://github.com/MarilynDafa/ijjs
 
-type Timer = Object;
+interface Timer {
+    /** Keep the event loop alive while this timer is pending (the default) */
+    ref():Timer;
+    /** Let the event loop exit even though this timer is pending */
+    unref():Timer;
+    hasRef():boolean;
+    /** Re-arm the timer with its original delay, counted from now */
+    refresh():Timer;
+}
 
 interface Event {
     /**
@@ -285,6 +293,7 @@ interface PerformanceEntry {
     readonly entryType: string;
     readonly name: string;
     readonly startTime: number;
+    readonly detail?: any;
     toJSON(): any;
 }
 declare var PerformanceEntry: {
@@ -292,6 +301,24 @@ declare var PerformanceEntry: {
     new(): PerformanceEntry;
 };
 
+interface EventLoopUtilization {
+    readonly idle: number;
+    readonly active: number;
+    readonly utilization: number;
+    readonly ticks: number;
+    readonly jobs: number;
+    readonly jobsPerTick: number;
+}
+
+interface EventLoopLag {
+    readonly count: number;
+    readonly min: number;
+    readonly max: number;
+    readonly mean: number;
+    readonly p50: number;
+    readonly p99: number;
+}
+
 interface Performance extends EventTarget {
     readonly timeOrigin: number;
     now(): number;
@@ -301,6 +328,12 @@ interface Performance extends EventTarget {
     getEntriesByName(name: string): PerformanceEntry[];
     clearMarks(markName?: string): void;
     clearMeasures(measureName?: string): void;
+    /**
+     * drops the 'gc' entries, each one is a collection with detail {freed, heapSize} in bytes
+     */
+    clearGC(): void;
+    eventLoopUtilization(util1?: EventLoopUtilization, util2?: EventLoopUtilization): EventLoopUtilization;
+    eventLoopLag(reset?: boolean): EventLoopLag;
 }
 declare var Performance: {
     prototype: Performance;
@@ -1566,6 +1599,9 @@ declare function setTimeout(handler: string | Function, timeout?: number, ...arg
 declare function clearTimeout(timeoutId: Timer): void;
 declare function setInterval(handler: string | Function, timeout?: number, ...arguments: any[]): Timer;
 declare function clearInterval(intervalId: Timer): void;
+declare function setImmediate(handler: Function, ...arguments: any[]): number;
+declare function clearImmediate(immediateId: number): void;
+declare function queueMicrotask(callback: Function): void;
 declare function alert(...args: any[]): void;
 declare function fetch(input: Request | string, init?: RequestInit): Promise<Response>;
 
@@ -168,6 +168,45 @@ declare namespace ijjs {
      * KCP
      */
 
+    interface KCPOptions {
+        nodelay?:number;
+        interval?:number;
+        resend?:number;
+        nc?:number;
+        sndwnd?:number;
+        rcvwnd?:number;
+        mtu?:number;
+        minrto?:number;
+        /** Reed-Solomon FEC group size, both peers must use the same values, 0 disables it */
+        dataShards?:number;
+        parityShards?:number;
+    }
+
+    interface KCPStats {
+        rtt:number;
+        rttvar:number;
+        rto:number;
+        minrto:number;
+        retransmits:number;
+        sndQueue:number;
+        rcvQueue:number;
+        rcvBuffer:number;
+        inflight:number;
+        waitsnd:number;
+        sndwnd:number;
+        rcvwnd:number;
+        rmtwnd:number;
+        cwnd:number;
+        mtu:number;
+        dataShards:number;
+        parityShards:number;
+        fecRecovered:number;
+        rxBytes:number;
+        rxPackets:number;
+        txBytes:number;
+        txPackets:number;
+    }
+
     interface KCP {
         readonly IPV6ONLY:number;
         readonly PARTIAL:number;
@@ -178,12 +217,14 @@ declare namespace ijjs {
         getpeername():Addr;
         connect(addr:Addr):void;
         bind(addr:Addr, flags?:number):void;
-        send(data:string|ArrayBuffer|number, addr?:Addr):Promise<Exception>;
+        send(data:string|ArrayBuffer|Uint8Array, addr?:Addr):Promise<void>;
         recv(size?:number):Promise<{data:Uint8Array, flags:number, addr:Addr}>;
         getconv():number;
         nodelay(nodelay:number, interval:number, resend:number, nc:number):void;
         setwndsize(sndwnd:number, rcvwnd:number):void;
         setmtu(mtu:number):void;
+        setOptions(options:KCPOptions):void;
+        stats():KCPStats;
     }
     
     interface KCPConstructor {
@@ -295,6 +336,113 @@ declare namespace ijjs {
         getaddrinfo(node:string, opts?:AddrHint):Promise<AddrInfo>;
     }  
 
+
+    /**
+     * process wide jemalloc statistics and tuning, sizes are in bytes
+     */
+    interface AllocatorArenaStats {
+        index:number;
+        threads:number;
+        allocated:number;
+        active:number;
+        dirty:number;
+        muzzy:number;
+        resident:number;
+        mapped:number;
+        retained:number;
+    }
+
+    interface AllocatorStats {
+        allocated:number;
+        active:number;
+        metadata:number;
+        resident:number;
+        mapped:number;
+        retained:number;
+        dirtyDecayMs:number;
+        muzzyDecayMs:number;
+        backgroundThread:boolean;
+        arenas:AllocatorArenaStats[];
+    }
+
+    export const allocator: {
+        stats():AllocatorStats;
+        setDecay(dirtyMs?:number, muzzyMs?:number):void;
+        backgroundThread(enable?:boolean):boolean;
+        purge():void;
+    }
+
+    /**
+     * cron
+     */
+    interface CronJob {
+        start():CronJob;
+        stop():CronJob;
+        next():number|null;
+    }
+
+    interface CronJobConstructor {
+        new(expression:string, func:()=>void, utcOffset?:number): CronJob;
+    }
+
+    export const cron: {
+        validate(expression:string):boolean;
+        Job:CronJobConstructor;
+    }
+
+    /**
+     * per phase event loop profiler, times are in milliseconds
+     */
+    interface LoopPhaseStats {
+        count:number;
+        total:number;
+        min:number;
+        max:number;
+        p50:number;
+        p90:number;
+        p99:number;
+    }
+
+    interface LoopProfile {
+        enabled:boolean;
+        elapsed:number;
+        timers:LoopPhaseStats;
+        immediates:LoopPhaseStats;
+        io:LoopPhaseStats;
+        fs:LoopPhaseStats;
+        curl:LoopPhaseStats;
+        microtasks:LoopPhaseStats;
+        gc:LoopPhaseStats;
+    }
+
+    export const loopProfiler: {
+        start(dumpIntervalMs?:number):void;
+        stop():void;
+        snapshot(reset?:boolean):LoopProfile;
+    }
+
+    /**
+     * sampling cpu profiler, the result loads in Chrome DevTools and flamegraph.pl
+     */
+    interface CpuProfileNode {
+        id:number;
+        callFrame:{ functionName:string; scriptId:string; url:string; lineNumber:number; columnNumber:number; };
+        hitCount:number;
+        children:number[];
+    }
+
+    interface CpuProfile {
+        nodes:CpuProfileNode[];
+        startTime:number;
+        endTime:number;
+        samples:number[];
+        timeDeltas:number[];
+    }
+
+    export const profiler: {
+        start(intervalUs?:number):void;
+        stop():{ cpuprofile:CpuProfile; folded:string; };
+    }
     
     /**
      * advance persistence log
@@ -462,6 +610,39 @@ declare namespace ijjs {
      * run Garbage Collector
      */
     export function gc(): null;
+    /**
+     * memory used by this runtime, sizes are in bytes
+     */
+    interface MemoryUsageEntry {
+        count:number;
+        size:number;
+    }
+
+    interface MemoryUsage {
+        rss:number;
+        heapUsed:number;
+        mallocSize:number;
+        mallocCount:number;
+        mallocLimit:number;
+        /** jemalloc arena owned by this runtime, -1 when it shares the automatic ones */
+        arena:number;
+        arenaAllocated:number;
+        atoms:MemoryUsageEntry;
+        strings:MemoryUsageEntry;
+        objects:MemoryUsageEntry;
+        properties:MemoryUsageEntry;
+        shapes:MemoryUsageEntry;
+        bytecode:MemoryUsageEntry & { codeSize:number; lineTableSize:number; };
+        cFunctions:number;
+        arrays:{ count:number; fastCount:number; fastElements:number; };
+        typedArrays:MemoryUsageEntry;
+    }
+
+    export function memoryUsage(): MemoryUsage;
+    /**
+     * write a V8 compatible .heapsnapshot of this runtime, returns its path
+     */
+    export function writeHeapSnapshot(filename?: string): string;
     /**
      * get env value
      */
@@ -482,6 +663,43 @@ declare namespace ijjs {
      * high resolution time function
      */
     export function hrtime():bigInt;
+    /**
+     * event loop idle/active time, jobs and per tick lag in milliseconds
+     */
+    export function loopMetrics(reset?:boolean): {idle:number, active:number, ticks:number, jobs:number, maxJobsPerTick:number, budgetHits:number, lag:EventLoopLag};
+    /**
+     * startup phases and builtin modules, in milliseconds since the process or worker started
+     */
+    export function startupTimings(): {name:string, startTime:number, duration:number}[];
+    /**
+     * collections since the last call, startTime is hrtime() in milliseconds, sizes are in bytes
+     */
+    export function gcEntries(): {startTime:number, duration:number, freed:number, heapSize:number}[];
+    /**
+     * cap the promise jobs run per loop iteration, by count and/or microseconds, 0 means unlimited
+     */
+    export function setJobBudget(count:number, microseconds?:number): void;
+    /**
+     * high resolution interval, jitter figures are in microseconds
+     */
+    interface HighResTimerStats {
+        interval:number;
+        ticks:number;
+        missed:number;
+        jitterMin:number;
+        jitterMax:number;
+        jitterMean:number;
+        jitterStdDev:number;
+    }
+
+    interface HighResTimer {
+        stats():HighResTimerStats;
+    }
+    /**
+     * run func every `microseconds` against absolute deadlines
+     */
+    export function setHighResInterval(func:()=>void, microseconds:number): HighResTimer;
+    export function clearHighResInterval(timer:HighResTimer): void;
     /**
      * get writable dir
      */
@@ -0,0 +1,125 @@
+// KCP over a lossy loopback link, with and without FEC.
+//
+// usage: ijjs kcp-fec.js [dropRate] [messages] [dataShards] [parityShards]
+//
+
+const [ dropRate = 0.1, messages = 300, dataShards = 10, parityShards = 3 ] = ijjs.args.slice(2).map(Number);
+const INTERVAL = 10;
+const TIMEOUT = 30 * 1000;
+
+function sleep(ms) {
+    return new Promise(resolve => setTimeout(resolve, ms));
+}
+
+async function forward(from, to, getTarget, onRecv) {
+    while (true) {
+        const rinfo = await from.recv();
+        if (!rinfo.data) {
+            break;
+        }
+        onRecv && onRecv(rinfo);
+        const target = getTarget();
+        if (target && Math.random() >= dropRate) {
+            to.send(rinfo.data, target);
+        }
+    }
+}
+
+// Sits between client and server and drops datagrams in both directions.
+function startRelay(serverAddr) {
+    const front = new ijjs.UDP();
+    const back = new ijjs.UDP();
+    let peer;
+    front.bind({ ip: '127.0.0.1' });
+    back.bind({ ip: '127.0.0.1' });
+    forward(front, back, () => serverAddr, rinfo => { peer = rinfo.addr; });
+    forward(back, front, () => peer);
+    return {
+        addr: front.getsockname(),
+        close() {
+            front.close();
+            back.close();
+        }
+    };
+}
+
+async function echo(server) {
+    while (true) {
+        const rinfo = await server.recv();
+        if (!rinfo.data) {
+            break;
+        }
+        server.send(rinfo.data, rinfo.addr);
+    }
+}
+
+function percentile(sorted, p) {
+    if (sorted.length === 0) {
+        return NaN;
+    }
+    return sorted[Math.min(sorted.length - 1, Math.floor(sorted.length * p))];
+}
+
+async function run(fec) {
+    const opts = { nodelay: 1, interval: INTERVAL, resend: 2, nc: 1, sndwnd: 256, rcvwnd: 256 };
+    if (fec) {
+        Object.assign(opts, { dataShards, parityShards });
+    }
+    const server = new ijjs.KCP();
+    const client = new ijjs.KCP();
+    server.bind({ ip: '127.0.0.1' });
+    server.setOptions(opts);
+    client.setOptions(opts);
+    const relay = startRelay(server.getsockname());
+    echo(server);
+
+    const sentAt = new Array(messages);
+    const latencies = [];
+    const done = (async () => {
+        while (latencies.length < messages) {
+            const rinfo = await client.recv();
+            if (!rinfo.data) {
+                break;
+            }
+            const i = new DataView(rinfo.data.buffer).getUint32(0, true);
+            latencies.push(performance.now() - sentAt[i]);
+        }
+    })();
+
+    const start = performance.now();
+    for (let i = 0; i < messages; i++) {
+        const msg = new Uint8Array(64);
+        new DataView(msg.buffer).setUint32(0, i, true);
+        sentAt[i] = performance.now();
+        client.send(msg, relay.addr);
+        await sleep(INTERVAL);
+    }
+    await Promise.race([ done, sleep(TIMEOUT) ]);
+    const elapsed = performance.now() - start;
+    const stats = client.stats();
+    client.close();
+    server.close();
+    relay.close();
+
+    latencies.sort((a, b) => a - b);
+    return {
+        delivered: latencies.length,
+        p50: percentile(latencies, 0.5),
+        p99: percentile(latencies, 0.99),
+        elapsed,
+        retransmits: stats.retransmits,
+        recovered: stats.fecRecovered
+    };
+}
+
+function report(name, r) {
+    console.log(`${name.padEnd(8)} delivered ${r.delivered}/${messages}` +
+        `  p50 ${r.p50.toFixed(1)}ms  p99 ${r.p99.toFixed(1)}ms` +
+        `  retransmits ${r.retransmits}  recovered ${r.recovered}  (${(r.elapsed / 1000).toFixed(1)}s)`);
+}
+
+(async () => {
+    console.log(`drop rate ${dropRate * 100}%, ${messages} messages, FEC ${dataShards}+${parityShards}`);
+    report('no FEC', await run(false));
+    report('FEC', await run(true));
+})();
@@ -0,0 +1,70 @@
+// Wall time of running an app made of a tree of modules, with the imports of
+// every module read on the thread pool and with --no-module-prefetch. Each
+// module imports two others, so most of the graph is known ahead of the
+// compiler.
+//
+// usage: ijjs module-prefetch.js [modules] [runs]
+//
+
+const modules = Number(ijjs.args[2] ?? 500);
+const runs = Number(ijjs.args[3] ?? 20);
+
+async function writeFile(path, text) {
+    const f = await ijjs.fs.open(path, 'w');
+    await f.write(text);
+    await f.close();
+}
+
+async function generate(dir) {
+    const padding = `// ${'x'.repeat(2000)}\n`;
+    for (let i = 0; i < modules; i++) {
+        const children = [ 2 * i + 1, 2 * i + 2 ].filter(n => n < modules);
+        const lines = children.map(n => `import { f${n} } from './m${n}.js';`);
+        lines.push(`export function f${i}() { return ${[ i, ...children.map(n => `f${n}()`) ].join(' + ')}; }`);
+        await writeFile(ijjs.join(dir, `m${i}.js`), lines.join('\n') + '\n' + padding);
+    }
+    await writeFile(ijjs.join(dir, 'main.js'), 'import { f0 } from \'./m0.js\';\nconsole.log(f0());\n');
+}
+
+async function remove(dir) {
+    for (let i = 0; i < modules; i++) {
+        await ijjs.fs.unlink(ijjs.join(dir, `m${i}.js`));
+    }
+    await ijjs.fs.unlink(ijjs.join(dir, 'main.js'));
+    await ijjs.fs.rmdir(dir);
+}
+
+async function runOnce(args) {
+    const start = ijjs.hrtime();
+    const proc = ijjs.spawn([ ijjs.exepath(), ...args ], { stdout: 'ignore' });
+    await proc.wait();
+    return Number(ijjs.hrtime() - start) / 1e6;
+}
+
+function stats(values) {
+    const sorted = [ ...values ].sort((a, b) => a - b);
+    const mean = sorted.reduce((a, b) => a + b, 0) / sorted.length;
+    return `mean ${mean.toFixed(3)}ms  p50 ${sorted[sorted.length >> 1].toFixed(3)}ms  min ${sorted[0].toFixed(3)}ms  max ${sorted[sorted.length - 1].toFixed(3)}ms`;
+}
+
+(async () => {
+    const dir = await ijjs.fs.mkdtemp('bench_prefetchXXXXXX');
+    await generate(dir);
+    const main = ijjs.join(dir, 'main.js');
+    const variants = [
+        [ 'prefetch', [ main ] ],
+        [ 'no prefetch', [ '--no-module-prefetch', main ] ]
+    ];
+    const times = new Map(variants.map(([ name ]) => [ name, [] ]));
+    // warm up the page cache before measuring
+    await runOnce([ main ]);
+    for (let i = 0; i < runs; i++) {
+        for (const [ name, args ] of variants) {
+            times.get(name).push(await runOnce(args));
+        }
+    }
+    for (const [ name, values ] of times) {
+        console.log(`${`${modules} modules, ${name}`.padEnd(28)} ${stats(values)}`);
+    }
+    await remove(dir);
+})();
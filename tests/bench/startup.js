@@ -0,0 +1,61 @@
+// Time from spawning ijjs to the first statement of the script, plus the
+// startup phases the child reports with ijjs.startupTimings(). The child then
+// touches every lazily loaded builtin so their init times are reported too.
+//
+// usage: ijjs startup.js [runs]
+//
+
+const runs = Number(ijjs.args[2] ?? 50);
+const script = [
+    'const now = ijjs.hrtime();',
+    '[ TextEncoder, URL, fetch, WebAssembly, ijjs.getopts, ijjs.hash, ijjs.join, ijjs.uuidv4 ];',
+    'console.log(JSON.stringify({ now: String(now), timings: ijjs.startupTimings() }));'
+].join(' ');
+
+async function readAll(stream) {
+    const chunks = [];
+    while (true) {
+        const chunk = await stream.read(4096);
+        if (!chunk) {
+            break;
+        }
+        chunks.push(new TextDecoder().decode(chunk));
+    }
+    return chunks.join('');
+}
+
+async function runOnce() {
+    const start = ijjs.hrtime();
+    const proc = ijjs.spawn([ ijjs.exepath(), '-e', script ], { stdout: 'pipe' });
+    const output = await readAll(proc.stdout);
+    await proc.wait();
+    const result = JSON.parse(output);
+    return { firstStatement: Number(BigInt(result.now) - start) / 1e6, timings: result.timings };
+}
+
+function stats(values) {
+    const sorted = [ ...values ].sort((a, b) => a - b);
+    const mean = sorted.reduce((a, b) => a + b, 0) / sorted.length;
+    return `mean ${mean.toFixed(3)}ms  p50 ${sorted[sorted.length >> 1].toFixed(3)}ms  min ${sorted[0].toFixed(3)}ms  max ${sorted[sorted.length - 1].toFixed(3)}ms`;
+}
+
+(async () => {
+    const firstStatement = [];
+    const phases = new Map();
+    // warm up the page cache before measuring
+    await runOnce();
+    for (let i = 0; i < runs; i++) {
+        const result = await runOnce();
+        firstStatement.push(result.firstStatement);
+        for (const { name, duration } of result.timings) {
+            if (!phases.has(name)) {
+                phases.set(name, []);
+            }
+            phases.get(name).push(duration);
+        }
+    }
+    console.log(`${'exec to first statement'.padEnd(24)} ${stats(firstStatement)}`);
+    for (const [ name, durations ] of phases) {
+        console.log(`${name.padEnd(24)} ${stats(durations)}`);
+    }
+})();
@@ -0,0 +1,51 @@
+// Creates and clears a large number of timers.
+//
+// usage: ijjs timers.js [count]
+//
+
+const count = Number(ijjs.args[2] ?? 1000000);
+
+function measure(name, fn) {
+    const start = performance.now();
+    const n = fn();
+    const elapsed = performance.now() - start;
+    console.log(`${name.padEnd(24)} ${elapsed.toFixed(1)}ms  (${(elapsed * 1e6 / n).toFixed(0)}ns/op)`);
+}
+
+const noop = () => {};
+const timers = new Array(count);
+
+measure('setTimeout', () => {
+    for (let i = 0; i < count; i++) {
+        timers[i] = setTimeout(noop, 1000 + (i % 60000));
+    }
+    return count;
+});
+
+measure('clearTimeout', () => {
+    for (let i = 0; i < count; i++) {
+        clearTimeout(timers[i]);
+    }
+    return count;
+});
+
+measure('set + clear', () => {
+    for (let i = 0; i < count; i++) {
+        clearTimeout(setTimeout(noop, 30000));
+    }
+    return count;
+});
+
+timers.fill(undefined);
+
+const fireCount = Math.min(count, 100000);
+let fired = 0;
+const start = performance.now();
+for (let i = 0; i < fireCount; i++) {
+    setTimeout(() => {
+        if (++fired === fireCount) {
+            const elapsed = performance.now() - start;
+            console.log(`${'fire'.padEnd(24)} ${fireCount} timers due within 100ms, last fired after ${elapsed.toFixed(1)}ms`);
+        }
+    }, i % 100);
+}
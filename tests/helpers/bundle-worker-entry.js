@@ -0,0 +1,3 @@
+import assert from '../assert.js';
+
+self.onmessage = e => self.postMessage(typeof assert.eq + ' ' + e.data * 2);
@@ -0,0 +1,7 @@
+const w = new Worker('./helpers/bundle-worker-entry.js');
+
+w.onmessage = e => {
+    console.log(e.data);
+    w.terminate();
+};
+w.postMessage(20);
@@ -0,0 +1,3 @@
+import assert from '../assert.js';
+
+console.log(typeof assert.eq, import.meta.main);
@@ -0,0 +1,18 @@
+// Grows the heap by several MB, half of it cyclic garbage, and reports the collections and
+// whether the heap hit its limit.
+const keep = [];
+let error = 'none';
+try {
+    for (let i = 0; i < 20000; i++) {
+        const a = { data: new Array(16).fill(i) };
+        a.self = { a };
+        if (i % 2 === 0)
+            keep.push(a);
+    }
+} catch (e) {
+    // null is thrown when there is no memory left for the error object either
+    error = e ? e.message : 'out of memory';
+    keep.length = 0;
+    ijjs.gc();
+}
+console.log(JSON.stringify({ error, collections: performance.getEntriesByType('gc').length }));
@@ -0,0 +1,11 @@
+(async () => {
+    const url = ijjs.args[ijjs.args.length - 1];
+    for (let i = 0; i < 2; i++) {
+        try {
+            const mod = await import(url);
+            console.log(Object.keys(mod).join());
+        } catch (e) {
+            console.log(e.name);
+        }
+    }
+})();
@@ -0,0 +1,8 @@
+(async () => {
+    try {
+        const mod = await import(ijjs.args[ijjs.args.length - 1]);
+        console.log(mod.value);
+    } catch (e) {
+        console.log(e.message);
+    }
+})();
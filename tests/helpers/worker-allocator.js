@@ -0,0 +1,4 @@
+const before = ijjs.memoryUsage();
+globalThis.retained = Array.from({ length: 100 }, () => new Uint8Array(64 * 1024));
+const after = ijjs.memoryUsage();
+self.postMessage({ arena: after.arena, before: before.arenaAllocated, after: after.arenaAllocated });
@@ -0,0 +1,5 @@
+
+const before = ijjs.memoryUsage();
+globalThis.retained = Array.from({ length: 200 }, (_, i) => ({ i }));
+const after = ijjs.memoryUsage();
+self.postMessage({ before: before.objects.count, after: after.objects.count });
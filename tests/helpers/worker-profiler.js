@@ -0,0 +1,12 @@
+
+function spin() {
+    let s = 0;
+    for (let i = 0; i < 2e5; i++)
+        s += Math.sqrt(i);
+    return s;
+}
+
+ijjs.profiler.start(200);
+spin();
+const { cpuprofile, folded } = ijjs.profiler.stop();
+self.postMessage({ samples: cpuprofile.samples.length, spin: folded.includes('spin') });
@@ -0,0 +1,50 @@
+import assert from './assert.js';
+
+const thisFile = import.meta.url.slice(7);   // strip "file://"
+
+(async () => {
+    const { allocator } = ijjs;
+    const stats = allocator.stats();
+    assert.ok(stats.allocated > 0, 'allocated bytes are reported');
+    assert.ok(stats.active >= stats.allocated, 'active covers allocated');
+    assert.ok(stats.resident >= stats.active, 'resident covers active');
+    assert.ok(stats.mapped > 0 && stats.retained >= 0, 'mapped and retained are reported');
+    assert.ok(stats.arenas.length > 0, 'initialized arenas are listed');
+    for (const arena of stats.arenas)
+        assert.ok(arena.index >= 0 && arena.active >= 0 && arena.dirty >= 0 && arena.muzzy >= 0, 'arena stats are reported');
+
+    const { dirtyDecayMs, muzzyDecayMs } = stats;
+    allocator.setDecay(1000, -1);
+    let tuned = allocator.stats();
+    assert.eq(tuned.dirtyDecayMs, 1000, 'dirty decay is updated');
+    assert.eq(tuned.muzzyDecayMs, -1, 'muzzy decay is updated');
+    allocator.setDecay(undefined, 0);
+    tuned = allocator.stats();
+    assert.eq(tuned.dirtyDecayMs, 1000, 'undefined keeps the dirty decay');
+    assert.eq(tuned.muzzyDecayMs, 0, 'muzzy decay is updated');
+    allocator.setDecay(dirtyDecayMs, muzzyDecayMs);
+    assert.throws(() => allocator.setDecay(-2), RangeError, 'decay times below -1 are rejected');
+
+    const enabled = allocator.backgroundThread();
+    assert.eq(typeof enabled, 'boolean', 'background thread state is reported');
+    assert.eq(allocator.backgroundThread(enabled), enabled, 'background thread state is set');
+
+    let garbage = Array.from({ length: 1000 }, (_, i) => new Uint8Array(4096 + i));
+    garbage = null;
+    ijjs.gc();
+    allocator.purge();
+    const purged = allocator.stats();
+    assert.eq(purged.arenas.reduce((n, arena) => n + arena.dirty, 0), 0, 'purge releases dirty pages');
+
+    const usage = ijjs.memoryUsage();
+    assert.ok(usage.arena >= 0, 'the runtime owns an arena');
+    assert.ok(usage.arenaAllocated > 0, 'the arena allocations are reported');
+    assert.ok(purged.arenas.some(arena => arena.index === usage.arena), 'the runtime arena is listed');
+    const w = new Worker(ijjs.join(ijjs.dirname(thisFile), 'helpers', 'worker-allocator.js'));
+    const result = await new Promise(resolve => {
+        w.onmessage = event => resolve(event.data);
+    });
+    w.terminate();
+    assert.ok(result.arena >= 0 && result.arena !== usage.arena, 'workers get their own arena');
+    assert.ok(result.after >= result.before + 100 * 64 * 1024, 'worker allocations are attributed to its arena');
+})();
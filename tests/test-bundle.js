@@ -0,0 +1,72 @@
+import assert from './assert.js';
+
+const thisFile = import.meta.url.slice(7);   // strip "file://"
+
+
+async function exec(args) {
+    const proc = ijjs.spawn(args, { stdout: 'pipe', stderr: 'pipe' });
+    const stdout = new TextDecoder().decode(await proc.stdout.read());
+    const stderr = new TextDecoder().decode(await proc.stderr.read());
+    const status = await proc.wait();
+    return { stdout, stderr, status };
+}
+
+function run(...args) {
+    return exec([ ijjs.exepath(), ...args ]);
+}
+
+async function compile(...args) {
+    return compileHelper('code-cache.js', ...args);
+}
+
+async function compileHelper(name, ...args) {
+    const f = await ijjs.fs.mkstemp('test_fileXXXXXX');
+    const path = f.path;
+    await f.close();
+    const script = ijjs.join(ijjs.dirname(thisFile), 'helpers', name);
+    const result = await run('--compile', script, '--output', path, ...args);
+    assert.eq(result.status.exit_status, 0, 'compiling succeeds');
+    const st = await ijjs.fs.stat(path);
+    return { path, size: st.st_size };
+}
+
+(async () => {
+    const bundle = await compile();
+    assert.ok(bundle.size > 0, 'the bundle is written');
+    const result = await run(bundle.path);
+    assert.eq(result.status.exit_status, 0, 'the bundle runs');
+    assert.eq(result.stdout, 'function true\n', 'the entry and its imports come from the bundle');
+
+    const stripped = await compile('--strip-debug');
+    assert.ok(stripped.size < bundle.size, 'stripping debug info makes the bundle smaller');
+    assert.eq((await run(stripped.path)).stdout, result.stdout, 'the stripped bundle runs');
+
+    const exe = await compile('--executable');
+    assert.ok(exe.size > bundle.size, 'the executable carries the runtime and the bundle');
+    const packaged = await exec([ './' + exe.path, '--eval', 'ignored' ]);
+    assert.eq(packaged.status.exit_status, 0, 'the packaged executable runs');
+    assert.eq(packaged.stdout, result.stdout, 'the packaged executable runs the bundle and leaves options to it');
+
+    // the worker entry is looked up relative to the cwd, run from a directory that does not have it
+    const app = await compileHelper('bundle-worker.js', '--executable');
+    const dir = await ijjs.fs.mkdtemp('test_fileXXXXXX');
+    const proc = ijjs.spawn([ ijjs.join(ijjs.cwd(), app.path) ], { cwd: dir, stdout: 'pipe', stderr: 'pipe' });
+    const workerOut = new TextDecoder().decode(await proc.stdout.read());
+    const workerStatus = await proc.wait();
+    assert.eq(workerStatus.exit_status, 0, 'the packaged app runs outside the source tree');
+    assert.eq(workerOut, 'function 40\n', 'the worker entry and its imports come from the bundle');
+    await ijjs.fs.rmdir(dir);
+    await ijjs.fs.unlink(app.path);
+
+    const f = await ijjs.fs.open(bundle.path, 'r+');
+    await f.write('IJJB', 0);
+    await f.write(new Uint8Array(12), 4);
+    await f.close();
+    const bad = await run(bundle.path);
+    assert.ok(bad.status.exit_status !== 0, 'a corrupted bundle fails');
+    assert.ok(bad.stderr.includes('invalid bundle'), 'a corrupted bundle is reported');
+
+    await ijjs.fs.unlink(bundle.path);
+    await ijjs.fs.unlink(stripped.path);
+    await ijjs.fs.unlink(exe.path);
+})();
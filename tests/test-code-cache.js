@@ -0,0 +1,50 @@
+import assert from './assert.js';
+
+const thisFile = import.meta.url.slice(7);   // strip "file://"
+
+
+async function run(...args) {
+    const script = ijjs.join(ijjs.dirname(thisFile), 'helpers', 'code-cache.js');
+    const proc = ijjs.spawn([ ijjs.exepath(), ...args, script ], { stdout: 'pipe', stderr: 'ignore' });
+    const stdout = new TextDecoder().decode(await proc.stdout.read());
+    const status = await proc.wait();
+    return { stdout, status };
+}
+
+async function entries(dir) {
+    const names = [];
+    for await (const item of await ijjs.fs.readdir(dir))
+        names.push(item.name);
+    return names;
+}
+
+(async () => {
+    const dir = await ijjs.fs.mkdtemp('test_fileXXXXXX');
+
+    const first = await run('--code-cache', dir);
+    assert.eq(first.status.exit_status, 0, 'first run succeeds');
+    assert.eq(first.stdout, 'function true\n', 'first run compiles from source');
+    const names = await entries(dir);
+    assert.eq(names.length, 2, 'the entry and its import are cached');
+    assert.ok(names.every(n => n.endsWith('.jsc')), 'cache entries end in .jsc');
+
+    const second = await run('--code-cache', dir);
+    assert.eq(second.stdout, first.stdout, 'cached run gives the same output');
+
+    for (const name of names)
+        await ijjs.fs.unlink(ijjs.join(dir, name));
+    const build = await run('--code-cache', dir, '--build-code-cache');
+    assert.eq(build.status.exit_status, 0, 'building the cache succeeds');
+    assert.eq(build.stdout, '', 'building the cache does not run the code');
+    assert.eq((await entries(dir)).length, 2, 'the prebuilt cache has every module');
+
+    const third = await run('--code-cache', dir);
+    assert.eq(third.stdout, first.stdout, 'prebuilt cache gives the same output');
+
+    for (const name of await entries(dir))
+        await ijjs.fs.unlink(ijjs.join(dir, name));
+    await ijjs.fs.rmdir(dir);
+
+    const bad = await run('--build-code-cache');
+    assert.eq(bad.status.exit_status, 2, 'building the cache needs a directory');
+})();
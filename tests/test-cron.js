@@ -0,0 +1,38 @@
+import assert from './assert.js';
+
+
+(async () => {
+    const { cron } = ijjs;
+    assert.eq(cron.validate('* * * * *'), true, '5 field expression is valid');
+    assert.eq(cron.validate('*/5 1-3 * jan,Feb mon-fri'), true, 'steps, ranges and names are valid');
+    assert.eq(cron.validate('0 0 12 1 * *'), true, '6 field expression is valid');
+    assert.eq(cron.validate('60 * * * *'), false, 'out of range minute is invalid');
+    assert.eq(cron.validate('* * *'), false, 'too few fields is invalid');
+    assert.throws(() => new cron.Job('* 70 * * *', () => {}), SyntaxError, 'invalid expression throws');
+
+    const noop = () => {};
+    const weekly = new cron.Job('30 9 * * 1', noop, 0);
+    const next = new Date(weekly.next());
+    assert.eq(next.getUTCDay(), 1, 'next run is on a monday');
+    assert.eq(next.getUTCHours(), 9, 'next run is at 9h UTC');
+    assert.eq(next.getUTCMinutes(), 30, 'next run is at half past');
+    assert.ok(next.getTime() - Date.now() <= 7 * 86400000, 'next run is within a week');
+
+    const shifted = new cron.Job('0 0 * * *', noop, -480);
+    assert.eq(new Date(shifted.next()).getUTCHours(), 16, 'utc offset shifts the run');
+    assert.eq(new cron.Job('0 0 30 2 *', noop).next(), null, 'impossible date never runs');
+
+    const runner = () => {
+        return new Promise((resolve, reject) => {
+            let count = 0;
+            const job = new cron.Job('* * * * * *', () => {
+                if (++count === 2) {
+                    job.stop();
+                    resolve(count);
+                }
+            });
+            assert.eq(job.start(), job, 'start() returns the job');
+        });
+    };
+    assert.eq(await runner(), 2, 'per-second job fires');
+})();
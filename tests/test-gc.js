@@ -0,0 +1,61 @@
+import assert from './assert.js';
+
+
+async function run(options) {
+    const proc = ijjs.spawn([ ijjs.exepath(), ...options, 'helpers/gc-heap.js' ], { stdout: 'pipe' });
+    let output = '';
+    while (true) {
+        const chunk = await proc.stdout.read(4096);
+        if (!chunk) {
+            break;
+        }
+        output += new TextDecoder().decode(chunk);
+    }
+    await proc.wait();
+    return JSON.parse(output);
+}
+
+(async () => {
+    performance.clearGC();
+    let garbage = [];
+    for (let i = 0; i < 1000; i++) {
+        const a = {};
+        a.b = { a };
+        garbage.push(a);
+    }
+    garbage = null;
+    const before = performance.now();
+    ijjs.gc();
+    const entries = performance.getEntriesByType('gc');
+    assert.ok(entries.length >= 1, 'collections show up as performance entries');
+    const entry = entries[entries.length - 1];
+    assert.eq(entry.name, 'gc', 'entries are named gc');
+    assert.ok(entry.startTime >= before && entry.startTime <= performance.now(), 'startTime is relative to timeOrigin');
+    assert.ok(entry.duration >= 0, 'the pause is timed');
+    assert.ok(entry.detail.freed > 0, 'freed bytes are reported');
+    assert.ok(entry.detail.heapSize > 0, 'the heap size after the collection is reported');
+    performance.clearGC();
+    assert.eq(performance.getEntriesByType('gc').length, 0, 'clearGC() drops gc entries');
+
+    for (let i = 0; i < 300; i++) {
+        ijjs.gc();
+        if (i === 100) {
+            performance.getEntriesByName('gc');
+        }
+    }
+    const first = performance.getEntriesByType('gc');
+    ijjs.gc();
+    const second = performance.getEntriesByType('gc');
+    assert.eq(first.length, 256, 'gc entries are capped at the size of the runtime buffer');
+    assert.eq(second.length, 256, 'polling does not grow the gc entries');
+    assert.ok(second[255].startTime > first[255].startTime, 'the oldest gc entries are dropped');
+    performance.clearGC();
+
+    const defaults = await run([]);
+    assert.eq(defaults.error, 'none', 'the heap is unlimited by default');
+    assert.ok(defaults.collections > 0, 'the gc runs at the default threshold');
+    const threshold = await run([ '--gc-threshold', '256m' ]);
+    assert.eq(threshold.collections, 0, 'no collection runs below --gc-threshold');
+    const limited = await run([ '--max-heap-size', '2m' ]);
+    assert.eq(limited.error, 'out of memory', '--max-heap-size caps the heap');
+})();
@@ -0,0 +1,53 @@
+import assert from './assert.js';
+
+const thisFile = import.meta.url.slice(7);   // strip "file://"
+
+
+class HeapTestEntry {
+    constructor(i) {
+        this.label = 'heap-test-' + i;
+    }
+}
+
+(async () => {
+    const before = ijjs.memoryUsage();
+    assert.ok(before.rss > 0, 'rss is reported');
+    assert.ok(before.heapUsed > 0, 'heap usage is reported');
+    for (const key of [ 'atoms', 'strings', 'objects', 'properties', 'shapes', 'bytecode', 'typedArrays' ])
+        assert.ok(before[key].count >= 0 && before[key].size >= 0, `${key} are reported`);
+    globalThis.heapTestEntries = Array.from({ length: 500 }, (_, i) => new HeapTestEntry(i));
+    const after = ijjs.memoryUsage();
+    assert.ok(after.objects.count >= before.objects.count + 500, 'new objects are counted');
+
+    const path = ijjs.writeHeapSnapshot('test_file_heap.heapsnapshot');
+    assert.eq(path, 'test_file_heap.heapsnapshot', 'the snapshot path is returned');
+    const data = await ijjs.fs.readFile(path);
+    await ijjs.fs.unlink(path);
+    assert.throws(() => ijjs.writeHeapSnapshot('test_file_' + 'x'.repeat(2048)), RangeError, 'a filename that does not fit is rejected');
+    const snapshot = JSON.parse(new TextDecoder().decode(data));
+    const { meta, node_count, edge_count } = snapshot.snapshot;
+    const nodeFields = meta.node_fields.length;
+    const edgeFields = meta.edge_fields.length;
+    assert.eq(snapshot.nodes.length, node_count * nodeFields, 'node_count matches the nodes');
+    assert.eq(snapshot.edges.length, edge_count * edgeFields, 'edge_count matches the edges');
+    let edges = 0;
+    let entries = 0;
+    for (let i = 0; i < snapshot.nodes.length; i += nodeFields) {
+        edges += snapshot.nodes[i + 4];
+        if (snapshot.strings[snapshot.nodes[i + 1]] === 'HeapTestEntry' && meta.node_types[0][snapshot.nodes[i]] === 'object')
+            entries++;
+    }
+    assert.eq(edges, edge_count, 'edges are distributed over the nodes');
+    assert.eq(entries, 500, 'objects are named after their constructor');
+    assert.ok(snapshot.strings.includes('heap-test-42'), 'string values are part of the snapshot');
+    for (let i = 2; i < snapshot.edges.length; i += edgeFields)
+        assert.ok(snapshot.edges[i] % nodeFields === 0 && snapshot.edges[i] < snapshot.nodes.length, 'edges point at nodes');
+
+    const w = new Worker(ijjs.join(ijjs.dirname(thisFile), 'helpers', 'worker-heap.js'));
+    const result = await new Promise(resolve => {
+        w.onmessage = event => resolve(event.data);
+    });
+    w.terminate();
+    assert.ok(result.after >= result.before + 200, 'workers report their own heap');
+    assert.ok(result.before < after.objects.count, 'worker heaps are separate');
+})();
@@ -0,0 +1,25 @@
+import assert from './assert.js';
+
+
+(async () => {
+    assert.throws(() => ijjs.setHighResInterval(() => {}, 0), RangeError, 'zero interval throws');
+
+    const runner = () => {
+        return new Promise((resolve, reject) => {
+            let count = 0;
+            const t = ijjs.setHighResInterval(() => {
+                if (++count === 50) {
+                    ijjs.clearHighResInterval(t);
+                    resolve(t.stats());
+                }
+            }, 500);
+        });
+    };
+    const start = ijjs.hrtime();
+    const stats = await runner();
+    const elapsed = Number(ijjs.hrtime() - start) / 1e3;
+    assert.eq(stats.ticks, 50, 'every tick is counted');
+    assert.eq(stats.interval, 500, 'interval is reported in microseconds');
+    assert.ok(elapsed >= 50 * 500, 'ticks are not early');
+    assert.ok(stats.jitterMin >= 0 && stats.jitterMin <= stats.jitterMean && stats.jitterMean <= stats.jitterMax, 'jitter stats are ordered');
+})();
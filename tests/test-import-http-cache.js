@@ -0,0 +1,88 @@
+import assert from './assert.js';
+
+
+const modules = {
+    '/main.js': { etag: '"main-1"', body: 'import { dep } from \'./dep.js\';\nexport const value = \'main+\' + dep;\n' },
+    '/dep.js': { etag: '"dep-1"', body: 'export const dep = \'dep\';\n' },
+    '/bad.js': { etag: '"bad-1"', body: 'export const bad = ;\n' }
+};
+
+async function serve(server, requests) {
+    while (true) {
+        const conn = await server.accept();
+        if (!conn) {
+            break;
+        }
+        let request = '';
+        while (!request.includes('\r\n\r\n')) {
+            const data = await conn.read();
+            if (!data) {
+                break;
+            }
+            request += new TextDecoder().decode(data);
+        }
+        const path = request.split(' ')[1];
+        const match = /if-none-match: *(.*)\r\n/i.exec(request);
+        const mod = modules[path];
+        let head;
+        let body = '';
+        if (!mod) {
+            head = 'HTTP/1.1 404 Not Found';
+        } else if (match && match[1] === mod.etag) {
+            head = 'HTTP/1.1 304 Not Modified';
+        } else {
+            head = 'HTTP/1.1 200 OK';
+            body = mod.body;
+        }
+        requests.push(`${path} ${head.split(' ')[1]}`);
+        conn.write(`${head}\r\nETag: ${mod ? mod.etag : '""'}\r\nContent-Length: ${body.length}\r\nConnection: close\r\n\r\n${body}`);
+        conn.close();
+    }
+}
+
+async function run(options, url, helper = 'helpers/http-import.js') {
+    const proc = ijjs.spawn([ ijjs.exepath(), ...options, helper, url ], { stdout: 'pipe' });
+    let output = '';
+    while (true) {
+        const chunk = await proc.stdout.read(4096);
+        if (!chunk) {
+            break;
+        }
+        output += new TextDecoder().decode(chunk);
+    }
+    await proc.wait();
+    return output.trim();
+}
+
+(async () => {
+    const dir = await ijjs.fs.mkdtemp('test_fileXXXXXX');
+    const server = new ijjs.TCP();
+    server.bind({ ip: '127.0.0.1' });
+    server.listen();
+    const requests = [];
+    serve(server, requests);
+    const { port } = server.getsockname();
+    const url = `http://127.0.0.1:${port}/main.js`;
+
+    assert.eq(await run([ '--http-cache', dir ], url), 'main+dep', 'modules are fetched');
+    assert.eq(requests.sort().join(), '/dep.js 200,/main.js 200', 'the import is fetched too');
+
+    requests.length = 0;
+    assert.eq(await run([ '--http-cache', dir ], url), 'main+dep', 'cached modules are loaded');
+    assert.eq(requests.sort().join(), '/dep.js 304,/main.js 304', 'cached modules are revalidated');
+
+    requests.length = 0;
+    assert.eq(await run([ '--http-cache', dir, '--offline' ], url), 'main+dep', 'offline uses the cache');
+    assert.eq(requests.length, 0, 'offline does not fetch');
+    const missing = await run([ '--http-cache', dir, '--offline' ], `http://127.0.0.1:${port}/missing.js`);
+    assert.ok(missing.includes('not in the http cache'), 'offline fails for modules that are not cached');
+
+    const bad = await run([ '--http-cache', dir ], `http://127.0.0.1:${port}/bad.js`, 'helpers/http-import-twice.js');
+    assert.eq(bad, 'SyntaxError\nSyntaxError', 'a module that does not compile fails every time it is imported');
+
+    server.close();
+    for await (const entry of await ijjs.fs.readdir(dir)) {
+        await ijjs.fs.unlink(ijjs.join(dir, entry.name));
+    }
+    await ijjs.fs.rmdir(dir);
+})();
@@ -4,4 +4,18 @@ import assert from './assert.js';
     const { default: data } = await import('./fixtures/data.json');
     assert.eq(data.widget.debug, 'on', 'string data matches');
     assert.eq(data.widget.window.width, 500, 'number data matches');
+
+    const { default: escapes } = await import('./fixtures/escapes.json');
+    assert.eq(escapes.backtick, 'a `quoted` word', 'backticks are kept');
+    assert.eq(escapes.template, '${not.a.template}', 'template syntax is kept');
+    assert.eq(escapes.escapes, 'line\nbreak "quoted" \\ slash é', 'escapes are decoded once');
+    assert.eq(Object.keys(escapes.list[4]).join(), '__proto__', '__proto__ is an own property');
+
+    let error;
+    try {
+        await import('./fixtures/invalid.json');
+    } catch (e) {
+        error = e;
+    }
+    assert.ok(error instanceof SyntaxError, 'invalid json is a SyntaxError');
 })();
@@ -0,0 +1,22 @@
+import assert from './assert.js';
+
+
+(async () => {
+    ijjs.setJobBudget(100);
+    const before = ijjs.loopMetrics().budgetHits;
+    let fired = false;
+    setTimeout(() => { fired = true; }, 0);
+    let p = Promise.resolve();
+    let firedMidway = false;
+    for (let i = 0; i < 5000; i++) {
+        p = p.then(() => {
+            if (fired)
+                firedMidway = true;
+        });
+    }
+    await p;
+    assert.ok(firedMidway, 'a timer runs while a long promise chain drains');
+    assert.ok(ijjs.loopMetrics().budgetHits > before, 'budget hits are counted');
+    assert.ok(ijjs.loopMetrics().maxJobsPerTick <= 100, 'no tick runs more jobs than the budget');
+    ijjs.setJobBudget(0);
+})();
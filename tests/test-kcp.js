@@ -14,6 +14,37 @@ async function doEchoServer(server) {
     }
 }
 
+// forwards datagrams between a client and a server, drop() decides which ones get lost
+function startRelay(serverAddr, drop) {
+    const front = new ijjs.UDP();
+    const back = new ijjs.UDP();
+    let peer;
+    front.bind({ ip: '127.0.0.1' });
+    back.bind({ ip: '127.0.0.1' });
+    (async () => {
+        let rinfo;
+        while ((rinfo = await front.recv()).data) {
+            peer = rinfo.addr;
+            if (!drop(rinfo.data)) {
+                back.send(rinfo.data, serverAddr);
+            }
+        }
+    })();
+    (async () => {
+        let rinfo;
+        while ((rinfo = await back.recv()).data) {
+            front.send(rinfo.data, peer);
+        }
+    })();
+    return {
+        addr: front.getsockname(),
+        close() {
+            front.close();
+            back.close();
+        }
+    };
+}
+
 (async () => {
     const server = new ijjs.KCP();
     server.bind({ ip: '127.0.0.1' });
@@ -21,6 +52,12 @@ async function doEchoServer(server) {
 
     const serverAddr = server.getsockname();
     const client = new ijjs.KCP();
+    client.setOptions({ nodelay: 1, interval: 10, resend: 2, nc: 1, sndwnd: 128, rcvwnd: 128, minrto: 10 });
+    let stats = client.stats();
+    assert.eq(stats.sndwnd, 128, "setOptions applies the send window");
+    assert.eq(stats.minrto, 10, "setOptions applies minrto after nodelay");
+    assert.throws(() => { client.setOptions({ mtu: 10 }); }, RangeError, "setOptions rejects a too small mtu");
+    assert.throws(() => { client.setOptions({ dataShards: 10 }); }, RangeError, "setOptions rejects FEC without parity");
     client.send("PING", serverAddr);
     let rinfo, dataStr;
     rinfo = await client.recv();
@@ -32,6 +69,57 @@ async function doEchoServer(server) {
     dataStr = new TextDecoder().decode(rinfo.data);
     assert.eq(dataStr, "PING", "sending a Uint8Array works");
     assert.throws(() => { client.send(1234, serverAddr); }, TypeError, "sending anything else gives TypeError");
+    await Promise.all([ client.send("A", serverAddr), client.send("B", serverAddr), client.send("C", serverAddr) ]);
+    for (const expected of [ "A", "B", "C" ]) {
+        rinfo = await client.recv();
+        dataStr = new TextDecoder().decode(rinfo.data);
+        assert.eq(dataStr, expected, "multiple in-flight sends are delivered in order");
+    }
+    stats = client.stats();
+    assert.ok(stats.txPackets > 0 && stats.rxPackets > 0, "stats() counts sent and received packets");
+    assert.ok(stats.txBytes >= stats.txPackets, "stats() counts sent bytes");
     client.close();
     server.close();
+
+    const fecServer = new ijjs.KCP();
+    fecServer.bind({ ip: '127.0.0.1' });
+    fecServer.setOptions({ dataShards: 2, parityShards: 1 });
+    doEchoServer(fecServer);
+    const fecClient = new ijjs.KCP();
+    fecClient.setOptions({ dataShards: 2, parityShards: 1 });
+    stats = fecClient.stats();
+    assert.eq(stats.dataShards, 2, "setOptions enables FEC");
+    assert.eq(stats.mtu, 1400, "FEC header is taken out of the KCP mtu");
+    fecClient.send("PING", fecServer.getsockname());
+    rinfo = await fecClient.recv();
+    dataStr = new TextDecoder().decode(rinfo.data);
+    assert.eq(dataStr, "PING", "sending with FEC works");
+    fecClient.close();
+    fecServer.close();
+
+    const lossyServer = new ijjs.KCP();
+    lossyServer.bind({ ip: '127.0.0.1' });
+    lossyServer.setOptions({ dataShards: 2, parityShards: 1 });
+    doEchoServer(lossyServer);
+    // the first data shard of the client gets lost, its group only has parity for it
+    let dropped = false;
+    const relay = startRelay(lossyServer.getsockname(), data => {
+        if (dropped || data[4] !== 0xf1) {
+            return false;
+        }
+        dropped = true;
+        return true;
+    });
+    const lossyClient = new ijjs.KCP();
+    lossyClient.setOptions({ dataShards: 2, parityShards: 1 });
+    lossyClient.send("LOST", relay.addr);
+    rinfo = await lossyClient.recv();
+    dataStr = new TextDecoder().decode(rinfo.data);
+    assert.ok(dropped, "the relay dropped a data shard");
+    assert.eq(dataStr, "LOST", "a lost data shard is rebuilt from parity");
+    assert.ok(lossyServer.stats().fecRecovered > 0, "stats() counts recovered shards");
+    assert.eq(lossyClient.stats().retransmits, 0, "the lost shard is not retransmitted");
+    lossyClient.close();
+    lossyServer.close();
+    relay.close();
 })();
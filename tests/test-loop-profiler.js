@@ -0,0 +1,23 @@
+import assert from './assert.js';
+
+
+(async () => {
+    const { loopProfiler } = ijjs;
+    assert.eq(loopProfiler.snapshot().enabled, false, 'profiler is off by default');
+    loopProfiler.start();
+    await new Promise(resolve => setTimeout(resolve, 10));
+    await new Promise(resolve => setImmediate(resolve));
+    await new Promise(resolve => setTimeout(resolve, 1));
+    ijjs.gc();
+    const snap = loopProfiler.snapshot(true);
+    assert.eq(snap.enabled, true, 'profiler is on');
+    assert.ok(snap.timers.count >= 1, 'timer callbacks are profiled');
+    assert.ok(snap.immediates.count >= 1, 'immediates are profiled');
+    assert.ok(snap.gc.count >= 1, 'gc is profiled');
+    assert.ok(snap.timers.p50 <= snap.timers.p99 && snap.timers.p99 <= snap.timers.max, 'percentiles are ordered');
+    assert.eq(loopProfiler.snapshot().timers.count, 0, 'snapshot(true) resets the histograms');
+    loopProfiler.stop();
+    await new Promise(resolve => setTimeout(resolve, 1));
+    assert.eq(loopProfiler.snapshot().timers.count, 0, 'nothing is recorded once stopped');
+    assert.throws(() => loopProfiler.start(-1), RangeError, 'negative dump interval throws');
+})();
@@ -0,0 +1,42 @@
+import assert from './assert.js';
+
+
+async function writeModule(path, source) {
+    const f = await ijjs.fs.open(path, 'w');
+    await f.write(source);
+    await f.close();
+}
+
+(async () => {
+    const dir = await ijjs.fs.mkdtemp('test_fileXXXXXX');
+    const files = {
+        'main.js': [
+            '// import { no } from \'./missing1.js\';',
+            '/* export * from \'./missing2.js\'; */',
+            'const text = "import x from \'./missing3.js\'";',
+            'import { a } from \'./a.js\';',
+            'import * as b from "./b.js";',
+            'import \'./c.js\';',
+            'export { d } from \'./d.js\';',
+            'export const main = [ a, b.b, globalThis.c, text.length ].join();'
+        ].join('\n'),
+        // a cycle back to the module that imported it
+        'a.js': 'import { main } from \'./main.js\';\nexport const a = \'a\';\nexport const getMain = () => main;\n',
+        'b.js': 'export { a as b } from \'./a.js\';\n',
+        'c.js': 'globalThis.c = \'c\';\n',
+        'd.js': 'import(\'./a.js\');\nexport default 1;\nexport const d = import.meta.url;\n'
+    };
+    for (const [ name, source ] of Object.entries(files)) {
+        await writeModule(ijjs.join(dir, name), source);
+    }
+    const mod = await import('./' + ijjs.join(dir, 'main.js'));
+    assert.eq(mod.main, 'a,a,c,29', 'the module graph is loaded');
+    assert.eq(mod.d, 'file://' + await ijjs.fs.realpath(ijjs.join(dir, 'd.js')), 're-exports are loaded');
+    const a = await import('./' + ijjs.join(dir, 'a.js'));
+    assert.eq(a.getMain(), mod.main, 'cycles are loaded once');
+
+    for (const name of Object.keys(files)) {
+        await ijjs.fs.unlink(ijjs.join(dir, name));
+    }
+    await ijjs.fs.rmdir(dir);
+})();
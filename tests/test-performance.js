@@ -37,3 +37,25 @@ assert.ok(d >= 1000 && d <= 2000, 'duration works');
 performance.clearMeasures();
 entries = performance.getEntriesByName('m');
 assert.equal(entries.length, 0, 'there should be 0 entries');
+
+
+// event loop utilization
+
+const elu = performance.eventLoopUtilization();
+assert.eq(typeof elu.utilization, 'number', 'eventLoopUtilization() returns utilization');
+
+setTimeout(() => {
+    now = Date.now();
+    while (Date.now() - now < 50);
+    Promise.resolve().then(() => {});
+    setTimeout(() => {
+        const delta = performance.eventLoopUtilization(elu);
+        assert.ok(delta.active >= 40, 'busy time is counted as active');
+        assert.ok(delta.idle >= 0 && delta.utilization > 0 && delta.utilization <= 1, 'utilization is a ratio');
+        assert.ok(delta.ticks > 0 && delta.jobs > 0, 'ticks and jobs are counted');
+        const lag = performance.eventLoopLag(true);
+        assert.ok(lag.count > 0 && lag.max >= 40, 'the busy tick shows up as lag');
+        assert.ok(lag.p50 <= lag.p99 && lag.p99 <= lag.max, 'lag percentiles are ordered');
+        assert.eq(performance.eventLoopLag().count, 0, 'eventLoopLag(true) resets the histogram');
+    }, 10);
+}, 10);
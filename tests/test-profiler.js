@@ -0,0 +1,79 @@
+import assert from './assert.js';
+
+const thisFile = import.meta.url.slice(7);   // strip "file://"
+
+
+async function run(...args) {
+    const proc = ijjs.spawn([ ijjs.exepath(), ...args ], { stdout: 'ignore', stderr: 'pipe' });
+    const stderr = new TextDecoder().decode(await proc.stderr.read() ?? new Uint8Array());
+    const status = await proc.wait();
+    return { stderr, status };
+}
+
+function fib(n) {
+    return n < 2 ? n : fib(n - 1) + fib(n - 2);
+}
+
+(async () => {
+    const { profiler } = ijjs;
+    assert.throws(() => profiler.stop(), TypeError, 'stop() without start() throws');
+    profiler.start(200);
+    assert.throws(() => profiler.start(), TypeError, 'start() twice throws');
+    fib(22);
+    await new Promise(resolve => setTimeout(resolve, 20));
+    fib(22);
+    const { cpuprofile, folded } = profiler.stop();
+    const { nodes, samples, timeDeltas } = cpuprofile;
+    assert.eq(nodes[0].id, 1, 'root node comes first');
+    assert.eq(nodes[0].callFrame.functionName, '(root)', 'root node is named (root)');
+    assert.ok(samples.length > 0, 'samples are recorded');
+    assert.eq(samples.length, timeDeltas.length, 'one time delta per sample');
+    assert.ok(cpuprofile.endTime >= cpuprofile.startTime, 'end time follows start time');
+    const ids = new Set(nodes.map(n => n.id));
+    assert.ok(samples.every(id => ids.has(id)), 'samples refer to existing nodes');
+    assert.ok(nodes.every(n => n.children.every(id => ids.has(id))), 'children refer to existing nodes');
+    const fibNode = nodes.find(n => n.callFrame.functionName === 'fib');
+    assert.ok(fibNode, 'fib shows up in the profile');
+    assert.ok(fibNode.callFrame.url.endsWith('test-profiler.js'), 'frames carry their script');
+    assert.ok(/^[^\n]*fib \([^\n]*test-profiler\.js:\d+\)[^\n]* \d+$/m.test(folded), 'folded stacks name fib');
+    assert.ok(folded.split('\n').filter(Boolean).every(l => /^\S.* \d+$/.test(l)), 'folded lines end with a count');
+
+    // functions collected while profiling must not lend their identity to later ones
+    profiler.start(100);
+    for (let i = 0; i < 20; i++) {
+        (0, eval)(`(function transient${i}() { let s = 0; for (let j = 0; j < 2e5; j++) s += j; return s; })`)();
+        ijjs.gc();
+    }
+    const transient = new Set(profiler.stop().cpuprofile.nodes
+        .map(n => n.callFrame.functionName)
+        .filter(name => name.startsWith('transient')));
+    assert.eq(transient.size, 20, 'every collected function keeps its own name');
+
+    const w = new Worker(ijjs.join(ijjs.dirname(thisFile), 'helpers', 'worker-profiler.js'));
+    const result = await new Promise(resolve => {
+        w.onmessage = event => resolve(event.data);
+    });
+    w.terminate();
+    assert.ok(result.samples > 0, 'workers are profiled on their own');
+    assert.ok(result.spin, 'worker frames show up in the folded stacks');
+
+    const dir = await ijjs.fs.mkdtemp('test_fileXXXXXX');
+    const profDir = ijjs.join(dir, 'profiles', 'run');
+    const ok = await run('--cpu-prof', '--cpu-prof-dir', profDir, '-e', '1');
+    assert.eq(ok.status.exit_status, 0, 'a run with --cpu-prof succeeds');
+    const written = [];
+    for await (const entry of await ijjs.fs.readdir(profDir)) {
+        written.push(entry.name);
+        await ijjs.fs.unlink(ijjs.join(profDir, entry.name));
+    }
+    assert.eq(written.length, 2, '--cpu-prof-dir is created with its parents');
+    await ijjs.fs.rmdir(profDir);
+    await ijjs.fs.rmdir(ijjs.join(dir, 'profiles'));
+    const file = ijjs.join(dir, 'file');
+    await (await ijjs.fs.open(file, 'w')).close();
+    const bad = await run('--cpu-prof', '--cpu-prof-dir', ijjs.join(file, 'run'), '-e', '1');
+    assert.ok(bad.status.exit_status !== 0, 'a profile that cannot be written fails the run');
+    assert.ok(bad.stderr.includes('could not create'), 'the failure is reported');
+    await ijjs.fs.unlink(file);
+    await ijjs.fs.rmdir(dir);
+})();
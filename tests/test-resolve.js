@@ -0,0 +1,34 @@
+import assert from './assert.js';
+
+
+async function writeModule(path, source) {
+    const f = await ijjs.fs.open(path, 'w');
+    await f.write(source);
+    await f.close();
+}
+
+(async () => {
+    const dir = await ijjs.fs.mkdtemp('test_fileXXXXXX');
+    const a = ijjs.join(dir, 'a.js');
+    const b = ijjs.join(dir, 'b.js');
+    await writeModule(a, 'export const url = import.meta.url;\n');
+    const modA = await import('./' + a);
+    assert.eq(modA.url, 'file://' + await ijjs.fs.realpath(a), 'import.meta.url is the real path');
+
+    // the directory was scanned when a.js was imported, b.js did not exist yet
+    await writeModule(b, 'export const url = import.meta.url;\n');
+    const modB = await import('./' + b);
+    assert.eq(modB.url, 'file://' + await ijjs.fs.realpath(b), 'files created later are found');
+
+    let error;
+    try {
+        await import('./' + ijjs.join(dir, 'missing.js'));
+    } catch (e) {
+        error = e;
+    }
+    assert.ok(error instanceof ReferenceError, 'missing files are not resolved');
+
+    await ijjs.fs.unlink(a);
+    await ijjs.fs.unlink(b);
+    await ijjs.fs.rmdir(dir);
+})();
@@ -0,0 +1,29 @@
+import assert from './assert.js';
+
+
+(async () => {
+    const timings = ijjs.startupTimings();
+    const names = timings.map(entry => entry.name);
+    for (const name of [ 'runtime', 'bootstrap', 'console', 'bootstrap2' ])
+        assert.ok(names.includes(name), `${name} is timed`);
+    for (const entry of timings) {
+        assert.ok(entry.startTime >= 0, 'entries start after the process');
+        assert.ok(entry.duration >= 0, 'entries have a duration');
+    }
+    for (let i = 1; i < timings.length; i++)
+        assert.ok(timings[i].startTime >= timings[i - 1].startTime, 'entries are in startup order');
+    assert.eq(timings[0].name, 'runtime', 'the runtime is created first');
+
+    const loaded = () => ijjs.startupTimings().map(entry => entry.name);
+    for (const name of [ 'getopts', 'hashlib', 'uuid', 'wasm' ])
+        assert.ok(!loaded().includes(name), `${name} is not loaded at startup`);
+    assert.eq(ijjs.hash('md5').update('abc').digest(), '900150983cd24fb0d6963f7d28e17f72', 'hashlib loads on first use');
+    assert.ok(loaded().includes('hashlib'), 'lazy modules are timed when they load');
+    const uuidv1 = () => 'custom';
+    ijjs.uuidv1 = uuidv1;
+    assert.ok(!loaded().includes('uuid'), 'overriding a lazy builtin does not load it');
+    assert.eq(ijjs.uuidv4().length, 36, 'uuid loads on first use');
+    assert.eq(ijjs.uuidv1, uuidv1, 'overridden builtins are kept when the module loads');
+    assert.eq(typeof WebAssembly.Module, 'function', 'wasm loads on first use');
+    assert.eq(loaded().filter(name => name === 'wasm').length, 1, 'lazy modules load once');
+})();
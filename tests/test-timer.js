@@ -15,4 +15,69 @@ import assert from './assert.js';
     };
     await runner2();
     assert.ok(true, 'setTimeout timer should be supported');
+
+    const unrefed = setTimeout(() => {
+        assert.ok(false, 'unref\'ed timer should not keep the loop alive');
+    }, 60000);
+    assert.eq(unrefed.unref(), unrefed, 'unref() returns the timer');
+    assert.eq(unrefed.hasRef(), false, 'unref() clears hasRef()');
+
+    const runner3 = () => {
+        return new Promise((resolve, reject) => {
+            let count = 0;
+            const t = setTimeout(() => {
+                if (++count < 3) {
+                    t.refresh();
+                } else {
+                    resolve(count);
+                }
+            }, 10);
+        });
+    };
+    assert.eq(await runner3(), 3, 'refresh() re-arms a fired timeout');
+
+    const runner4 = () => {
+        return new Promise((resolve, reject) => {
+            const order = [];
+            const cancelled = setImmediate(() => order.push('cancelled'));
+            setImmediate((a, b) => order.push(`immediate ${a} ${b}`), 1, 2);
+            setImmediate(() => resolve(order));
+            clearImmediate(cancelled);
+            queueMicrotask(() => order.push('microtask'));
+        });
+    };
+    assert.eq((await runner4()).join(), 'microtask,immediate 1 2', 'setImmediate and queueMicrotask should be supported');
+
+    const runner5 = () => {
+        return new Promise(resolve => {
+            const order = [];
+            const self = setImmediate(arg => {
+                clearImmediate(self);
+                // reuses whatever the clear freed
+                ijjs.gc();
+                const junk = [];
+                for (let i = 0; i < 1000; i++) {
+                    junk.push({ i, s: 'x' + i });
+                }
+                order.push(`self ${arg.value}`);
+            }, { value: 1 });
+            setImmediate(() => resolve(order));
+        });
+    };
+    assert.eq((await runner5()).join(), 'self 1', 'an immediate can clear itself while it runs');
+
+    const runner6 = () => {
+        return new Promise(resolve => {
+            const order = [];
+            setTimeout(() => {
+                order.push('a');
+                Promise.resolve().then(() => order.push('a-micro'));
+            }, 0);
+            setTimeout(() => {
+                order.push('b');
+                resolve(order);
+            }, 0);
+        });
+    };
+    assert.eq((await runner6()).join(), 'a,a-micro,b', 'microtasks run between timer callbacks');
 })();